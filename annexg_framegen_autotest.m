@@ -0,0 +1,1769 @@
+% annexg_framegen_autotest.m : auto-generated file
+
+clear all;
+close all;
+
+x = zeros(1,881);
+y = zeros(1,881);
+x(   1) =   2.5516e-02 + j*  2.5516e-02;
+y(   1) =   2.3000e-02 + j*  2.3000e-02;
+x(   2) =  -1.4694e-01 + j*  2.5955e-03;
+y(   2) =  -1.3200e-01 + j*  2.0000e-03;
+x(   3) =  -1.4946e-02 + j* -8.7115e-02;
+y(   3) =  -1.3000e-02 + j* -7.9000e-02;
+x(   4) =   1.5837e-01 + j* -1.4035e-02;
+y(   4) =   1.4300e-01 + j* -1.3000e-02;
+x(   5) =   1.0206e-01 + j*  0.0000e+00;
+y(   5) =   9.2000e-02 + j*  0.0000e+00;
+x(   6) =   1.5837e-01 + j* -1.4035e-02;
+y(   6) =   1.4300e-01 + j* -1.3000e-02;
+x(   7) =  -1.4946e-02 + j* -8.7115e-02;
+y(   7) =  -1.3000e-02 + j* -7.9000e-02;
+x(   8) =  -1.4694e-01 + j*  2.5955e-03;
+y(   8) =  -1.3200e-01 + j*  2.0000e-03;
+x(   9) =   5.1031e-02 + j*  5.1031e-02;
+y(   9) =   4.6000e-02 + j*  4.6000e-02;
+x(  10) =   2.5955e-03 + j* -1.4694e-01;
+y(  10) =   2.0000e-03 + j* -1.3200e-01;
+x(  11) =  -8.7115e-02 + j* -1.4946e-02;
+y(  11) =  -7.9000e-02 + j* -1.3000e-02;
+x(  12) =  -1.4035e-02 + j*  1.5837e-01;
+y(  12) =  -1.3000e-02 + j*  1.4300e-01;
+x(  13) =   0.0000e+00 + j*  1.0206e-01;
+y(  13) =   0.0000e+00 + j*  9.2000e-02;
+x(  14) =  -1.4035e-02 + j*  1.5837e-01;
+y(  14) =  -1.3000e-02 + j*  1.4300e-01;
+x(  15) =  -8.7115e-02 + j* -1.4946e-02;
+y(  15) =  -7.9000e-02 + j* -1.3000e-02;
+x(  16) =   2.5955e-03 + j* -1.4694e-01;
+y(  16) =   2.0000e-03 + j* -1.3200e-01;
+x(  17) =   5.1031e-02 + j*  5.1031e-02;
+y(  17) =   4.6000e-02 + j*  4.6000e-02;
+x(  18) =  -1.4694e-01 + j*  2.5955e-03;
+y(  18) =  -1.3200e-01 + j*  2.0000e-03;
+x(  19) =  -1.4946e-02 + j* -8.7115e-02;
+y(  19) =  -1.3000e-02 + j* -7.9000e-02;
+x(  20) =   1.5837e-01 + j* -1.4035e-02;
+y(  20) =   1.4300e-01 + j* -1.3000e-02;
+x(  21) =   1.0206e-01 + j*  0.0000e+00;
+y(  21) =   9.2000e-02 + j*  0.0000e+00;
+x(  22) =   1.5837e-01 + j* -1.4035e-02;
+y(  22) =   1.4300e-01 + j* -1.3000e-02;
+x(  23) =  -1.4946e-02 + j* -8.7115e-02;
+y(  23) =  -1.3000e-02 + j* -7.9000e-02;
+x(  24) =  -1.4694e-01 + j*  2.5955e-03;
+y(  24) =  -1.3200e-01 + j*  2.0000e-03;
+x(  25) =   5.1031e-02 + j*  5.1031e-02;
+y(  25) =   4.6000e-02 + j*  4.6000e-02;
+x(  26) =   2.5955e-03 + j* -1.4694e-01;
+y(  26) =   2.0000e-03 + j* -1.3200e-01;
+x(  27) =  -8.7115e-02 + j* -1.4946e-02;
+y(  27) =  -7.9000e-02 + j* -1.3000e-02;
+x(  28) =  -1.4035e-02 + j*  1.5837e-01;
+y(  28) =  -1.3000e-02 + j*  1.4300e-01;
+x(  29) =   0.0000e+00 + j*  1.0206e-01;
+y(  29) =   0.0000e+00 + j*  9.2000e-02;
+x(  30) =  -1.4035e-02 + j*  1.5837e-01;
+y(  30) =  -1.3000e-02 + j*  1.4300e-01;
+x(  31) =  -8.7115e-02 + j* -1.4946e-02;
+y(  31) =  -7.9000e-02 + j* -1.3000e-02;
+x(  32) =   2.5955e-03 + j* -1.4694e-01;
+y(  32) =   2.0000e-03 + j* -1.3200e-01;
+x(  33) =   5.1031e-02 + j*  5.1031e-02;
+y(  33) =   4.6000e-02 + j*  4.6000e-02;
+x(  34) =  -1.4694e-01 + j*  2.5955e-03;
+y(  34) =  -1.3200e-01 + j*  2.0000e-03;
+x(  35) =  -1.4946e-02 + j* -8.7115e-02;
+y(  35) =  -1.3000e-02 + j* -7.9000e-02;
+x(  36) =   1.5837e-01 + j* -1.4035e-02;
+y(  36) =   1.4300e-01 + j* -1.3000e-02;
+x(  37) =   1.0206e-01 + j*  0.0000e+00;
+y(  37) =   9.2000e-02 + j*  0.0000e+00;
+x(  38) =   1.5837e-01 + j* -1.4035e-02;
+y(  38) =   1.4300e-01 + j* -1.3000e-02;
+x(  39) =  -1.4946e-02 + j* -8.7115e-02;
+y(  39) =  -1.3000e-02 + j* -7.9000e-02;
+x(  40) =  -1.4694e-01 + j*  2.5955e-03;
+y(  40) =  -1.3200e-01 + j*  2.0000e-03;
+x(  41) =   5.1031e-02 + j*  5.1031e-02;
+y(  41) =   4.6000e-02 + j*  4.6000e-02;
+x(  42) =   2.5955e-03 + j* -1.4694e-01;
+y(  42) =   2.0000e-03 + j* -1.3200e-01;
+x(  43) =  -8.7115e-02 + j* -1.4946e-02;
+y(  43) =  -7.9000e-02 + j* -1.3000e-02;
+x(  44) =  -1.4035e-02 + j*  1.5837e-01;
+y(  44) =  -1.3000e-02 + j*  1.4300e-01;
+x(  45) =   0.0000e+00 + j*  1.0206e-01;
+y(  45) =   0.0000e+00 + j*  9.2000e-02;
+x(  46) =  -1.4035e-02 + j*  1.5837e-01;
+y(  46) =  -1.3000e-02 + j*  1.4300e-01;
+x(  47) =  -8.7115e-02 + j* -1.4946e-02;
+y(  47) =  -7.9000e-02 + j* -1.3000e-02;
+x(  48) =   2.5955e-03 + j* -1.4694e-01;
+y(  48) =   2.0000e-03 + j* -1.3200e-01;
+x(  49) =   5.1031e-02 + j*  5.1031e-02;
+y(  49) =   4.6000e-02 + j*  4.6000e-02;
+x(  50) =  -1.4694e-01 + j*  2.5955e-03;
+y(  50) =  -1.3200e-01 + j*  2.0000e-03;
+x(  51) =  -1.4946e-02 + j* -8.7115e-02;
+y(  51) =  -1.3000e-02 + j* -7.9000e-02;
+x(  52) =   1.5837e-01 + j* -1.4035e-02;
+y(  52) =   1.4300e-01 + j* -1.3000e-02;
+x(  53) =   1.0206e-01 + j*  0.0000e+00;
+y(  53) =   9.2000e-02 + j*  0.0000e+00;
+x(  54) =   1.5837e-01 + j* -1.4035e-02;
+y(  54) =   1.4300e-01 + j* -1.3000e-02;
+x(  55) =  -1.4946e-02 + j* -8.7115e-02;
+y(  55) =  -1.3000e-02 + j* -7.9000e-02;
+x(  56) =  -1.4694e-01 + j*  2.5955e-03;
+y(  56) =  -1.3200e-01 + j*  2.0000e-03;
+x(  57) =   5.1031e-02 + j*  5.1031e-02;
+y(  57) =   4.6000e-02 + j*  4.6000e-02;
+x(  58) =   2.5955e-03 + j* -1.4694e-01;
+y(  58) =   2.0000e-03 + j* -1.3200e-01;
+x(  59) =  -8.7115e-02 + j* -1.4946e-02;
+y(  59) =  -7.9000e-02 + j* -1.3000e-02;
+x(  60) =  -1.4035e-02 + j*  1.5837e-01;
+y(  60) =  -1.3000e-02 + j*  1.4300e-01;
+x(  61) =   0.0000e+00 + j*  1.0206e-01;
+y(  61) =   0.0000e+00 + j*  9.2000e-02;
+x(  62) =  -1.4035e-02 + j*  1.5837e-01;
+y(  62) =  -1.3000e-02 + j*  1.4300e-01;
+x(  63) =  -8.7115e-02 + j* -1.4946e-02;
+y(  63) =  -7.9000e-02 + j* -1.3000e-02;
+x(  64) =   2.5955e-03 + j* -1.4694e-01;
+y(  64) =   2.0000e-03 + j* -1.3200e-01;
+x(  65) =   5.1031e-02 + j*  5.1031e-02;
+y(  65) =   4.6000e-02 + j*  4.6000e-02;
+x(  66) =  -1.4694e-01 + j*  2.5955e-03;
+y(  66) =  -1.3200e-01 + j*  2.0000e-03;
+x(  67) =  -1.4946e-02 + j* -8.7115e-02;
+y(  67) =  -1.3000e-02 + j* -7.9000e-02;
+x(  68) =   1.5837e-01 + j* -1.4035e-02;
+y(  68) =   1.4300e-01 + j* -1.3000e-02;
+x(  69) =   1.0206e-01 + j*  0.0000e+00;
+y(  69) =   9.2000e-02 + j*  0.0000e+00;
+x(  70) =   1.5837e-01 + j* -1.4035e-02;
+y(  70) =   1.4300e-01 + j* -1.3000e-02;
+x(  71) =  -1.4946e-02 + j* -8.7115e-02;
+y(  71) =  -1.3000e-02 + j* -7.9000e-02;
+x(  72) =  -1.4694e-01 + j*  2.5955e-03;
+y(  72) =  -1.3200e-01 + j*  2.0000e-03;
+x(  73) =   5.1031e-02 + j*  5.1031e-02;
+y(  73) =   4.6000e-02 + j*  4.6000e-02;
+x(  74) =   2.5955e-03 + j* -1.4694e-01;
+y(  74) =   2.0000e-03 + j* -1.3200e-01;
+x(  75) =  -8.7115e-02 + j* -1.4946e-02;
+y(  75) =  -7.9000e-02 + j* -1.3000e-02;
+x(  76) =  -1.4035e-02 + j*  1.5837e-01;
+y(  76) =  -1.3000e-02 + j*  1.4300e-01;
+x(  77) =   0.0000e+00 + j*  1.0206e-01;
+y(  77) =   0.0000e+00 + j*  9.2000e-02;
+x(  78) =  -1.4035e-02 + j*  1.5837e-01;
+y(  78) =  -1.3000e-02 + j*  1.4300e-01;
+x(  79) =  -8.7115e-02 + j* -1.4946e-02;
+y(  79) =  -7.9000e-02 + j* -1.3000e-02;
+x(  80) =   2.5955e-03 + j* -1.4694e-01;
+y(  80) =   2.0000e-03 + j* -1.3200e-01;
+x(  81) =   5.1031e-02 + j*  5.1031e-02;
+y(  81) =   4.6000e-02 + j*  4.6000e-02;
+x(  82) =  -1.4694e-01 + j*  2.5955e-03;
+y(  82) =  -1.3200e-01 + j*  2.0000e-03;
+x(  83) =  -1.4946e-02 + j* -8.7115e-02;
+y(  83) =  -1.3000e-02 + j* -7.9000e-02;
+x(  84) =   1.5837e-01 + j* -1.4035e-02;
+y(  84) =   1.4300e-01 + j* -1.3000e-02;
+x(  85) =   1.0206e-01 + j*  0.0000e+00;
+y(  85) =   9.2000e-02 + j*  0.0000e+00;
+x(  86) =   1.5837e-01 + j* -1.4035e-02;
+y(  86) =   1.4300e-01 + j* -1.3000e-02;
+x(  87) =  -1.4946e-02 + j* -8.7115e-02;
+y(  87) =  -1.3000e-02 + j* -7.9000e-02;
+x(  88) =  -1.4694e-01 + j*  2.5955e-03;
+y(  88) =  -1.3200e-01 + j*  2.0000e-03;
+x(  89) =   5.1031e-02 + j*  5.1031e-02;
+y(  89) =   4.6000e-02 + j*  4.6000e-02;
+x(  90) =   2.5955e-03 + j* -1.4694e-01;
+y(  90) =   2.0000e-03 + j* -1.3200e-01;
+x(  91) =  -8.7115e-02 + j* -1.4946e-02;
+y(  91) =  -7.9000e-02 + j* -1.3000e-02;
+x(  92) =  -1.4035e-02 + j*  1.5837e-01;
+y(  92) =  -1.3000e-02 + j*  1.4300e-01;
+x(  93) =   0.0000e+00 + j*  1.0206e-01;
+y(  93) =   0.0000e+00 + j*  9.2000e-02;
+x(  94) =  -1.4035e-02 + j*  1.5837e-01;
+y(  94) =  -1.3000e-02 + j*  1.4300e-01;
+x(  95) =  -8.7115e-02 + j* -1.4946e-02;
+y(  95) =  -7.9000e-02 + j* -1.3000e-02;
+x(  96) =   2.5955e-03 + j* -1.4694e-01;
+y(  96) =   2.0000e-03 + j* -1.3200e-01;
+x(  97) =   5.1031e-02 + j*  5.1031e-02;
+y(  97) =   4.6000e-02 + j*  4.6000e-02;
+x(  98) =  -1.4694e-01 + j*  2.5955e-03;
+y(  98) =  -1.3200e-01 + j*  2.0000e-03;
+x(  99) =  -1.4946e-02 + j* -8.7115e-02;
+y(  99) =  -1.3000e-02 + j* -7.9000e-02;
+x( 100) =   1.5837e-01 + j* -1.4035e-02;
+y( 100) =   1.4300e-01 + j* -1.3000e-02;
+x( 101) =   1.0206e-01 + j*  0.0000e+00;
+y( 101) =   9.2000e-02 + j*  0.0000e+00;
+x( 102) =   1.5837e-01 + j* -1.4035e-02;
+y( 102) =   1.4300e-01 + j* -1.3000e-02;
+x( 103) =  -1.4946e-02 + j* -8.7115e-02;
+y( 103) =  -1.3000e-02 + j* -7.9000e-02;
+x( 104) =  -1.4694e-01 + j*  2.5955e-03;
+y( 104) =  -1.3200e-01 + j*  2.0000e-03;
+x( 105) =   5.1031e-02 + j*  5.1031e-02;
+y( 105) =   4.6000e-02 + j*  4.6000e-02;
+x( 106) =   2.5955e-03 + j* -1.4694e-01;
+y( 106) =   2.0000e-03 + j* -1.3200e-01;
+x( 107) =  -8.7115e-02 + j* -1.4946e-02;
+y( 107) =  -7.9000e-02 + j* -1.3000e-02;
+x( 108) =  -1.4035e-02 + j*  1.5837e-01;
+y( 108) =  -1.3000e-02 + j*  1.4300e-01;
+x( 109) =   0.0000e+00 + j*  1.0206e-01;
+y( 109) =   0.0000e+00 + j*  9.2000e-02;
+x( 110) =  -1.4035e-02 + j*  1.5837e-01;
+y( 110) =  -1.3000e-02 + j*  1.4300e-01;
+x( 111) =  -8.7115e-02 + j* -1.4946e-02;
+y( 111) =  -7.9000e-02 + j* -1.3000e-02;
+x( 112) =   2.5955e-03 + j* -1.4694e-01;
+y( 112) =   2.0000e-03 + j* -1.3200e-01;
+x( 113) =   5.1031e-02 + j*  5.1031e-02;
+y( 113) =   4.6000e-02 + j*  4.6000e-02;
+x( 114) =  -1.4694e-01 + j*  2.5955e-03;
+y( 114) =  -1.3200e-01 + j*  2.0000e-03;
+x( 115) =  -1.4946e-02 + j* -8.7115e-02;
+y( 115) =  -1.3000e-02 + j* -7.9000e-02;
+x( 116) =   1.5837e-01 + j* -1.4035e-02;
+y( 116) =   1.4300e-01 + j* -1.3000e-02;
+x( 117) =   1.0206e-01 + j*  0.0000e+00;
+y( 117) =   9.2000e-02 + j*  0.0000e+00;
+x( 118) =   1.5837e-01 + j* -1.4035e-02;
+y( 118) =   1.4300e-01 + j* -1.3000e-02;
+x( 119) =  -1.4946e-02 + j* -8.7115e-02;
+y( 119) =  -1.3000e-02 + j* -7.9000e-02;
+x( 120) =  -1.4694e-01 + j*  2.5955e-03;
+y( 120) =  -1.3200e-01 + j*  2.0000e-03;
+x( 121) =   5.1031e-02 + j*  5.1031e-02;
+y( 121) =   4.6000e-02 + j*  4.6000e-02;
+x( 122) =   2.5955e-03 + j* -1.4694e-01;
+y( 122) =   2.0000e-03 + j* -1.3200e-01;
+x( 123) =  -8.7115e-02 + j* -1.4946e-02;
+y( 123) =  -7.9000e-02 + j* -1.3000e-02;
+x( 124) =  -1.4035e-02 + j*  1.5837e-01;
+y( 124) =  -1.3000e-02 + j*  1.4300e-01;
+x( 125) =   0.0000e+00 + j*  1.0206e-01;
+y( 125) =   0.0000e+00 + j*  9.2000e-02;
+x( 126) =  -1.4035e-02 + j*  1.5837e-01;
+y( 126) =  -1.3000e-02 + j*  1.4300e-01;
+x( 127) =  -8.7115e-02 + j* -1.4946e-02;
+y( 127) =  -7.9000e-02 + j* -1.3000e-02;
+x( 128) =   2.5955e-03 + j* -1.4694e-01;
+y( 128) =   2.0000e-03 + j* -1.3200e-01;
+x( 129) =   5.1031e-02 + j*  5.1031e-02;
+y( 129) =   4.6000e-02 + j*  4.6000e-02;
+x( 130) =  -1.4694e-01 + j*  2.5955e-03;
+y( 130) =  -1.3200e-01 + j*  2.0000e-03;
+x( 131) =  -1.4946e-02 + j* -8.7115e-02;
+y( 131) =  -1.3000e-02 + j* -7.9000e-02;
+x( 132) =   1.5837e-01 + j* -1.4035e-02;
+y( 132) =   1.4300e-01 + j* -1.3000e-02;
+x( 133) =   1.0206e-01 + j*  0.0000e+00;
+y( 133) =   9.2000e-02 + j*  0.0000e+00;
+x( 134) =   1.5837e-01 + j* -1.4035e-02;
+y( 134) =   1.4300e-01 + j* -1.3000e-02;
+x( 135) =  -1.4946e-02 + j* -8.7115e-02;
+y( 135) =  -1.3000e-02 + j* -7.9000e-02;
+x( 136) =  -1.4694e-01 + j*  2.5955e-03;
+y( 136) =  -1.3200e-01 + j*  2.0000e-03;
+x( 137) =   5.1031e-02 + j*  5.1031e-02;
+y( 137) =   4.6000e-02 + j*  4.6000e-02;
+x( 138) =   2.5955e-03 + j* -1.4694e-01;
+y( 138) =   2.0000e-03 + j* -1.3200e-01;
+x( 139) =  -8.7115e-02 + j* -1.4946e-02;
+y( 139) =  -7.9000e-02 + j* -1.3000e-02;
+x( 140) =  -1.4035e-02 + j*  1.5837e-01;
+y( 140) =  -1.3000e-02 + j*  1.4300e-01;
+x( 141) =   0.0000e+00 + j*  1.0206e-01;
+y( 141) =   0.0000e+00 + j*  9.2000e-02;
+x( 142) =  -1.4035e-02 + j*  1.5837e-01;
+y( 142) =  -1.3000e-02 + j*  1.4300e-01;
+x( 143) =  -8.7115e-02 + j* -1.4946e-02;
+y( 143) =  -7.9000e-02 + j* -1.3000e-02;
+x( 144) =   2.5955e-03 + j* -1.4694e-01;
+y( 144) =   2.0000e-03 + j* -1.3200e-01;
+x( 145) =   5.1031e-02 + j*  5.1031e-02;
+y( 145) =   4.6000e-02 + j*  4.6000e-02;
+x( 146) =  -1.4694e-01 + j*  2.5955e-03;
+y( 146) =  -1.3200e-01 + j*  2.0000e-03;
+x( 147) =  -1.4946e-02 + j* -8.7115e-02;
+y( 147) =  -1.3000e-02 + j* -7.9000e-02;
+x( 148) =   1.5837e-01 + j* -1.4035e-02;
+y( 148) =   1.4300e-01 + j* -1.3000e-02;
+x( 149) =   1.0206e-01 + j*  0.0000e+00;
+y( 149) =   9.2000e-02 + j*  0.0000e+00;
+x( 150) =   1.5837e-01 + j* -1.4035e-02;
+y( 150) =   1.4300e-01 + j* -1.3000e-02;
+x( 151) =  -1.4946e-02 + j* -8.7115e-02;
+y( 151) =  -1.3000e-02 + j* -7.9000e-02;
+x( 152) =  -1.4694e-01 + j*  2.5955e-03;
+y( 152) =  -1.3200e-01 + j*  2.0000e-03;
+x( 153) =   5.1031e-02 + j*  5.1031e-02;
+y( 153) =   4.6000e-02 + j*  4.6000e-02;
+x( 154) =   2.5955e-03 + j* -1.4694e-01;
+y( 154) =   2.0000e-03 + j* -1.3200e-01;
+x( 155) =  -8.7115e-02 + j* -1.4946e-02;
+y( 155) =  -7.9000e-02 + j* -1.3000e-02;
+x( 156) =  -1.4035e-02 + j*  1.5837e-01;
+y( 156) =  -1.3000e-02 + j*  1.4300e-01;
+x( 157) =   0.0000e+00 + j*  1.0206e-01;
+y( 157) =   0.0000e+00 + j*  9.2000e-02;
+x( 158) =  -1.4035e-02 + j*  1.5837e-01;
+y( 158) =  -1.3000e-02 + j*  1.4300e-01;
+x( 159) =  -8.7115e-02 + j* -1.4946e-02;
+y( 159) =  -7.9000e-02 + j* -1.3000e-02;
+x( 160) =   2.5955e-03 + j* -1.4694e-01;
+y( 160) =   2.0000e-03 + j* -1.3200e-01;
+x( 161) =  -6.1159e-02 + j*  2.5516e-02;
+y( 161) =  -5.5000e-02 + j*  2.3000e-02;
+x( 162) =   1.3625e-02 + j* -1.0827e-01;
+y( 162) =   1.2000e-02 + j* -9.8000e-02;
+x( 163) =   1.0175e-01 + j* -1.1745e-01;
+y( 163) =   9.2000e-02 + j* -1.0600e-01;
+x( 164) =  -1.0194e-01 + j* -1.2773e-01;
+y( 164) =  -9.2000e-02 + j* -1.1500e-01;
+x( 165) =  -3.1125e-03 + j* -5.9662e-02;
+y( 165) =  -3.0000e-03 + j* -5.4000e-02;
+x( 166) =   8.3287e-02 + j*  8.2138e-02;
+y( 166) =   7.5000e-02 + j*  7.4000e-02;
+x( 167) =  -1.4125e-01 + j*  2.2750e-02;
+y( 167) =  -1.2700e-01 + j*  2.1000e-02;
+x( 168) =  -1.3522e-01 + j*  1.8375e-02;
+y( 168) =  -1.2200e-01 + j*  1.7000e-02;
+x( 169) =  -3.8875e-02 + j*  1.6740e-01;
+y( 169) =  -3.5000e-02 + j*  1.5100e-01;
+x( 170) =  -6.2625e-02 + j*  2.4187e-02;
+y( 170) =  -5.6000e-02 + j*  2.2000e-02;
+x( 171) =  -6.6913e-02 + j* -9.0175e-02;
+y( 171) =  -6.0000e-02 + j* -8.1000e-02;
+x( 172) =   7.7162e-02 + j* -1.5663e-02;
+y( 172) =   7.0000e-02 + j* -1.4000e-02;
+x( 173) =   9.1213e-02 + j* -1.0246e-01;
+y( 173) =   8.2000e-02 + j* -9.2000e-02;
+x( 174) =  -1.4562e-01 + j* -7.2362e-02;
+y( 174) =  -1.3100e-01 + j* -6.5000e-02;
+x( 175) =  -6.3463e-02 + j* -4.3600e-02;
+y( 175) =  -5.7000e-02 + j* -3.9000e-02;
+x( 176) =   4.0950e-02 + j* -1.0910e-01;
+y( 176) =   3.7000e-02 + j* -9.8000e-02;
+x( 177) =   6.9338e-02 + j*  6.9338e-02;
+y( 177) =   6.2000e-02 + j*  6.2000e-02;
+x( 178) =   1.3229e-01 + j*  4.5375e-03;
+y( 178) =   1.1900e-01 + j*  4.0000e-03;
+x( 179) =  -2.4937e-02 + j* -1.7824e-01;
+y( 179) =  -2.2000e-02 + j* -1.6100e-01;
+x( 180) =   6.5087e-02 + j*  1.6575e-02;
+y( 180) =   5.9000e-02 + j*  1.5000e-02;
+x( 181) =   2.7150e-02 + j*  6.4938e-02;
+y( 181) =   2.4000e-02 + j*  5.9000e-02;
+x( 182) =  -1.5178e-01 + j*  5.2563e-02;
+y( 182) =  -1.3700e-01 + j*  4.7000e-02;
+x( 183) =   1.1000e-03 + j*  1.2759e-01;
+y( 183) =   1.0000e-03 + j*  1.1500e-01;
+x( 184) =   5.9175e-02 + j* -4.5250e-03;
+y( 184) =   5.3000e-02 + j* -4.0000e-03;
+x( 185) =   1.0821e-01 + j*  2.8725e-02;
+y( 185) =   9.8000e-02 + j*  2.6000e-02;
+x( 186) =  -4.2512e-02 + j*  1.1779e-01;
+y( 186) =  -3.8000e-02 + j*  1.0600e-01;
+x( 187) =  -1.2773e-01 + j*  6.1212e-02;
+y( 187) =  -1.1500e-01 + j*  5.5000e-02;
+x( 188) =   6.6375e-02 + j*  9.7300e-02;
+y( 188) =   6.0000e-02 + j*  8.8000e-02;
+x( 189) =   2.3425e-02 + j* -3.0938e-02;
+y( 189) =   2.1000e-02 + j* -2.8000e-02;
+x( 190) =   1.0742e-01 + j* -9.1862e-02;
+y( 190) =   9.7000e-02 + j* -8.3000e-02;
+x( 191) =   4.4100e-02 + j*  1.2332e-01;
+y( 191) =   4.0000e-02 + j*  1.1100e-01;
+x( 192) =  -5.6875e-03 + j*  1.3349e-01;
+y( 192) =  -5.0000e-03 + j*  1.2000e-01;
+x( 193) =   1.7335e-01 + j*  0.0000e+00;
+y( 193) =   1.5600e-01 + j*  0.0000e+00;
+x( 194) =  -5.6875e-03 + j* -1.3349e-01;
+y( 194) =  -5.0000e-03 + j* -1.2000e-01;
+x( 195) =   4.4100e-02 + j* -1.2332e-01;
+y( 195) =   4.0000e-02 + j* -1.1100e-01;
+x( 196) =   1.0742e-01 + j*  9.1862e-02;
+y( 196) =   9.7000e-02 + j*  8.3000e-02;
+x( 197) =   2.3425e-02 + j*  3.0938e-02;
+y( 197) =   2.1000e-02 + j*  2.8000e-02;
+x( 198) =   6.6375e-02 + j* -9.7300e-02;
+y( 198) =   6.0000e-02 + j* -8.8000e-02;
+x( 199) =  -1.2773e-01 + j* -6.1212e-02;
+y( 199) =  -1.1500e-01 + j* -5.5000e-02;
+x( 200) =  -4.2512e-02 + j* -1.1779e-01;
+y( 200) =  -3.8000e-02 + j* -1.0600e-01;
+x( 201) =   1.0821e-01 + j* -2.8725e-02;
+y( 201) =   9.8000e-02 + j* -2.6000e-02;
+x( 202) =   5.9175e-02 + j*  4.5250e-03;
+y( 202) =   5.3000e-02 + j*  4.0000e-03;
+x( 203) =   1.1000e-03 + j* -1.2759e-01;
+y( 203) =   1.0000e-03 + j* -1.1500e-01;
+x( 204) =  -1.5178e-01 + j* -5.2563e-02;
+y( 204) =  -1.3700e-01 + j* -4.7000e-02;
+x( 205) =   2.7150e-02 + j* -6.4938e-02;
+y( 205) =   2.4000e-02 + j* -5.9000e-02;
+x( 206) =   6.5087e-02 + j* -1.6575e-02;
+y( 206) =   5.9000e-02 + j* -1.5000e-02;
+x( 207) =  -2.4937e-02 + j*  1.7824e-01;
+y( 207) =  -2.2000e-02 + j*  1.6100e-01;
+x( 208) =   1.3229e-01 + j* -4.5375e-03;
+y( 208) =   1.1900e-01 + j* -4.0000e-03;
+x( 209) =   6.9338e-02 + j* -6.9338e-02;
+y( 209) =   6.2000e-02 + j* -6.2000e-02;
+x( 210) =   4.0950e-02 + j*  1.0910e-01;
+y( 210) =   3.7000e-02 + j*  9.8000e-02;
+x( 211) =  -6.3463e-02 + j*  4.3600e-02;
+y( 211) =  -5.7000e-02 + j*  3.9000e-02;
+x( 212) =  -1.4562e-01 + j*  7.2362e-02;
+y( 212) =  -1.3100e-01 + j*  6.5000e-02;
+x( 213) =   9.1213e-02 + j*  1.0246e-01;
+y( 213) =   8.2000e-02 + j*  9.2000e-02;
+x( 214) =   7.7162e-02 + j*  1.5663e-02;
+y( 214) =   7.0000e-02 + j*  1.4000e-02;
+x( 215) =  -6.6913e-02 + j*  9.0175e-02;
+y( 215) =  -6.0000e-02 + j*  8.1000e-02;
+x( 216) =  -6.2625e-02 + j* -2.4187e-02;
+y( 216) =  -5.6000e-02 + j* -2.2000e-02;
+x( 217) =  -3.8875e-02 + j* -1.6740e-01;
+y( 217) =  -3.5000e-02 + j* -1.5100e-01;
+x( 218) =  -1.3522e-01 + j* -1.8375e-02;
+y( 218) =  -1.2200e-01 + j* -1.7000e-02;
+x( 219) =  -1.4125e-01 + j* -2.2750e-02;
+y( 219) =  -1.2700e-01 + j* -2.1000e-02;
+x( 220) =   8.3287e-02 + j* -8.2138e-02;
+y( 220) =   7.5000e-02 + j* -7.4000e-02;
+x( 221) =  -3.1125e-03 + j*  5.9662e-02;
+y( 221) =  -3.0000e-03 + j*  5.4000e-02;
+x( 222) =  -1.0194e-01 + j*  1.2773e-01;
+y( 222) =  -9.2000e-02 + j*  1.1500e-01;
+x( 223) =   1.0175e-01 + j*  1.1745e-01;
+y( 223) =   9.2000e-02 + j*  1.0600e-01;
+x( 224) =   1.3625e-02 + j*  1.0827e-01;
+y( 224) =   1.2000e-02 + j*  9.8000e-02;
+x( 225) =  -1.7335e-01 + j*  0.0000e+00;
+y( 225) =  -1.5600e-01 + j*  0.0000e+00;
+x( 226) =   1.3625e-02 + j* -1.0827e-01;
+y( 226) =   1.2000e-02 + j* -9.8000e-02;
+x( 227) =   1.0175e-01 + j* -1.1745e-01;
+y( 227) =   9.2000e-02 + j* -1.0600e-01;
+x( 228) =  -1.0194e-01 + j* -1.2773e-01;
+y( 228) =  -9.2000e-02 + j* -1.1500e-01;
+x( 229) =  -3.1125e-03 + j* -5.9662e-02;
+y( 229) =  -3.0000e-03 + j* -5.4000e-02;
+x( 230) =   8.3287e-02 + j*  8.2138e-02;
+y( 230) =   7.5000e-02 + j*  7.4000e-02;
+x( 231) =  -1.4125e-01 + j*  2.2750e-02;
+y( 231) =  -1.2700e-01 + j*  2.1000e-02;
+x( 232) =  -1.3522e-01 + j*  1.8375e-02;
+y( 232) =  -1.2200e-01 + j*  1.7000e-02;
+x( 233) =  -3.8875e-02 + j*  1.6740e-01;
+y( 233) =  -3.5000e-02 + j*  1.5100e-01;
+x( 234) =  -6.2625e-02 + j*  2.4187e-02;
+y( 234) =  -5.6000e-02 + j*  2.2000e-02;
+x( 235) =  -6.6913e-02 + j* -9.0175e-02;
+y( 235) =  -6.0000e-02 + j* -8.1000e-02;
+x( 236) =   7.7162e-02 + j* -1.5663e-02;
+y( 236) =   7.0000e-02 + j* -1.4000e-02;
+x( 237) =   9.1213e-02 + j* -1.0246e-01;
+y( 237) =   8.2000e-02 + j* -9.2000e-02;
+x( 238) =  -1.4562e-01 + j* -7.2362e-02;
+y( 238) =  -1.3100e-01 + j* -6.5000e-02;
+x( 239) =  -6.3463e-02 + j* -4.3600e-02;
+y( 239) =  -5.7000e-02 + j* -3.9000e-02;
+x( 240) =   4.0950e-02 + j* -1.0910e-01;
+y( 240) =   3.7000e-02 + j* -9.8000e-02;
+x( 241) =   6.9337e-02 + j*  6.9337e-02;
+y( 241) =   6.2000e-02 + j*  6.2000e-02;
+x( 242) =   1.3229e-01 + j*  4.5375e-03;
+y( 242) =   1.1900e-01 + j*  4.0000e-03;
+x( 243) =  -2.4937e-02 + j* -1.7824e-01;
+y( 243) =  -2.2000e-02 + j* -1.6100e-01;
+x( 244) =   6.5087e-02 + j*  1.6575e-02;
+y( 244) =   5.9000e-02 + j*  1.5000e-02;
+x( 245) =   2.7150e-02 + j*  6.4938e-02;
+y( 245) =   2.4000e-02 + j*  5.9000e-02;
+x( 246) =  -1.5178e-01 + j*  5.2563e-02;
+y( 246) =  -1.3700e-01 + j*  4.7000e-02;
+x( 247) =   1.1000e-03 + j*  1.2759e-01;
+y( 247) =   1.0000e-03 + j*  1.1500e-01;
+x( 248) =   5.9175e-02 + j* -4.5250e-03;
+y( 248) =   5.3000e-02 + j* -4.0000e-03;
+x( 249) =   1.0821e-01 + j*  2.8725e-02;
+y( 249) =   9.8000e-02 + j*  2.6000e-02;
+x( 250) =  -4.2512e-02 + j*  1.1779e-01;
+y( 250) =  -3.8000e-02 + j*  1.0600e-01;
+x( 251) =  -1.2773e-01 + j*  6.1212e-02;
+y( 251) =  -1.1500e-01 + j*  5.5000e-02;
+x( 252) =   6.6375e-02 + j*  9.7300e-02;
+y( 252) =   6.0000e-02 + j*  8.8000e-02;
+x( 253) =   2.3425e-02 + j* -3.0938e-02;
+y( 253) =   2.1000e-02 + j* -2.8000e-02;
+x( 254) =   1.0742e-01 + j* -9.1862e-02;
+y( 254) =   9.7000e-02 + j* -8.3000e-02;
+x( 255) =   4.4100e-02 + j*  1.2332e-01;
+y( 255) =   4.0000e-02 + j*  1.1100e-01;
+x( 256) =  -5.6875e-03 + j*  1.3349e-01;
+y( 256) =  -5.0000e-03 + j*  1.2000e-01;
+x( 257) =   1.7335e-01 + j*  0.0000e+00;
+y( 257) =   1.5600e-01 + j*  0.0000e+00;
+x( 258) =  -5.6875e-03 + j* -1.3349e-01;
+y( 258) =  -5.0000e-03 + j* -1.2000e-01;
+x( 259) =   4.4100e-02 + j* -1.2332e-01;
+y( 259) =   4.0000e-02 + j* -1.1100e-01;
+x( 260) =   1.0742e-01 + j*  9.1862e-02;
+y( 260) =   9.7000e-02 + j*  8.3000e-02;
+x( 261) =   2.3425e-02 + j*  3.0938e-02;
+y( 261) =   2.1000e-02 + j*  2.8000e-02;
+x( 262) =   6.6375e-02 + j* -9.7300e-02;
+y( 262) =   6.0000e-02 + j* -8.8000e-02;
+x( 263) =  -1.2773e-01 + j* -6.1212e-02;
+y( 263) =  -1.1500e-01 + j* -5.5000e-02;
+x( 264) =  -4.2512e-02 + j* -1.1779e-01;
+y( 264) =  -3.8000e-02 + j* -1.0600e-01;
+x( 265) =   1.0821e-01 + j* -2.8725e-02;
+y( 265) =   9.8000e-02 + j* -2.6000e-02;
+x( 266) =   5.9175e-02 + j*  4.5250e-03;
+y( 266) =   5.3000e-02 + j*  4.0000e-03;
+x( 267) =   1.1000e-03 + j* -1.2759e-01;
+y( 267) =   1.0000e-03 + j* -1.1500e-01;
+x( 268) =  -1.5178e-01 + j* -5.2563e-02;
+y( 268) =  -1.3700e-01 + j* -4.7000e-02;
+x( 269) =   2.7150e-02 + j* -6.4938e-02;
+y( 269) =   2.4000e-02 + j* -5.9000e-02;
+x( 270) =   6.5087e-02 + j* -1.6575e-02;
+y( 270) =   5.9000e-02 + j* -1.5000e-02;
+x( 271) =  -2.4937e-02 + j*  1.7824e-01;
+y( 271) =  -2.2000e-02 + j*  1.6100e-01;
+x( 272) =   1.3229e-01 + j* -4.5375e-03;
+y( 272) =   1.1900e-01 + j* -4.0000e-03;
+x( 273) =   6.9338e-02 + j* -6.9338e-02;
+y( 273) =   6.2000e-02 + j* -6.2000e-02;
+x( 274) =   4.0950e-02 + j*  1.0910e-01;
+y( 274) =   3.7000e-02 + j*  9.8000e-02;
+x( 275) =  -6.3463e-02 + j*  4.3600e-02;
+y( 275) =  -5.7000e-02 + j*  3.9000e-02;
+x( 276) =  -1.4562e-01 + j*  7.2362e-02;
+y( 276) =  -1.3100e-01 + j*  6.5000e-02;
+x( 277) =   9.1213e-02 + j*  1.0246e-01;
+y( 277) =   8.2000e-02 + j*  9.2000e-02;
+x( 278) =   7.7162e-02 + j*  1.5663e-02;
+y( 278) =   7.0000e-02 + j*  1.4000e-02;
+x( 279) =  -6.6913e-02 + j*  9.0175e-02;
+y( 279) =  -6.0000e-02 + j*  8.1000e-02;
+x( 280) =  -6.2625e-02 + j* -2.4187e-02;
+y( 280) =  -5.6000e-02 + j* -2.2000e-02;
+x( 281) =  -3.8875e-02 + j* -1.6740e-01;
+y( 281) =  -3.5000e-02 + j* -1.5100e-01;
+x( 282) =  -1.3522e-01 + j* -1.8375e-02;
+y( 282) =  -1.2200e-01 + j* -1.7000e-02;
+x( 283) =  -1.4125e-01 + j* -2.2750e-02;
+y( 283) =  -1.2700e-01 + j* -2.1000e-02;
+x( 284) =   8.3287e-02 + j* -8.2138e-02;
+y( 284) =   7.5000e-02 + j* -7.4000e-02;
+x( 285) =  -3.1125e-03 + j*  5.9662e-02;
+y( 285) =  -3.0000e-03 + j*  5.4000e-02;
+x( 286) =  -1.0194e-01 + j*  1.2773e-01;
+y( 286) =  -9.2000e-02 + j*  1.1500e-01;
+x( 287) =   1.0175e-01 + j*  1.1745e-01;
+y( 287) =   9.2000e-02 + j*  1.0600e-01;
+x( 288) =   1.3625e-02 + j*  1.0827e-01;
+y( 288) =   1.2000e-02 + j*  9.8000e-02;
+x( 289) =  -1.7335e-01 + j*  0.0000e+00;
+y( 289) =  -1.5600e-01 + j*  0.0000e+00;
+x( 290) =   1.3625e-02 + j* -1.0827e-01;
+y( 290) =   1.2000e-02 + j* -9.8000e-02;
+x( 291) =   1.0175e-01 + j* -1.1745e-01;
+y( 291) =   9.2000e-02 + j* -1.0600e-01;
+x( 292) =  -1.0194e-01 + j* -1.2773e-01;
+y( 292) =  -9.2000e-02 + j* -1.1500e-01;
+x( 293) =  -3.1125e-03 + j* -5.9662e-02;
+y( 293) =  -3.0000e-03 + j* -5.4000e-02;
+x( 294) =   8.3287e-02 + j*  8.2138e-02;
+y( 294) =   7.5000e-02 + j*  7.4000e-02;
+x( 295) =  -1.4125e-01 + j*  2.2750e-02;
+y( 295) =  -1.2700e-01 + j*  2.1000e-02;
+x( 296) =  -1.3522e-01 + j*  1.8375e-02;
+y( 296) =  -1.2200e-01 + j*  1.7000e-02;
+x( 297) =  -3.8875e-02 + j*  1.6740e-01;
+y( 297) =  -3.5000e-02 + j*  1.5100e-01;
+x( 298) =  -6.2625e-02 + j*  2.4187e-02;
+y( 298) =  -5.6000e-02 + j*  2.2000e-02;
+x( 299) =  -6.6913e-02 + j* -9.0175e-02;
+y( 299) =  -6.0000e-02 + j* -8.1000e-02;
+x( 300) =   7.7162e-02 + j* -1.5663e-02;
+y( 300) =   7.0000e-02 + j* -1.4000e-02;
+x( 301) =   9.1213e-02 + j* -1.0246e-01;
+y( 301) =   8.2000e-02 + j* -9.2000e-02;
+x( 302) =  -1.4562e-01 + j* -7.2362e-02;
+y( 302) =  -1.3100e-01 + j* -6.5000e-02;
+x( 303) =  -6.3463e-02 + j* -4.3600e-02;
+y( 303) =  -5.7000e-02 + j* -3.9000e-02;
+x( 304) =   4.0950e-02 + j* -1.0910e-01;
+y( 304) =   3.7000e-02 + j* -9.8000e-02;
+x( 305) =   6.9338e-02 + j*  6.9338e-02;
+y( 305) =   6.2000e-02 + j*  6.2000e-02;
+x( 306) =   1.3229e-01 + j*  4.5375e-03;
+y( 306) =   1.1900e-01 + j*  4.0000e-03;
+x( 307) =  -2.4937e-02 + j* -1.7824e-01;
+y( 307) =  -2.2000e-02 + j* -1.6100e-01;
+x( 308) =   6.5087e-02 + j*  1.6575e-02;
+y( 308) =   5.9000e-02 + j*  1.5000e-02;
+x( 309) =   2.7150e-02 + j*  6.4938e-02;
+y( 309) =   2.4000e-02 + j*  5.9000e-02;
+x( 310) =  -1.5178e-01 + j*  5.2563e-02;
+y( 310) =  -1.3700e-01 + j*  4.7000e-02;
+x( 311) =   1.1000e-03 + j*  1.2759e-01;
+y( 311) =   1.0000e-03 + j*  1.1500e-01;
+x( 312) =   5.9175e-02 + j* -4.5250e-03;
+y( 312) =   5.3000e-02 + j* -4.0000e-03;
+x( 313) =   1.0821e-01 + j*  2.8725e-02;
+y( 313) =   9.8000e-02 + j*  2.6000e-02;
+x( 314) =  -4.2512e-02 + j*  1.1779e-01;
+y( 314) =  -3.8000e-02 + j*  1.0600e-01;
+x( 315) =  -1.2773e-01 + j*  6.1212e-02;
+y( 315) =  -1.1500e-01 + j*  5.5000e-02;
+x( 316) =   6.6375e-02 + j*  9.7300e-02;
+y( 316) =   6.0000e-02 + j*  8.8000e-02;
+x( 317) =   2.3425e-02 + j* -3.0938e-02;
+y( 317) =   2.1000e-02 + j* -2.8000e-02;
+x( 318) =   1.0742e-01 + j* -9.1862e-02;
+y( 318) =   9.7000e-02 + j* -8.3000e-02;
+x( 319) =   4.4100e-02 + j*  1.2332e-01;
+y( 319) =   4.0000e-02 + j*  1.1100e-01;
+x( 320) =  -5.6875e-03 + j*  1.3349e-01;
+y( 320) =  -5.0000e-03 + j*  1.2000e-01;
+x( 321) =   1.1792e-01 + j*  0.0000e+00;
+y( 321) =   1.0900e-01 + j*  0.0000e+00;
+x( 322) =   3.3034e-02 + j* -4.3853e-02;
+y( 322) =   3.3000e-02 + j* -4.4000e-02;
+x( 323) =  -1.9656e-03 + j* -3.7627e-02;
+y( 323) =  -2.0000e-03 + j* -3.8000e-02;
+x( 324) =  -8.0905e-02 + j*  8.4431e-02;
+y( 324) =  -8.1000e-02 + j*  8.4000e-02;
+x( 325) =   6.7741e-03 + j* -1.0015e-01;
+y( 325) =   7.0000e-03 + j* -1.0000e-01;
+x( 326) =  -1.2463e-03 + j* -1.1330e-01;
+y( 326) =  -1.0000e-03 + j* -1.1300e-01;
+x( 327) =  -2.1147e-02 + j* -4.6402e-03;
+y( 327) =  -2.1000e-02 + j* -5.0000e-03;
+x( 328) =   1.3569e-01 + j* -1.0469e-01;
+y( 328) =   1.3600e-01 + j* -1.0500e-01;
+x( 329) =   9.7541e-02 + j* -4.4194e-02;
+y( 329) =   9.8000e-02 + j* -4.4000e-02;
+x( 330) =   1.1207e-02 + j* -1.8326e-03;
+y( 330) =   1.1000e-02 + j* -2.0000e-03;
+x( 331) =  -3.2704e-02 + j*  4.4080e-02;
+y( 331) =  -3.3000e-02 + j*  4.4000e-02;
+x( 332) =  -6.0483e-02 + j*  1.2423e-01;
+y( 332) =  -6.0000e-02 + j*  1.2400e-01;
+x( 333) =   1.0138e-02 + j*  9.6602e-02;
+y( 333) =   1.0000e-02 + j*  9.7000e-02;
+x( 334) =   4.4106e-04 + j* -7.7695e-03;
+y( 334) =   0.0000e+00 + j* -8.0000e-03;
+x( 335) =   1.8360e-02 + j* -8.2504e-02;
+y( 335) =   1.8000e-02 + j* -8.3000e-02;
+x( 336) =  -6.9284e-02 + j*  2.6734e-02;
+y( 336) =  -6.9000e-02 + j*  2.7000e-02;
+x( 337) =  -2.1875e-01 + j*  0.0000e+00;
+y( 337) =  -2.1900e-01 + j*  0.0000e+00;
+x( 338) =  -6.9284e-02 + j* -2.6734e-02;
+y( 338) =  -6.9000e-02 + j* -2.7000e-02;
+x( 339) =   1.8360e-02 + j*  8.2504e-02;
+y( 339) =   1.8000e-02 + j*  8.3000e-02;
+x( 340) =   4.4106e-04 + j*  7.7695e-03;
+y( 340) =   0.0000e+00 + j*  8.0000e-03;
+x( 341) =   1.0138e-02 + j* -9.6602e-02;
+y( 341) =   1.0000e-02 + j* -9.7000e-02;
+x( 342) =  -6.0483e-02 + j* -1.2423e-01;
+y( 342) =  -6.0000e-02 + j* -1.2400e-01;
+x( 343) =  -3.2704e-02 + j* -4.4080e-02;
+y( 343) =  -3.3000e-02 + j* -4.4000e-02;
+x( 344) =   1.1207e-02 + j*  1.8326e-03;
+y( 344) =   1.1000e-02 + j*  2.0000e-03;
+x( 345) =   9.7541e-02 + j*  4.4194e-02;
+y( 345) =   9.8000e-02 + j*  4.4000e-02;
+x( 346) =   1.3569e-01 + j*  1.0469e-01;
+y( 346) =   1.3600e-01 + j*  1.0500e-01;
+x( 347) =  -2.1147e-02 + j*  4.6402e-03;
+y( 347) =  -2.1000e-02 + j*  5.0000e-03;
+x( 348) =  -1.2463e-03 + j*  1.1330e-01;
+y( 348) =  -1.0000e-03 + j*  1.1300e-01;
+x( 349) =   6.7741e-03 + j*  1.0015e-01;
+y( 349) =   7.0000e-03 + j*  1.0000e-01;
+x( 350) =  -8.0905e-02 + j* -8.4431e-02;
+y( 350) =  -8.1000e-02 + j* -8.4000e-02;
+x( 351) =  -1.9656e-03 + j*  3.7627e-02;
+y( 351) =  -2.0000e-03 + j*  3.8000e-02;
+x( 352) =   3.3034e-02 + j*  4.3853e-02;
+y( 352) =   3.3000e-02 + j*  4.4000e-02;
+x( 353) =   6.2500e-02 + j*  0.0000e+00;
+y( 353) =   6.2000e-02 + j*  0.0000e+00;
+x( 354) =   5.7213e-02 + j*  5.2497e-02;
+y( 354) =   5.7000e-02 + j*  5.2000e-02;
+x( 355) =   1.5514e-02 + j*  1.7385e-01;
+y( 355) =   1.6000e-02 + j*  1.7400e-01;
+x( 356) =   3.5462e-02 + j*  1.1556e-01;
+y( 356) =   3.5000e-02 + j*  1.1600e-01;
+x( 357) =  -5.0968e-02 + j* -2.0163e-01;
+y( 357) =  -5.1000e-02 + j* -2.0200e-01;
+x( 358) =   1.0781e-02 + j*  3.5906e-02;
+y( 358) =   1.1000e-02 + j*  3.6000e-02;
+x( 359) =   8.9258e-02 + j*  2.0851e-01;
+y( 359) =   8.9000e-02 + j*  2.0900e-01;
+x( 360) =  -4.8514e-02 + j* -7.8880e-03;
+y( 360) =  -4.9000e-02 + j* -8.0000e-03;
+x( 361) =  -3.5041e-02 + j*  4.4194e-02;
+y( 361) =  -3.5000e-02 + j*  4.4000e-02;
+x( 362) =   1.7098e-02 + j* -5.8969e-02;
+y( 362) =   1.7000e-02 + j* -5.9000e-02;
+x( 363) =   5.2981e-02 + j* -1.6983e-02;
+y( 363) =   5.3000e-02 + j* -1.7000e-02;
+x( 364) =   9.8784e-02 + j*  1.0015e-01;
+y( 364) =   9.9000e-02 + j*  1.0000e-01;
+x( 365) =   3.4056e-02 + j* -1.4838e-01;
+y( 365) =   3.4000e-02 + j* -1.4800e-01;
+x( 366) =  -2.8334e-03 + j* -9.4013e-02;
+y( 366) =  -3.0000e-03 + j* -9.4000e-02;
+x( 367) =  -1.2030e-01 + j*  4.1951e-02;
+y( 367) =  -1.2000e-01 + j*  4.2000e-02;
+x( 368) =  -1.3645e-01 + j* -6.9866e-02;
+y( 368) =  -1.3600e-01 + j* -7.0000e-02;
+x( 369) =  -3.1250e-02 + j*  0.0000e+00;
+y( 369) =  -3.1000e-02 + j*  0.0000e+00;
+x( 370) =  -1.3645e-01 + j*  6.9866e-02;
+y( 370) =  -1.3600e-01 + j*  7.0000e-02;
+x( 371) =  -1.2030e-01 + j* -4.1951e-02;
+y( 371) =  -1.2000e-01 + j* -4.2000e-02;
+x( 372) =  -2.8334e-03 + j*  9.4013e-02;
+y( 372) =  -3.0000e-03 + j*  9.4000e-02;
+x( 373) =   3.4056e-02 + j*  1.4838e-01;
+y( 373) =   3.4000e-02 + j*  1.4800e-01;
+x( 374) =   9.8784e-02 + j* -1.0015e-01;
+y( 374) =   9.9000e-02 + j* -1.0000e-01;
+x( 375) =   5.2981e-02 + j*  1.6983e-02;
+y( 375) =   5.3000e-02 + j*  1.7000e-02;
+x( 376) =   1.7098e-02 + j*  5.8969e-02;
+y( 376) =   1.7000e-02 + j*  5.9000e-02;
+x( 377) =  -3.5041e-02 + j* -4.4194e-02;
+y( 377) =  -3.5000e-02 + j* -4.4000e-02;
+x( 378) =  -4.8514e-02 + j*  7.8880e-03;
+y( 378) =  -4.9000e-02 + j*  8.0000e-03;
+x( 379) =   8.9258e-02 + j* -2.0851e-01;
+y( 379) =   8.9000e-02 + j* -2.0900e-01;
+x( 380) =   1.0781e-02 + j* -3.5906e-02;
+y( 380) =   1.1000e-02 + j* -3.6000e-02;
+x( 381) =  -5.0968e-02 + j*  2.0163e-01;
+y( 381) =  -5.1000e-02 + j*  2.0200e-01;
+x( 382) =   3.5462e-02 + j* -1.1556e-01;
+y( 382) =   3.5000e-02 + j* -1.1600e-01;
+x( 383) =   1.5514e-02 + j* -1.7385e-01;
+y( 383) =   1.6000e-02 + j* -1.7400e-01;
+x( 384) =   5.7213e-02 + j* -5.2497e-02;
+y( 384) =   5.7000e-02 + j* -5.2000e-02;
+x( 385) =   6.2500e-02 + j*  0.0000e+00;
+y( 385) =   6.2000e-02 + j*  0.0000e+00;
+x( 386) =   3.3034e-02 + j* -4.3853e-02;
+y( 386) =   3.3000e-02 + j* -4.4000e-02;
+x( 387) =  -1.9656e-03 + j* -3.7627e-02;
+y( 387) =  -2.0000e-03 + j* -3.8000e-02;
+x( 388) =  -8.0905e-02 + j*  8.4431e-02;
+y( 388) =  -8.1000e-02 + j*  8.4000e-02;
+x( 389) =   6.7741e-03 + j* -1.0015e-01;
+y( 389) =   7.0000e-03 + j* -1.0000e-01;
+x( 390) =  -1.2463e-03 + j* -1.1330e-01;
+y( 390) =  -1.0000e-03 + j* -1.1300e-01;
+x( 391) =  -2.1147e-02 + j* -4.6402e-03;
+y( 391) =  -2.1000e-02 + j* -5.0000e-03;
+x( 392) =   1.3569e-01 + j* -1.0469e-01;
+y( 392) =   1.3600e-01 + j* -1.0500e-01;
+x( 393) =   9.7541e-02 + j* -4.4194e-02;
+y( 393) =   9.8000e-02 + j* -4.4000e-02;
+x( 394) =   1.1207e-02 + j* -1.8326e-03;
+y( 394) =   1.1000e-02 + j* -2.0000e-03;
+x( 395) =  -3.2704e-02 + j*  4.4080e-02;
+y( 395) =  -3.3000e-02 + j*  4.4000e-02;
+x( 396) =  -6.0483e-02 + j*  1.2423e-01;
+y( 396) =  -6.0000e-02 + j*  1.2400e-01;
+x( 397) =   1.0138e-02 + j*  9.6602e-02;
+y( 397) =   1.0000e-02 + j*  9.7000e-02;
+x( 398) =   4.4106e-04 + j* -7.7695e-03;
+y( 398) =   0.0000e+00 + j* -8.0000e-03;
+x( 399) =   1.8360e-02 + j* -8.2504e-02;
+y( 399) =   1.8000e-02 + j* -8.3000e-02;
+x( 400) =  -6.9284e-02 + j*  2.6734e-02;
+y( 400) =  -6.9000e-02 + j*  2.7000e-02;
+x( 401) =  -1.3902e-01 + j*  5.0212e-02;
+y( 401) =  -1.3900e-01 + j*  5.0000e-02;
+x( 402) =   4.0924e-03 + j*  1.3971e-02;
+y( 402) =   4.0000e-03 + j*  1.4000e-02;
+x( 403) =   1.0904e-02 + j* -1.0026e-01;
+y( 403) =   1.1000e-02 + j* -1.0000e-01;
+x( 404) =  -9.6993e-02 + j* -2.0346e-02;
+y( 404) =  -9.7000e-02 + j* -2.0000e-02;
+x( 405) =   6.2123e-02 + j*  8.1380e-02;
+y( 405) =   6.2000e-02 + j*  8.1000e-02;
+x( 406) =   1.2359e-01 + j*  1.3892e-01;
+y( 406) =   1.2400e-01 + j*  1.3900e-01;
+x( 407) =   1.0426e-01 + j* -1.5055e-02;
+y( 407) =   1.0400e-01 + j* -1.5000e-02;
+x( 408) =   1.7294e-01 + j* -1.3979e-01;
+y( 408) =   1.7300e-01 + j* -1.4000e-01;
+x( 409) =  -3.9593e-02 + j*  5.8538e-03;
+y( 409) =  -4.0000e-02 + j*  6.0000e-03;
+x( 410) =  -1.3349e-01 + j*  8.9289e-03;
+y( 410) =  -1.3300e-01 + j*  9.0000e-03;
+x( 411) =  -1.5877e-03 + j* -4.3285e-02;
+y( 411) =  -2.0000e-03 + j* -4.3000e-02;
+x( 412) =  -4.7277e-02 + j*  9.2166e-02;
+y( 412) =  -4.7000e-02 + j*  9.2000e-02;
+x( 413) =  -1.0901e-01 + j*  8.1705e-02;
+y( 413) =  -1.0900e-01 + j*  8.2000e-02;
+x( 414) =  -2.3963e-02 + j*  1.0407e-02;
+y( 414) =  -2.4000e-02 + j*  1.0000e-02;
+x( 415) =   9.6496e-02 + j*  1.8549e-02;
+y( 415) =   9.6000e-02 + j*  1.9000e-02;
+x( 416) =   1.9110e-02 + j* -2.2572e-02;
+y( 416) =   1.9000e-02 + j* -2.3000e-02;
+x( 417) =  -8.7335e-02 + j* -4.9411e-02;
+y( 417) =  -8.7000e-02 + j* -4.9000e-02;
+x( 418) =   2.3412e-03 + j*  5.8125e-02;
+y( 418) =   2.0000e-03 + j*  5.8000e-02;
+x( 419) =  -2.1044e-02 + j*  2.2846e-01;
+y( 419) =  -2.1000e-02 + j*  2.2800e-01;
+x( 420) =  -1.0289e-01 + j*  2.2824e-02;
+y( 420) =  -1.0300e-01 + j*  2.3000e-02;
+x( 421) =  -1.9259e-02 + j* -1.7515e-01;
+y( 421) =  -1.9000e-02 + j* -1.7500e-01;
+x( 422) =   1.7825e-02 + j*  1.3177e-01;
+y( 422) =   1.8000e-02 + j*  1.3200e-01;
+x( 423) =  -7.1019e-02 + j*  1.6038e-01;
+y( 423) =  -7.1000e-02 + j*  1.6000e-01;
+x( 424) =  -1.5319e-01 + j* -6.1926e-02;
+y( 424) =  -1.5300e-01 + j* -6.2000e-02;
+x( 425) =  -1.0707e-01 + j*  2.7886e-02;
+y( 425) =  -1.0700e-01 + j*  2.8000e-02;
+x( 426) =   5.5435e-02 + j*  1.4002e-01;
+y( 426) =   5.5000e-02 + j*  1.4000e-01;
+x( 427) =   6.9911e-02 + j*  1.0268e-01;
+y( 427) =   7.0000e-02 + j*  1.0300e-01;
+x( 428) =  -5.5558e-02 + j*  2.4902e-02;
+y( 428) =  -5.6000e-02 + j*  2.5000e-02;
+x( 429) =  -4.2757e-02 + j*  1.6204e-03;
+y( 429) =  -4.3000e-02 + j*  2.0000e-03;
+x( 430) =   1.5685e-02 + j* -1.1806e-01;
+y( 430) =   1.6000e-02 + j* -1.1800e-01;
+x( 431) =   2.5544e-02 + j* -7.1248e-02;
+y( 431) =   2.6000e-02 + j* -7.1000e-02;
+x( 432) =   3.3280e-02 + j*  1.7723e-01;
+y( 432) =   3.3000e-02 + j*  1.7700e-01;
+x( 433) =   1.9764e-02 + j* -2.1368e-02;
+y( 433) =   2.0000e-02 + j* -2.1000e-02;
+x( 434) =   3.5331e-02 + j* -8.8422e-02;
+y( 434) =   3.5000e-02 + j* -8.8000e-02;
+x( 435) =  -8.1238e-03 + j*  1.0070e-01;
+y( 435) =  -8.0000e-03 + j*  1.0100e-01;
+x( 436) =  -3.4906e-02 + j* -9.6425e-03;
+y( 436) =  -3.5000e-02 + j* -1.0000e-02;
+x( 437) =   6.4649e-02 + j*  3.0423e-02;
+y( 437) =   6.5000e-02 + j*  3.0000e-02;
+x( 438) =   9.2473e-02 + j* -3.3884e-02;
+y( 438) =   9.2000e-02 + j* -3.4000e-02;
+x( 439) =   3.1943e-02 + j* -1.2253e-01;
+y( 439) =   3.2000e-02 + j* -1.2300e-01;
+x( 440) =  -1.7529e-02 + j*  9.1692e-02;
+y( 440) =  -1.8000e-02 + j*  9.2000e-02;
+x( 441) =   6.4950e-05 + j* -5.8538e-03;
+y( 441) =   0.0000e+00 + j* -6.0000e-03;
+x( 442) =  -6.2247e-03 + j* -5.6103e-02;
+y( 442) =  -6.0000e-03 + j* -5.6000e-02;
+x( 443) =  -1.9328e-02 + j*  3.9758e-02;
+y( 443) =  -1.9000e-02 + j*  4.0000e-02;
+x( 444) =   5.3200e-02 + j* -1.3138e-01;
+y( 444) =   5.3000e-02 + j* -1.3100e-01;
+x( 445) =   2.1769e-02 + j* -1.3281e-01;
+y( 445) =   2.2000e-02 + j* -1.3300e-01;
+x( 446) =   1.0416e-01 + j* -3.1700e-02;
+y( 446) =   1.0400e-01 + j* -3.2000e-02;
+x( 447) =   1.6267e-01 + j* -4.4512e-02;
+y( 447) =   1.6300e-01 + j* -4.5000e-02;
+x( 448) =  -1.0486e-01 + j* -2.9587e-02;
+y( 448) =  -1.0500e-01 + j* -3.0000e-02;
+x( 449) =  -1.1031e-01 + j* -6.9175e-02;
+y( 449) =  -1.1000e-01 + j* -6.9000e-02;
+x( 450) =  -7.7379e-03 + j* -9.1884e-02;
+y( 450) =  -8.0000e-03 + j* -9.2000e-02;
+x( 451) =  -4.9215e-02 + j* -4.2828e-02;
+y( 451) =  -4.9000e-02 + j* -4.3000e-02;
+x( 452) =   8.4703e-02 + j* -1.7238e-02;
+y( 452) =   8.5000e-02 + j* -1.7000e-02;
+x( 453) =   9.0130e-02 + j*  6.3351e-02;
+y( 453) =   9.0000e-02 + j*  6.3000e-02;
+x( 454) =   1.4880e-02 + j*  1.5338e-01;
+y( 454) =   1.5000e-02 + j*  1.5300e-01;
+x( 455) =   4.8609e-02 + j*  9.3809e-02;
+y( 455) =   4.9000e-02 + j*  9.4000e-02;
+x( 456) =   1.1148e-02 + j*  3.3978e-02;
+y( 456) =   1.1000e-02 + j*  3.4000e-02;
+x( 457) =  -1.1513e-02 + j*  1.1643e-02;
+y( 457) =  -1.2000e-02 + j*  1.2000e-02;
+x( 458) =  -1.5242e-02 + j* -1.7380e-02;
+y( 458) =  -1.5000e-02 + j* -1.7000e-02;
+x( 459) =  -6.0573e-02 + j*  3.1007e-02;
+y( 459) =  -6.1000e-02 + j*  3.1000e-02;
+x( 460) =  -7.0197e-02 + j* -4.0344e-02;
+y( 460) =  -7.0000e-02 + j* -4.0000e-02;
+x( 461) =   1.1415e-02 + j* -1.0863e-01;
+y( 461) =   1.1000e-02 + j* -1.0900e-01;
+x( 462) =   3.7070e-02 + j* -5.9971e-02;
+y( 462) =   3.7000e-02 + j* -6.0000e-02;
+x( 463) =  -3.2158e-03 + j* -1.7750e-01;
+y( 463) =  -3.0000e-03 + j* -1.7800e-01;
+x( 464) =  -7.2051e-03 + j* -1.2808e-01;
+y( 464) =  -7.0000e-03 + j* -1.2800e-01;
+x( 465) =  -5.9293e-02 + j*  1.0042e-01;
+y( 465) =  -5.9000e-02 + j*  1.0000e-01;
+x( 466) =   4.0924e-03 + j*  1.3971e-02;
+y( 466) =   4.0000e-03 + j*  1.4000e-02;
+x( 467) =   1.0904e-02 + j* -1.0026e-01;
+y( 467) =   1.1000e-02 + j* -1.0000e-01;
+x( 468) =  -9.6993e-02 + j* -2.0346e-02;
+y( 468) =  -9.7000e-02 + j* -2.0000e-02;
+x( 469) =   6.2123e-02 + j*  8.1380e-02;
+y( 469) =   6.2000e-02 + j*  8.1000e-02;
+x( 470) =   1.2359e-01 + j*  1.3892e-01;
+y( 470) =   1.2400e-01 + j*  1.3900e-01;
+x( 471) =   1.0426e-01 + j* -1.5055e-02;
+y( 471) =   1.0400e-01 + j* -1.5000e-02;
+x( 472) =   1.7294e-01 + j* -1.3979e-01;
+y( 472) =   1.7300e-01 + j* -1.4000e-01;
+x( 473) =  -3.9593e-02 + j*  5.8538e-03;
+y( 473) =  -4.0000e-02 + j*  6.0000e-03;
+x( 474) =  -1.3349e-01 + j*  8.9289e-03;
+y( 474) =  -1.3300e-01 + j*  9.0000e-03;
+x( 475) =  -1.5877e-03 + j* -4.3285e-02;
+y( 475) =  -2.0000e-03 + j* -4.3000e-02;
+x( 476) =  -4.7277e-02 + j*  9.2166e-02;
+y( 476) =  -4.7000e-02 + j*  9.2000e-02;
+x( 477) =  -1.0901e-01 + j*  8.1705e-02;
+y( 477) =  -1.0900e-01 + j*  8.2000e-02;
+x( 478) =  -2.3963e-02 + j*  1.0407e-02;
+y( 478) =  -2.4000e-02 + j*  1.0000e-02;
+x( 479) =   9.6496e-02 + j*  1.8549e-02;
+y( 479) =   9.6000e-02 + j*  1.9000e-02;
+x( 480) =   1.9110e-02 + j* -2.2572e-02;
+y( 480) =   1.9000e-02 + j* -2.3000e-02;
+x( 481) =  -5.8491e-02 + j*  1.5625e-02;
+y( 481) =  -5.8000e-02 + j*  1.6000e-02;
+x( 482) =  -9.6384e-02 + j* -4.5035e-02;
+y( 482) =  -9.6000e-02 + j* -4.5000e-02;
+x( 483) =  -1.1020e-01 + j*  2.8814e-03;
+y( 483) =  -1.1000e-01 + j*  3.0000e-03;
+x( 484) =  -7.0009e-02 + j*  2.1575e-01;
+y( 484) =  -7.0000e-02 + j*  2.1600e-01;
+x( 485) =  -3.9633e-02 + j*  5.9396e-02;
+y( 485) =  -4.0000e-02 + j*  5.9000e-02;
+x( 486) =   9.9752e-03 + j* -5.5518e-02;
+y( 486) =   1.0000e-02 + j* -5.6000e-02;
+x( 487) =   3.3775e-02 + j*  6.5269e-02;
+y( 487) =   3.4000e-02 + j*  6.5000e-02;
+x( 488) =   1.1684e-01 + j*  3.3229e-02;
+y( 488) =   1.1700e-01 + j*  3.3000e-02;
+x( 489) =   7.7999e-02 + j* -1.3320e-01;
+y( 489) =   7.8000e-02 + j* -1.3300e-01;
+x( 490) =  -4.2787e-02 + j* -1.4617e-01;
+y( 490) =  -4.3000e-02 + j* -1.4600e-01;
+x( 491) =   1.5811e-01 + j* -7.0502e-02;
+y( 491) =   1.5800e-01 + j* -7.1000e-02;
+x( 492) =   2.5371e-01 + j* -2.1064e-02;
+y( 492) =   2.5400e-01 + j* -2.1000e-02;
+x( 493) =   6.7816e-02 + j*  1.1698e-01;
+y( 493) =   6.8000e-02 + j*  1.1700e-01;
+x( 494) =  -4.4181e-02 + j*  1.1426e-01;
+y( 494) =  -4.4000e-02 + j*  1.1400e-01;
+x( 495) =  -3.5493e-02 + j*  4.1044e-02;
+y( 495) =  -3.5000e-02 + j*  4.1000e-02;
+x( 496) =   8.4514e-02 + j*  7.0188e-02;
+y( 496) =   8.5000e-02 + j*  7.0000e-02;
+x( 497) =   1.2019e-01 + j*  9.8821e-03;
+y( 497) =   1.2000e-01 + j*  1.0000e-02;
+x( 498) =   5.7328e-02 + j*  5.4637e-02;
+y( 498) =   5.7000e-02 + j*  5.5000e-02;
+x( 499) =   6.3201e-02 + j*  1.8783e-01;
+y( 499) =   6.3000e-02 + j*  1.8800e-01;
+x( 500) =   9.0615e-02 + j*  1.4939e-01;
+y( 500) =   9.1000e-02 + j*  1.4900e-01;
+x( 501) =  -1.6572e-02 + j* -3.9388e-02;
+y( 501) =  -1.7000e-02 + j* -3.9000e-02;
+x( 502) =  -7.7545e-02 + j* -7.4953e-02;
+y( 502) =  -7.8000e-02 + j* -7.5000e-02;
+x( 503) =   4.9464e-02 + j*  7.9262e-02;
+y( 503) =   4.9000e-02 + j*  7.9000e-02;
+x( 504) =  -1.3925e-02 + j* -7.2802e-03;
+y( 504) =  -1.4000e-02 + j* -7.0000e-03;
+x( 505) =   3.0284e-02 + j* -2.7314e-02;
+y( 505) =   3.0000e-02 + j* -2.7000e-02;
+x( 506) =   8.0169e-02 + j*  5.3730e-02;
+y( 506) =   8.0000e-02 + j*  5.4000e-02;
+x( 507) =  -1.8594e-01 + j* -6.6717e-02;
+y( 507) =  -1.8600e-01 + j* -6.7000e-02;
+x( 508) =  -3.8678e-02 + j* -2.7439e-02;
+y( 508) =  -3.9000e-02 + j* -2.7000e-02;
+x( 509) =   4.3036e-02 + j* -7.1803e-02;
+y( 509) =   4.3000e-02 + j* -7.2000e-02;
+x( 510) =  -9.1920e-02 + j* -8.9421e-02;
+y( 510) =  -9.2000e-02 + j* -8.9000e-02;
+x( 511) =   2.9008e-02 + j*  1.0539e-01;
+y( 511) =   2.9000e-02 + j*  1.0500e-01;
+x( 512) =  -1.4424e-01 + j*  3.3899e-03;
+y( 512) =  -1.4400e-01 + j*  3.0000e-03;
+x( 513) =  -6.9175e-02 + j* -4.1132e-02;
+y( 513) =  -6.9000e-02 + j* -4.1000e-02;
+x( 514) =   1.3183e-01 + j*  5.6650e-02;
+y( 514) =   1.3200e-01 + j*  5.7000e-02;
+x( 515) =  -1.2644e-01 + j*  6.9747e-02;
+y( 515) =  -1.2600e-01 + j*  7.0000e-02;
+x( 516) =  -3.0845e-02 + j*  1.0869e-01;
+y( 516) =  -3.1000e-02 + j*  1.0900e-01;
+x( 517) =   1.6062e-01 + j* -9.2830e-03;
+y( 517) =   1.6100e-01 + j* -9.0000e-03;
+x( 518) =   5.5544e-02 + j* -4.6264e-02;
+y( 518) =   5.6000e-02 + j* -4.6000e-02;
+x( 519) =  -3.6673e-03 + j*  2.7846e-02;
+y( 519) =  -4.0000e-03 + j*  2.8000e-02;
+x( 520) =  -4.9270e-02 + j*  1.4915e-04;
+y( 520) =  -4.9000e-02 + j*  0.0000e+00;
+x( 521) =  -7.7999e-02 + j* -5.1515e-03;
+y( 521) =  -7.8000e-02 + j* -5.0000e-03;
+x( 522) =   1.4518e-02 + j* -8.7085e-02;
+y( 522) =   1.5000e-02 + j* -8.7000e-02;
+x( 523) =   1.4891e-01 + j* -1.0400e-01;
+y( 523) =   1.4900e-01 + j* -1.0400e-01;
+x( 524) =  -2.1210e-02 + j* -5.1488e-02;
+y( 524) =  -2.1000e-02 + j* -5.1000e-02;
+x( 525) =  -1.5407e-01 + j* -1.0640e-01;
+y( 525) =  -1.5400e-01 + j* -1.0600e-01;
+x( 526) =   2.3950e-02 + j*  3.0336e-02;
+y( 526) =   2.4000e-02 + j*  3.0000e-02;
+x( 527) =   4.6335e-02 + j*  1.2298e-01;
+y( 527) =   4.6000e-02 + j*  1.2300e-01;
+x( 528) =  -3.7721e-03 + j* -9.8391e-02;
+y( 528) =  -4.0000e-03 + j* -9.8000e-02;
+x( 529) =  -6.0896e-02 + j* -1.2847e-01;
+y( 529) =  -6.1000e-02 + j* -1.2800e-01;
+x( 530) =  -2.3695e-02 + j* -3.8053e-02;
+y( 530) =  -2.4000e-02 + j* -3.8000e-02;
+x( 531) =   6.6431e-02 + j* -4.8432e-02;
+y( 531) =   6.6000e-02 + j* -4.8000e-02;
+x( 532) =  -6.7113e-02 + j*  2.6620e-02;
+y( 532) =  -6.7000e-02 + j*  2.7000e-02;
+x( 533) =   5.3702e-02 + j* -5.0254e-02;
+y( 533) =   5.4000e-02 + j* -5.0000e-02;
+x( 534) =   1.7093e-01 + j* -4.8693e-02;
+y( 534) =   1.7100e-01 + j* -4.9000e-02;
+x( 535) =  -1.0752e-01 + j*  1.3227e-01;
+y( 535) =  -1.0800e-01 + j*  1.3200e-01;
+x( 536) =  -1.6149e-01 + j* -1.9437e-02;
+y( 536) =  -1.6100e-01 + j* -1.9000e-02;
+x( 537) =  -6.9812e-02 + j* -7.1508e-02;
+y( 537) =  -7.0000e-02 + j* -7.2000e-02;
+x( 538) =  -1.7688e-01 + j*  4.9116e-02;
+y( 538) =  -1.7700e-01 + j*  4.9000e-02;
+x( 539) =  -1.7218e-01 + j* -4.9870e-02;
+y( 539) =  -1.7200e-01 + j* -5.0000e-02;
+x( 540) =   5.1234e-02 + j* -7.4636e-02;
+y( 540) =   5.1000e-02 + j* -7.5000e-02;
+x( 541) =   1.2227e-01 + j* -5.7366e-02;
+y( 541) =   1.2200e-01 + j* -5.7000e-02;
+x( 542) =   9.1501e-03 + j* -4.3759e-02;
+y( 542) =   9.0000e-03 + j* -4.4000e-02;
+x( 543) =  -1.1900e-02 + j* -2.0670e-02;
+y( 543) =  -1.2000e-02 + j* -2.1000e-02;
+x( 544) =   3.6301e-03 + j*  8.5609e-03;
+y( 544) =   4.0000e-03 + j*  9.0000e-03;
+x( 545) =  -2.9646e-02 + j*  8.0661e-02;
+y( 545) =  -3.0000e-02 + j*  8.1000e-02;
+x( 546) =  -9.6384e-02 + j* -4.5035e-02;
+y( 546) =  -9.6000e-02 + j* -4.5000e-02;
+x( 547) =  -1.1020e-01 + j*  2.8814e-03;
+y( 547) =  -1.1000e-01 + j*  3.0000e-03;
+x( 548) =  -7.0009e-02 + j*  2.1575e-01;
+y( 548) =  -7.0000e-02 + j*  2.1600e-01;
+x( 549) =  -3.9633e-02 + j*  5.9396e-02;
+y( 549) =  -4.0000e-02 + j*  5.9000e-02;
+x( 550) =   9.9752e-03 + j* -5.5518e-02;
+y( 550) =   1.0000e-02 + j* -5.6000e-02;
+x( 551) =   3.3775e-02 + j*  6.5269e-02;
+y( 551) =   3.4000e-02 + j*  6.5000e-02;
+x( 552) =   1.1684e-01 + j*  3.3229e-02;
+y( 552) =   1.1700e-01 + j*  3.3000e-02;
+x( 553) =   7.7999e-02 + j* -1.3320e-01;
+y( 553) =   7.8000e-02 + j* -1.3300e-01;
+x( 554) =  -4.2787e-02 + j* -1.4617e-01;
+y( 554) =  -4.3000e-02 + j* -1.4600e-01;
+x( 555) =   1.5811e-01 + j* -7.0502e-02;
+y( 555) =   1.5800e-01 + j* -7.1000e-02;
+x( 556) =   2.5371e-01 + j* -2.1064e-02;
+y( 556) =   2.5400e-01 + j* -2.1000e-02;
+x( 557) =   6.7816e-02 + j*  1.1698e-01;
+y( 557) =   6.8000e-02 + j*  1.1700e-01;
+x( 558) =  -4.4181e-02 + j*  1.1426e-01;
+y( 558) =  -4.4000e-02 + j*  1.1400e-01;
+x( 559) =  -3.5493e-02 + j*  4.1044e-02;
+y( 559) =  -3.5000e-02 + j*  4.1000e-02;
+x( 560) =   8.4514e-02 + j*  7.0188e-02;
+y( 560) =   8.5000e-02 + j*  7.0000e-02;
+x( 561) =   8.0182e-04 + j*  1.0684e-02;
+y( 561) =   1.0000e-03 + j*  1.1000e-02;
+x( 562) =  -9.9433e-02 + j* -4.7962e-02;
+y( 562) =  -9.9000e-02 + j* -4.8000e-02;
+x( 563) =   5.3608e-02 + j* -1.9608e-01;
+y( 563) =   5.4000e-02 + j* -1.9600e-01;
+x( 564) =   1.2399e-01 + j*  3.4583e-02;
+y( 564) =   1.2400e-01 + j*  3.5000e-02;
+x( 565) =   9.1932e-02 + j*  4.4990e-02;
+y( 565) =   9.2000e-02 + j*  4.5000e-02;
+x( 566) =  -3.6786e-02 + j* -6.5842e-02;
+y( 566) =  -3.7000e-02 + j* -6.6000e-02;
+x( 567) =  -2.1100e-02 + j* -3.8793e-03;
+y( 567) =  -2.1000e-02 + j* -4.0000e-03;
+x( 568) =   4.2497e-02 + j* -6.4901e-02;
+y( 568) =   4.2000e-02 + j* -6.5000e-02;
+x( 569) =   6.1129e-02 + j*  4.8277e-02;
+y( 569) =   6.1000e-02 + j*  4.8000e-02;
+x( 570) =   4.6306e-02 + j*  4.1734e-03;
+y( 570) =   4.6000e-02 + j*  4.0000e-03;
+x( 571) =  -6.2893e-02 + j* -4.5246e-02;
+y( 571) =  -6.3000e-02 + j* -4.5000e-02;
+x( 572) =  -1.0178e-01 + j*  1.5227e-01;
+y( 572) =  -1.0200e-01 + j*  1.5200e-01;
+x( 573) =  -3.9247e-02 + j* -1.8703e-02;
+y( 573) =  -3.9000e-02 + j* -1.9000e-02;
+x( 574) =  -5.2679e-03 + j* -1.0607e-01;
+y( 574) =  -5.0000e-03 + j* -1.0600e-01;
+x( 575) =   8.2708e-02 + j*  3.0580e-02;
+y( 575) =   8.3000e-02 + j*  3.1000e-02;
+x( 576) =   2.2566e-01 + j*  2.7662e-02;
+y( 576) =   2.2600e-01 + j*  2.8000e-02;
+x( 577) =   1.3995e-01 + j* -9.8821e-03;
+y( 577) =   1.4000e-01 + j* -1.0000e-02;
+x( 578) =  -1.3235e-01 + j* -3.2909e-02;
+y( 578) =  -1.3200e-01 + j* -3.3000e-02;
+x( 579) =  -1.1618e-01 + j*  8.8331e-02;
+y( 579) =  -1.1600e-01 + j*  8.8000e-02;
+x( 580) =   2.2730e-02 + j*  5.1840e-02;
+y( 580) =   2.3000e-02 + j*  5.2000e-02;
+x( 581) =  -1.7125e-01 + j* -8.0389e-02;
+y( 581) =  -1.7100e-01 + j* -8.0000e-02;
+x( 582) =  -2.4575e-01 + j* -2.4591e-02;
+y( 582) =  -2.4600e-01 + j* -2.5000e-02;
+x( 583) =  -6.2440e-02 + j* -3.7921e-02;
+y( 583) =  -6.2000e-02 + j* -3.8000e-02;
+x( 584) =  -5.4976e-02 + j* -6.2210e-02;
+y( 584) =  -5.5000e-02 + j* -6.2000e-02;
+x( 585) =  -3.9526e-03 + j* -5.9854e-02;
+y( 585) =  -4.0000e-03 + j* -6.0000e-02;
+x( 586) =   3.3828e-02 + j* -1.1270e-05;
+y( 586) =   3.4000e-02 + j*  0.0000e+00;
+x( 587) =  -3.0212e-02 + j*  2.1491e-02;
+y( 587) =  -3.0000e-02 + j*  2.1000e-02;
+x( 588) =   7.4757e-02 + j* -1.2165e-01;
+y( 588) =   7.5000e-02 + j* -1.2200e-01;
+x( 589) =   4.3170e-02 + j* -7.9610e-02;
+y( 589) =   4.3000e-02 + j* -8.0000e-02;
+x( 590) =  -2.2423e-02 + j*  4.1455e-02;
+y( 590) =  -2.2000e-02 + j*  4.1000e-02;
+x( 591) =   2.6391e-02 + j*  1.3113e-02;
+y( 591) =   2.6000e-02 + j*  1.3000e-02;
+x( 592) =  -3.0970e-02 + j* -1.8454e-02;
+y( 592) =  -3.1000e-02 + j* -1.8000e-02;
+x( 593) =   5.9293e-02 + j*  8.2785e-03;
+y( 593) =   5.9000e-02 + j*  8.0000e-03;
+x( 594) =   1.0893e-01 + j*  7.7986e-02;
+y( 594) =   1.0900e-01 + j*  7.8000e-02;
+x( 595) =   2.0642e-03 + j*  1.0109e-01;
+y( 595) =   2.0000e-03 + j*  1.0100e-01;
+x( 596) =  -1.5853e-02 + j*  5.4066e-02;
+y( 596) =  -1.6000e-02 + j*  5.4000e-02;
+x( 597) =  -5.9185e-02 + j*  7.0205e-02;
+y( 597) =  -5.9000e-02 + j*  7.0000e-02;
+x( 598) =   1.6865e-02 + j*  1.1414e-01;
+y( 598) =   1.7000e-02 + j*  1.1400e-01;
+x( 599) =   1.0364e-01 + j* -3.3909e-02;
+y( 599) =   1.0400e-01 + j* -3.4000e-02;
+x( 600) =  -2.4241e-02 + j* -5.8900e-02;
+y( 600) =  -2.4000e-02 + j* -5.9000e-02;
+x( 601) =  -8.0893e-02 + j*  5.0545e-02;
+y( 601) =  -8.1000e-02 + j*  5.1000e-02;
+x( 602) =  -4.0282e-02 + j* -6.8786e-02;
+y( 602) =  -4.0000e-02 + j* -6.9000e-02;
+x( 603) =  -6.8580e-02 + j*  5.8092e-02;
+y( 603) =  -6.9000e-02 + j*  5.8000e-02;
+x( 604) =  -6.7265e-02 + j*  1.1723e-01;
+y( 604) =  -6.7000e-02 + j*  1.1700e-01;
+x( 605) =   6.5010e-03 + j* -1.3122e-01;
+y( 605) =   7.0000e-03 + j* -1.3100e-01;
+x( 606) =   8.5832e-03 + j*  2.8010e-02;
+y( 606) =   9.0000e-03 + j*  2.8000e-02;
+x( 607) =   7.5177e-02 + j*  1.1677e-01;
+y( 607) =   7.5000e-02 + j*  1.1700e-01;
+x( 608) =   1.1756e-01 + j*  2.9669e-02;
+y( 608) =   1.1800e-01 + j*  3.0000e-02;
+x( 609) =  -4.1132e-02 + j*  1.4823e-01;
+y( 609) =  -4.1000e-02 + j*  1.4800e-01;
+x( 610) =   4.9732e-03 + j*  9.7609e-02;
+y( 610) =   5.0000e-03 + j*  9.8000e-02;
+x( 611) =   2.5774e-02 + j*  1.8679e-03;
+y( 611) =   2.6000e-02 + j*  2.0000e-03;
+x( 612) =  -1.1593e-01 + j*  4.4647e-02;
+y( 612) =  -1.1600e-01 + j*  4.5000e-02;
+x( 613) =  -1.9612e-02 + j*  8.3780e-02;
+y( 613) =  -2.0000e-02 + j*  8.4000e-02;
+x( 614) =   1.0075e-01 + j*  6.2555e-03;
+y( 614) =   1.0100e-01 + j*  6.0000e-03;
+x( 615) =   2.0549e-01 + j* -6.4045e-02;
+y( 615) =   2.0500e-01 + j* -6.4000e-02;
+x( 616) =   7.2934e-02 + j* -6.3301e-02;
+y( 616) =   7.3000e-02 + j* -6.3000e-02;
+x( 617) =  -1.7393e-01 + j* -1.1802e-01;
+y( 617) =  -1.7400e-01 + j* -1.1800e-01;
+x( 618) =  -2.4185e-02 + j*  2.5801e-02;
+y( 618) =  -2.4000e-02 + j*  2.6000e-02;
+x( 619) =  -4.0753e-02 + j*  1.2857e-01;
+y( 619) =  -4.1000e-02 + j*  1.2900e-01;
+x( 620) =  -4.2040e-02 + j* -5.3484e-02;
+y( 620) =  -4.2000e-02 + j* -5.3000e-02;
+x( 621) =   1.4769e-01 + j* -1.2622e-01;
+y( 621) =   1.4800e-01 + j* -1.2600e-01;
+x( 622) =  -2.9988e-02 + j* -4.9261e-02;
+y( 622) =  -3.0000e-02 + j* -4.9000e-02;
+x( 623) =  -1.4584e-02 + j* -2.0705e-02;
+y( 623) =  -1.5000e-02 + j* -2.1000e-02;
+x( 624) =   8.9153e-02 + j* -6.9072e-02;
+y( 624) =   8.9000e-02 + j* -6.9000e-02;
+x( 625) =  -1.1859e-01 + j*  1.1486e-02;
+y( 625) =  -1.1900e-01 + j*  1.1000e-02;
+x( 626) =  -9.9433e-02 + j* -4.7962e-02;
+y( 626) =  -9.9000e-02 + j* -4.8000e-02;
+x( 627) =   5.3608e-02 + j* -1.9608e-01;
+y( 627) =   5.4000e-02 + j* -1.9600e-01;
+x( 628) =   1.2399e-01 + j*  3.4583e-02;
+y( 628) =   1.2400e-01 + j*  3.5000e-02;
+x( 629) =   9.1932e-02 + j*  4.4990e-02;
+y( 629) =   9.2000e-02 + j*  4.5000e-02;
+x( 630) =  -3.6786e-02 + j* -6.5842e-02;
+y( 630) =  -3.7000e-02 + j* -6.6000e-02;
+x( 631) =  -2.1100e-02 + j* -3.8793e-03;
+y( 631) =  -2.1000e-02 + j* -4.0000e-03;
+x( 632) =   4.2497e-02 + j* -6.4901e-02;
+y( 632) =   4.2000e-02 + j* -6.5000e-02;
+x( 633) =   6.1129e-02 + j*  4.8277e-02;
+y( 633) =   6.1000e-02 + j*  4.8000e-02;
+x( 634) =   4.6306e-02 + j*  4.1734e-03;
+y( 634) =   4.6000e-02 + j*  4.0000e-03;
+x( 635) =  -6.2893e-02 + j* -4.5246e-02;
+y( 635) =  -6.3000e-02 + j* -4.5000e-02;
+x( 636) =  -1.0178e-01 + j*  1.5227e-01;
+y( 636) =  -1.0200e-01 + j*  1.5200e-01;
+x( 637) =  -3.9247e-02 + j* -1.8703e-02;
+y( 637) =  -3.9000e-02 + j* -1.9000e-02;
+x( 638) =  -5.2679e-03 + j* -1.0607e-01;
+y( 638) =  -5.0000e-03 + j* -1.0600e-01;
+x( 639) =   8.2708e-02 + j*  3.0580e-02;
+y( 639) =   8.3000e-02 + j*  3.1000e-02;
+x( 640) =   2.2566e-01 + j*  2.7662e-02;
+y( 640) =   2.2600e-01 + j*  2.8000e-02;
+x( 641) =   8.4800e-02 + j* -6.5036e-02;
+y( 641) =   8.5000e-02 + j* -6.5000e-02;
+x( 642) =   3.4028e-02 + j* -1.4246e-01;
+y( 642) =   3.4000e-02 + j* -1.4200e-01;
+x( 643) =   3.6631e-03 + j* -1.2312e-02;
+y( 643) =   4.0000e-03 + j* -1.2000e-02;
+x( 644) =   1.2597e-01 + j* -4.2973e-02;
+y( 644) =   1.2600e-01 + j* -4.3000e-02;
+x( 645) =   5.4523e-02 + j*  6.8021e-02;
+y( 645) =   5.5000e-02 + j*  6.8000e-02;
+x( 646) =  -1.9631e-02 + j*  7.7243e-02;
+y( 646) =  -2.0000e-02 + j*  7.7000e-02;
+x( 647) =   7.8707e-03 + j* -5.5621e-02;
+y( 647) =   8.0000e-03 + j* -5.6000e-02;
+x( 648) =  -3.4333e-02 + j*  4.6166e-02;
+y( 648) =  -3.4000e-02 + j*  4.6000e-02;
+x( 649) =  -3.9669e-02 + j* -1.3382e-01;
+y( 649) =  -4.0000e-02 + j* -1.3400e-01;
+x( 650) =  -5.6498e-02 + j* -1.3112e-01;
+y( 650) =  -5.6000e-02 + j* -1.3100e-01;
+x( 651) =   1.4308e-02 + j*  9.6667e-02;
+y( 651) =   1.4000e-02 + j*  9.7000e-02;
+x( 652) =   4.4877e-02 + j* -8.5871e-03;
+y( 652) =   4.5000e-02 + j* -9.0000e-03;
+x( 653) =  -1.1261e-01 + j* -1.7049e-01;
+y( 653) =  -1.1300e-01 + j* -1.7000e-01;
+x( 654) =  -6.5255e-02 + j* -2.2968e-01;
+y( 654) =  -6.5000e-02 + j* -2.3000e-01;
+x( 655) =   6.5151e-02 + j* -1.1466e-02;
+y( 655) =   6.5000e-02 + j* -1.1000e-02;
+x( 656) =   1.1351e-02 + j*  4.7573e-02;
+y( 656) =   1.1000e-02 + j*  4.8000e-02;
+x( 657) =  -9.0543e-02 + j* -5.9293e-02;
+y( 657) =  -9.1000e-02 + j* -5.9000e-02;
+x( 658) =  -1.0987e-01 + j*  2.4421e-02;
+y( 658) =  -1.1000e-01 + j*  2.4000e-02;
+x( 659) =   7.3849e-02 + j* -3.4346e-02;
+y( 659) =   7.4000e-02 + j* -3.4000e-02;
+x( 660) =   1.2433e-01 + j*  2.1545e-02;
+y( 660) =   1.2400e-01 + j*  2.2000e-02;
+x( 661) =  -3.7177e-02 + j*  7.0753e-02;
+y( 661) =  -3.7000e-02 + j*  7.1000e-02;
+x( 662) =   1.5365e-02 + j*  1.5287e-03;
+y( 662) =   1.5000e-02 + j*  2.0000e-03;
+x( 663) =   2.8038e-02 + j*  9.9403e-02;
+y( 663) =   2.8000e-02 + j*  9.9000e-02;
+x( 664) =  -6.2088e-02 + j*  6.8225e-02;
+y( 664) =  -6.2000e-02 + j*  6.8000e-02;
+x( 665) =   6.3948e-02 + j*  1.6232e-02;
+y( 665) =   6.4000e-02 + j*  1.6000e-02;
+x( 666) =   7.8164e-02 + j*  1.5602e-01;
+y( 666) =   7.8000e-02 + j*  1.5600e-01;
+x( 667) =   8.8614e-03 + j*  2.1915e-01;
+y( 667) =   9.0000e-03 + j*  2.1900e-01;
+x( 668) =   1.4659e-01 + j*  2.3882e-02;
+y( 668) =   1.4700e-01 + j*  2.4000e-02;
+x( 669) =   1.0572e-01 + j*  3.0376e-02;
+y( 669) =   1.0600e-01 + j*  3.0000e-02;
+x( 670) =  -8.0406e-02 + j*  1.4279e-01;
+y( 670) =  -8.0000e-02 + j*  1.4300e-01;
+x( 671) =  -4.8684e-02 + j* -9.9689e-02;
+y( 671) =  -4.9000e-02 + j* -1.0000e-01;
+x( 672) =  -3.6085e-02 + j* -8.2271e-02;
+y( 672) =  -3.6000e-02 + j* -8.2000e-02;
+x( 673) =  -8.8939e-02 + j*  2.1368e-02;
+y( 673) =  -8.9000e-02 + j*  2.1000e-02;
+x( 674) =  -7.0018e-02 + j* -2.9356e-02;
+y( 674) =  -7.0000e-02 + j* -2.9000e-02;
+x( 675) =  -8.6298e-02 + j*  4.8321e-02;
+y( 675) =  -8.6000e-02 + j*  4.8000e-02;
+x( 676) =  -6.5710e-02 + j* -1.5475e-02;
+y( 676) =  -6.6000e-02 + j* -1.5000e-02;
+x( 677) =  -2.4174e-02 + j*  1.8558e-03;
+y( 677) =  -2.4000e-02 + j*  2.0000e-03;
+x( 678) =  -3.0449e-02 + j* -2.3026e-02;
+y( 678) =  -3.0000e-02 + j* -2.3000e-02;
+x( 679) =  -3.1713e-02 + j*  1.9954e-02;
+y( 679) =  -3.2000e-02 + j*  2.0000e-02;
+x( 680) =  -2.0623e-03 + j*  2.1181e-01;
+y( 680) =  -2.0000e-03 + j*  2.1200e-01;
+x( 681) =   1.5825e-01 + j* -2.4289e-02;
+y( 681) =   1.5800e-01 + j* -2.4000e-02;
+x( 682) =   1.4145e-01 + j* -1.1861e-01;
+y( 682) =   1.4100e-01 + j* -1.1900e-01;
+x( 683) =  -1.4611e-01 + j*  5.7527e-02;
+y( 683) =  -1.4600e-01 + j*  5.8000e-02;
+x( 684) =  -1.5515e-01 + j*  8.3333e-02;
+y( 684) =  -1.5500e-01 + j*  8.3000e-02;
+x( 685) =  -1.5876e-03 + j* -2.9550e-02;
+y( 685) =  -2.0000e-03 + j* -3.0000e-02;
+x( 686) =   1.8425e-02 + j* -1.2930e-01;
+y( 686) =   1.8000e-02 + j* -1.2900e-01;
+x( 687) =   1.2172e-02 + j* -1.8052e-02;
+y( 687) =   1.2000e-02 + j* -1.8000e-02;
+x( 688) =  -8.3002e-03 + j* -3.7190e-02;
+y( 688) =  -8.0000e-03 + j* -3.7000e-02;
+x( 689) =   3.1250e-02 + j*  3.9528e-02;
+y( 689) =   3.1000e-02 + j*  4.0000e-02;
+x( 690) =   2.3421e-02 + j*  9.6582e-02;
+y( 690) =   2.3000e-02 + j*  9.7000e-02;
+x( 691) =   1.3582e-02 + j* -3.9205e-02;
+y( 691) =   1.4000e-02 + j* -3.9000e-02;
+x( 692) =   4.9886e-02 + j*  1.8933e-02;
+y( 692) =   5.0000e-02 + j*  1.9000e-02;
+x( 693) =  -7.2229e-02 + j* -1.4063e-01;
+y( 693) =  -7.2000e-02 + j* -1.4100e-01;
+x( 694) =  -2.2847e-02 + j* -5.0891e-02;
+y( 694) =  -2.3000e-02 + j* -5.1000e-02;
+x( 695) =   2.3754e-02 + j*  9.9174e-02;
+y( 695) =   2.4000e-02 + j*  9.9000e-02;
+x( 696) =  -1.2713e-01 + j* -1.1619e-01;
+y( 696) =  -1.2700e-01 + j* -1.1600e-01;
+x( 697) =   9.4166e-02 + j*  1.0235e-01;
+y( 697) =   9.4000e-02 + j*  1.0200e-01;
+x( 698) =   1.8293e-01 + j*  9.8214e-02;
+y( 698) =   1.8300e-01 + j*  9.8000e-02;
+x( 699) =  -3.9967e-02 + j* -1.9579e-02;
+y( 699) =  -4.0000e-02 + j* -2.0000e-02;
+x( 700) =   6.4619e-02 + j*  7.7456e-02;
+y( 700) =   6.5000e-02 + j*  7.7000e-02;
+x( 701) =   8.7534e-02 + j* -1.4656e-01;
+y( 701) =   8.8000e-02 + j* -1.4700e-01;
+x( 702) =  -3.8809e-02 + j* -5.8579e-02;
+y( 702) =  -3.9000e-02 + j* -5.9000e-02;
+x( 703) =  -5.6590e-02 + j*  1.2441e-01;
+y( 703) =  -5.7000e-02 + j*  1.2400e-01;
+x( 704) =  -7.6759e-02 + j*  1.9993e-02;
+y( 704) =  -7.7000e-02 + j*  2.0000e-02;
+x( 705) =   2.9646e-02 + j* -1.2019e-01;
+y( 705) =   3.0000e-02 + j* -1.2000e-01;
+x( 706) =   3.4028e-02 + j* -1.4246e-01;
+y( 706) =   3.4000e-02 + j* -1.4200e-01;
+x( 707) =   3.6631e-03 + j* -1.2312e-02;
+y( 707) =   4.0000e-03 + j* -1.2000e-02;
+x( 708) =   1.2597e-01 + j* -4.2973e-02;
+y( 708) =   1.2600e-01 + j* -4.3000e-02;
+x( 709) =   5.4523e-02 + j*  6.8021e-02;
+y( 709) =   5.5000e-02 + j*  6.8000e-02;
+x( 710) =  -1.9631e-02 + j*  7.7243e-02;
+y( 710) =  -2.0000e-02 + j*  7.7000e-02;
+x( 711) =   7.8707e-03 + j* -5.5621e-02;
+y( 711) =   8.0000e-03 + j* -5.6000e-02;
+x( 712) =  -3.4333e-02 + j*  4.6166e-02;
+y( 712) =  -3.4000e-02 + j*  4.6000e-02;
+x( 713) =  -3.9669e-02 + j* -1.3382e-01;
+y( 713) =  -4.0000e-02 + j* -1.3400e-01;
+x( 714) =  -5.6498e-02 + j* -1.3112e-01;
+y( 714) =  -5.6000e-02 + j* -1.3100e-01;
+x( 715) =   1.4308e-02 + j*  9.6667e-02;
+y( 715) =   1.4000e-02 + j*  9.7000e-02;
+x( 716) =   4.4877e-02 + j* -8.5871e-03;
+y( 716) =   4.5000e-02 + j* -9.0000e-03;
+x( 717) =  -1.1261e-01 + j* -1.7049e-01;
+y( 717) =  -1.1300e-01 + j* -1.7000e-01;
+x( 718) =  -6.5255e-02 + j* -2.2968e-01;
+y( 718) =  -6.5000e-02 + j* -2.3000e-01;
+x( 719) =   6.5151e-02 + j* -1.1466e-02;
+y( 719) =   6.5000e-02 + j* -1.1000e-02;
+x( 720) =   1.1351e-02 + j*  4.7573e-02;
+y( 720) =   1.1000e-02 + j*  4.8000e-02;
+x( 721) =  -2.5507e-02 + j* -2.0566e-02;
+y( 721) =  -2.6000e-02 + j* -2.1000e-02;
+x( 722) =  -1.6360e-03 + j*  4.1280e-02;
+y( 722) =  -2.0000e-03 + j*  4.1000e-02;
+x( 723) =   1.3884e-03 + j*  7.0843e-02;
+y( 723) =   1.0000e-03 + j*  7.1000e-02;
+x( 724) =  -3.7339e-02 + j* -1.1694e-01;
+y( 724) =  -3.7000e-02 + j* -1.1700e-01;
+x( 725) =  -1.0566e-01 + j* -6.2300e-02;
+y( 725) =  -1.0600e-01 + j* -6.2000e-02;
+x( 726) =   1.8149e-03 + j*  5.6809e-02;
+y( 726) =   2.0000e-03 + j*  5.7000e-02;
+x( 727) =  -8.4312e-03 + j* -1.0970e-02;
+y( 727) =  -8.0000e-03 + j* -1.1000e-02;
+x( 728) =   1.8788e-02 + j*  7.2154e-02;
+y( 728) =   1.9000e-02 + j*  7.2000e-02;
+x( 729) =   1.6232e-02 + j*  5.8731e-02;
+y( 729) =   1.6000e-02 + j*  5.9000e-02;
+x( 730) =  -6.5226e-02 + j* -7.6698e-02;
+y( 730) =  -6.5000e-02 + j* -7.7000e-02;
+x( 731) =   1.4154e-01 + j* -6.1781e-02;
+y( 731) =   1.4200e-01 + j* -6.2000e-02;
+x( 732) =   8.6928e-02 + j*  2.5459e-02;
+y( 732) =   8.7000e-02 + j*  2.5000e-02;
+x( 733) =  -2.6229e-03 + j* -1.0286e-01;
+y( 733) =  -3.0000e-03 + j* -1.0300e-01;
+x( 734) =   1.0666e-01 + j* -1.5168e-01;
+y( 734) =   1.0700e-01 + j* -1.5200e-01;
+x( 735) =  -5.4418e-02 + j*  3.6349e-02;
+y( 735) =  -5.4000e-02 + j*  3.6000e-02;
+x( 736) =  -2.9671e-02 + j* -3.0955e-03;
+y( 736) =  -3.0000e-02 + j* -3.0000e-03;
+x( 737) =   5.7689e-02 + j* -1.9764e-02;
+y( 737) =   5.8000e-02 + j* -2.0000e-02;
+x( 738) =  -2.7885e-02 + j*  6.6721e-03;
+y( 738) =  -2.8000e-02 + j*  7.0000e-03;
+x( 739) =  -2.7348e-02 + j* -9.8679e-02;
+y( 739) =  -2.7000e-02 + j* -9.9000e-02;
+x( 740) =   4.8790e-02 + j* -7.5235e-02;
+y( 740) =   4.9000e-02 + j* -7.5000e-02;
+x( 741) =   1.7445e-01 + j*  3.0843e-02;
+y( 741) =   1.7400e-01 + j*  3.1000e-02;
+x( 742) =   1.3394e-01 + j*  1.5555e-01;
+y( 742) =   1.3400e-01 + j*  1.5600e-01;
+x( 743) =   6.0438e-02 + j*  7.6652e-02;
+y( 743) =   6.0000e-02 + j*  7.7000e-02;
+x( 744) =  -1.0472e-02 + j* -2.1830e-02;
+y( 744) =  -1.0000e-02 + j* -2.2000e-02;
+x( 745) =  -8.3582e-02 + j*  4.0090e-02;
+y( 745) =  -8.4000e-02 + j*  4.0000e-02;
+x( 746) =  -7.3946e-02 + j*  1.1053e-02;
+y( 746) =  -7.4000e-02 + j*  1.1000e-02;
+x( 747) =  -1.6312e-01 + j*  5.4094e-02;
+y( 747) =  -1.6300e-01 + j*  5.4000e-02;
+x( 748) =  -5.2008e-02 + j* -8.3190e-03;
+y( 748) =  -5.2000e-02 + j* -8.0000e-03;
+x( 749) =   7.6253e-02 + j* -4.1928e-02;
+y( 749) =   7.6000e-02 + j* -4.2000e-02;
+x( 750) =   4.2521e-02 + j*  1.0094e-01;
+y( 750) =   4.3000e-02 + j*  1.0100e-01;
+x( 751) =   5.7618e-02 + j* -1.8325e-02;
+y( 751) =   5.8000e-02 + j* -1.8000e-02;
+x( 752) =   3.1114e-03 + j* -8.9911e-02;
+y( 752) =   3.0000e-03 + j* -9.0000e-02;
+x( 753) =   5.9293e-02 + j* -1.8161e-02;
+y( 753) =   5.9000e-02 + j* -1.8000e-02;
+x( 754) =   2.3073e-02 + j* -3.0936e-02;
+y( 754) =   2.3000e-02 + j* -3.1000e-02;
+x( 755) =   7.1197e-03 + j* -1.7216e-02;
+y( 755) =   7.0000e-03 + j* -1.7000e-02;
+x( 756) =   6.6082e-02 + j* -1.6897e-02;
+y( 756) =   6.6000e-02 + j* -1.7000e-02;
+x( 757) =  -1.3531e-01 + j* -9.8212e-02;
+y( 757) =  -1.3500e-01 + j* -9.8000e-02;
+x( 758) =  -5.5654e-02 + j* -8.0780e-02;
+y( 758) =  -5.6000e-02 + j* -8.1000e-02;
+x( 759) =   8.8557e-02 + j*  1.5435e-01;
+y( 759) =   8.9000e-02 + j*  1.5400e-01;
+x( 760) =   1.1951e-01 + j*  1.2234e-01;
+y( 760) =   1.2000e-01 + j*  1.2200e-01;
+x( 761) =   1.0235e-01 + j*  5.6155e-04;
+y( 761) =   1.0200e-01 + j*  1.0000e-03;
+x( 762) =  -1.4104e-01 + j*  1.0210e-01;
+y( 762) =  -1.4100e-01 + j*  1.0200e-01;
+x( 763) =   6.3104e-03 + j* -1.1404e-02;
+y( 763) =   6.0000e-03 + j* -1.1000e-02;
+x( 764) =   5.6646e-02 + j* -3.9358e-02;
+y( 764) =   5.7000e-02 + j* -3.9000e-02;
+x( 765) =  -5.9068e-02 + j*  6.5734e-02;
+y( 765) =  -5.9000e-02 + j*  6.6000e-02;
+x( 766) =   1.3189e-01 + j*  1.1110e-01;
+y( 766) =   1.3200e-01 + j*  1.1100e-01;
+x( 767) =   1.1985e-02 + j*  1.1377e-01;
+y( 767) =   1.2000e-02 + j*  1.1400e-01;
+x( 768) =   4.6864e-02 + j* -1.0600e-01;
+y( 768) =   4.7000e-02 + j* -1.0600e-01;
+x( 769) =   1.5972e-01 + j* -9.8821e-02;
+y( 769) =   1.6000e-01 + j* -9.9000e-02;
+x( 770) =  -7.6392e-02 + j*  8.4491e-02;
+y( 770) =  -7.6000e-02 + j*  8.4000e-02;
+x( 771) =  -4.8639e-02 + j*  7.3002e-02;
+y( 771) =  -4.9000e-02 + j*  7.3000e-02;
+x( 772) =   5.0732e-03 + j* -8.6139e-02;
+y( 772) =   5.0000e-03 + j* -8.6000e-02;
+x( 773) =  -5.2062e-02 + j* -1.0750e-01;
+y( 773) =  -5.2000e-02 + j* -1.0800e-01;
+x( 774) =  -7.2650e-02 + j*  1.2877e-01;
+y( 774) =  -7.3000e-02 + j*  1.2900e-01;
+x( 775) =  -1.2899e-01 + j* -3.3968e-02;
+y( 775) =  -1.2900e-01 + j* -3.4000e-02;
+x( 776) =  -1.5277e-01 + j* -1.1095e-01;
+y( 776) =  -1.5300e-01 + j* -1.1100e-01;
+x( 777) =  -1.9312e-01 + j*  9.8260e-02;
+y( 777) =  -1.9300e-01 + j*  9.8000e-02;
+x( 778) =  -1.0732e-01 + j* -6.8499e-02;
+y( 778) =  -1.0700e-01 + j* -6.8000e-02;
+x( 779) =   3.6919e-03 + j* -8.8594e-03;
+y( 779) =   4.0000e-03 + j* -9.0000e-03;
+x( 780) =  -3.9213e-02 + j*  2.4355e-02;
+y( 780) =  -3.9000e-02 + j*  2.4000e-02;
+x( 781) =  -5.4091e-02 + j* -7.9055e-02;
+y( 781) =  -5.4000e-02 + j* -7.9000e-02;
+x( 782) =   2.3725e-02 + j*  8.4162e-02;
+y( 782) =   2.4000e-02 + j*  8.4000e-02;
+x( 783) =   5.2294e-02 + j* -1.6264e-03;
+y( 783) =   5.2000e-02 + j* -2.0000e-03;
+x( 784) =   2.7793e-02 + j* -4.3976e-02;
+y( 784) =   2.8000e-02 + j* -4.4000e-02;
+x( 785) =   3.9528e-02 + j*  1.8161e-02;
+y( 785) =   4.0000e-02 + j*  1.8000e-02;
+x( 786) =  -1.6360e-03 + j*  4.1280e-02;
+y( 786) =  -2.0000e-03 + j*  4.1000e-02;
+x( 787) =   1.3884e-03 + j*  7.0843e-02;
+y( 787) =   1.0000e-03 + j*  7.1000e-02;
+x( 788) =  -3.7339e-02 + j* -1.1694e-01;
+y( 788) =  -3.7000e-02 + j* -1.1700e-01;
+x( 789) =  -1.0566e-01 + j* -6.2300e-02;
+y( 789) =  -1.0600e-01 + j* -6.2000e-02;
+x( 790) =   1.8149e-03 + j*  5.6809e-02;
+y( 790) =   2.0000e-03 + j*  5.7000e-02;
+x( 791) =  -8.4312e-03 + j* -1.0970e-02;
+y( 791) =  -8.0000e-03 + j* -1.1000e-02;
+x( 792) =   1.8788e-02 + j*  7.2154e-02;
+y( 792) =   1.9000e-02 + j*  7.2000e-02;
+x( 793) =   1.6232e-02 + j*  5.8731e-02;
+y( 793) =   1.6000e-02 + j*  5.9000e-02;
+x( 794) =  -6.5226e-02 + j* -7.6698e-02;
+y( 794) =  -6.5000e-02 + j* -7.7000e-02;
+x( 795) =   1.4154e-01 + j* -6.1781e-02;
+y( 795) =   1.4200e-01 + j* -6.2000e-02;
+x( 796) =   8.6928e-02 + j*  2.5459e-02;
+y( 796) =   8.7000e-02 + j*  2.5000e-02;
+x( 797) =  -2.6229e-03 + j* -1.0286e-01;
+y( 797) =  -3.0000e-03 + j* -1.0300e-01;
+x( 798) =   1.0666e-01 + j* -1.5168e-01;
+y( 798) =   1.0700e-01 + j* -1.5200e-01;
+x( 799) =  -5.4418e-02 + j*  3.6349e-02;
+y( 799) =  -5.4000e-02 + j*  3.6000e-02;
+x( 800) =  -2.9671e-02 + j* -3.0955e-03;
+y( 800) =  -3.0000e-02 + j* -3.0000e-03;
+x( 801) =   3.8727e-02 + j* -8.9741e-02;
+y( 801) =   3.9000e-02 + j* -9.0000e-02;
+x( 802) =   2.9089e-02 + j*  2.5255e-02;
+y( 802) =   2.9000e-02 + j*  2.5000e-02;
+x( 803) =   8.6148e-02 + j* -2.8835e-02;
+y( 803) =   8.6000e-02 + j* -2.9000e-02;
+x( 804) =   8.6794e-02 + j* -8.1514e-02;
+y( 804) =   8.7000e-02 + j* -8.2000e-02;
+x( 805) =   3.4582e-03 + j* -3.5995e-02;
+y( 805) =   3.0000e-03 + j* -3.6000e-02;
+x( 806) =  -9.6037e-02 + j* -8.8595e-02;
+y( 806) =  -9.6000e-02 + j* -8.9000e-02;
+x( 807) =  -7.2943e-02 + j* -4.5903e-02;
+y( 807) =  -7.3000e-02 + j* -4.6000e-02;
+x( 808) =   1.0549e-01 + j* -1.9664e-02;
+y( 808) =   1.0500e-01 + j* -2.0000e-02;
+x( 809) =   1.9262e-01 + j*  1.8004e-02;
+y( 809) =   1.9300e-01 + j*  1.8000e-02;
+x( 810) =  -5.3146e-02 + j* -7.3101e-02;
+y( 810) =  -5.3000e-02 + j* -7.3000e-02;
+x( 811) =  -1.1834e-01 + j* -1.4889e-01;
+y( 811) =  -1.1800e-01 + j* -1.4900e-01;
+x( 812) =   1.9189e-02 + j* -1.9093e-02;
+y( 812) =   1.9000e-02 + j* -1.9000e-02;
+x( 813) =  -4.1714e-02 + j*  2.6376e-02;
+y( 813) =  -4.2000e-02 + j*  2.6000e-02;
+x( 814) =   4.0552e-02 + j*  8.8243e-03;
+y( 814) =   4.1000e-02 + j*  9.0000e-03;
+x( 815) =   2.8454e-02 + j* -7.6476e-02;
+y( 815) =   2.8000e-02 + j* -7.6000e-02;
+x( 816) =  -3.7604e-02 + j* -6.8419e-02;
+y( 816) =  -3.8000e-02 + j* -6.8000e-02;
+x( 817) =  -1.1486e-02 + j*  9.8821e-03;
+y( 817) =  -1.1000e-02 + j*  1.0000e-02;
+x( 818) =  -1.3353e-01 + j* -6.4488e-02;
+y( 818) =  -1.3400e-01 + j* -6.4000e-02;
+x( 819) =   6.8929e-02 + j* -6.7172e-02;
+y( 819) =   6.9000e-02 + j* -6.7000e-02;
+x( 820) =   5.7036e-02 + j*  6.3002e-03;
+y( 820) =   5.7000e-02 + j*  6.0000e-03;
+x( 821) =  -1.3436e-01 + j*  9.8011e-02;
+y( 821) =  -1.3400e-01 + j*  9.8000e-02;
+x( 822) =   1.5248e-01 + j*  3.6076e-02;
+y( 822) =   1.5200e-01 + j*  3.6000e-02;
+x( 823) =   4.1259e-02 + j* -8.4543e-02;
+y( 823) =   4.1000e-02 + j* -8.5000e-02;
+x( 824) =  -9.9111e-02 + j* -4.8583e-02;
+y( 824) =  -9.9000e-02 + j* -4.9000e-02;
+x( 825) =   8.9004e-02 + j* -9.9459e-02;
+y( 825) =   8.9000e-02 + j* -9.9000e-02;
+x( 826) =  -4.5987e-02 + j*  1.8183e-02;
+y( 826) =  -4.6000e-02 + j*  1.8000e-02;
+x( 827) =  -1.1234e-01 + j*  1.3548e-01;
+y( 827) =  -1.1200e-01 + j*  1.3500e-01;
+x( 828) =  -6.3574e-02 + j*  1.7851e-02;
+y( 828) =  -6.4000e-02 + j*  1.8000e-02;
+x( 829) =  -2.2253e-02 + j*  5.3008e-02;
+y( 829) =  -2.2000e-02 + j*  5.3000e-02;
+x( 830) =   4.1050e-02 + j*  7.6549e-02;
+y( 830) =   4.1000e-02 + j*  7.7000e-02;
+x( 831) =  -2.1167e-02 + j*  1.4464e-01;
+y( 831) =  -2.1000e-02 + j*  1.4500e-01;
+x( 832) =   6.6533e-03 + j*  1.7878e-01;
+y( 832) =   7.0000e-03 + j*  1.7900e-01;
+x( 833) =   5.9293e-02 + j*  4.1132e-02;
+y( 833) =   5.9000e-02 + j*  4.1000e-02;
+x( 834) =   2.2553e-02 + j*  6.4459e-02;
+y( 834) =   2.3000e-02 + j*  6.4000e-02;
+x( 835) =   6.1646e-02 + j*  2.1748e-02;
+y( 835) =   6.2000e-02 + j*  2.2000e-02;
+x( 836) =   1.1048e-01 + j* -8.0678e-02;
+y( 836) =   1.1000e-01 + j* -8.1000e-02;
+x( 837) =  -1.6029e-02 + j* -5.3647e-02;
+y( 837) =  -1.6000e-02 + j* -5.4000e-02;
+x( 838) =  -1.3870e-02 + j* -1.7477e-02;
+y( 838) =  -1.4000e-02 + j* -1.7000e-02;
+x( 839) =   1.7128e-01 + j*  8.0766e-03;
+y( 839) =   1.7100e-01 + j*  8.0000e-03;
+x( 840) =   7.0166e-02 + j* -2.6787e-02;
+y( 840) =   7.0000e-02 + j* -2.7000e-02;
+x( 841) =  -1.4743e-02 + j*  1.7605e-03;
+y( 841) =  -1.5000e-02 + j*  2.0000e-03;
+x( 842) =  -1.2426e-02 + j*  5.2907e-02;
+y( 842) =  -1.2000e-02 + j*  5.3000e-02;
+x( 843) =  -1.2506e-01 + j*  8.7197e-03;
+y( 843) =  -1.2500e-01 + j*  9.0000e-03;
+x( 844) =  -3.9783e-02 + j*  1.2383e-02;
+y( 844) =  -4.0000e-02 + j*  1.2000e-02;
+x( 845) =   3.5925e-02 + j*  1.1437e-01;
+y( 845) =   3.6000e-02 + j*  1.1400e-01;
+x( 846) =   7.0169e-03 + j*  8.9863e-02;
+y( 846) =   7.0000e-03 + j*  9.0000e-02;
+x( 847) =  -1.5808e-02 + j* -8.2249e-02;
+y( 847) =  -1.6000e-02 + j* -8.2000e-02;
+x( 848) =  -8.4614e-03 + j* -1.2934e-02;
+y( 848) =  -8.0000e-03 + j* -1.3000e-02;
+x( 849) =   9.0543e-02 + j*  2.9646e-02;
+y( 849) =   9.1000e-02 + j*  3.0000e-02;
+x( 850) =   7.2321e-02 + j* -6.8303e-02;
+y( 850) =   7.2000e-02 + j* -6.8000e-02;
+x( 851) =   5.1207e-02 + j*  6.2681e-02;
+y( 851) =   5.1000e-02 + j*  6.3000e-02;
+x( 852) =  -4.2373e-03 + j*  4.8636e-02;
+y( 852) =  -4.0000e-03 + j*  4.9000e-02;
+x( 853) =  -1.2976e-01 + j* -4.7898e-02;
+y( 853) =  -1.3000e-01 + j* -4.8000e-02;
+x( 854) =  -1.2092e-01 + j*  6.1428e-02;
+y( 854) =  -1.2100e-01 + j*  6.1000e-02;
+x( 855) =  -9.5269e-02 + j*  7.8046e-02;
+y( 855) =  -9.5000e-02 + j*  7.8000e-02;
+x( 856) =   1.0669e-02 + j*  4.5651e-03;
+y( 856) =   1.1000e-02 + j*  5.0000e-03;
+x( 857) =   4.9346e-02 + j*  6.3735e-04;
+y( 857) =   4.9000e-02 + j*  1.0000e-03;
+x( 858) =  -1.3833e-02 + j* -1.0812e-02;
+y( 858) =  -1.4000e-02 + j* -1.1000e-02;
+x( 859) =   8.7565e-03 + j* -6.2795e-02;
+y( 859) =   9.0000e-03 + j* -6.3000e-02;
+x( 860) =  -3.0951e-02 + j*  4.0213e-02;
+y( 860) =  -3.1000e-02 + j*  4.0000e-02;
+x( 861) =  -1.1487e-02 + j*  3.8868e-03;
+y( 861) =  -1.1000e-02 + j*  4.0000e-03;
+x( 862) =  -3.3423e-02 + j* -1.1077e-01;
+y( 862) =  -3.3000e-02 + j* -1.1100e-01;
+x( 863) =  -1.1486e-01 + j*  1.3746e-01;
+y( 863) =  -1.1500e-01 + j*  1.3700e-01;
+x( 864) =  -2.4645e-02 + j*  4.8942e-02;
+y( 864) =  -2.5000e-02 + j*  4.9000e-02;
+x( 865) =   1.9764e-02 + j* -1.5972e-01;
+y( 865) =   2.0000e-02 + j* -1.6000e-01;
+x( 866) =   2.9089e-02 + j*  2.5255e-02;
+y( 866) =   2.9000e-02 + j*  2.5000e-02;
+x( 867) =   8.6148e-02 + j* -2.8835e-02;
+y( 867) =   8.6000e-02 + j* -2.9000e-02;
+x( 868) =   8.6794e-02 + j* -8.1514e-02;
+y( 868) =   8.7000e-02 + j* -8.2000e-02;
+x( 869) =   3.4582e-03 + j* -3.5995e-02;
+y( 869) =   3.0000e-03 + j* -3.6000e-02;
+x( 870) =  -9.6037e-02 + j* -8.8595e-02;
+y( 870) =  -9.6000e-02 + j* -8.9000e-02;
+x( 871) =  -7.2943e-02 + j* -4.5903e-02;
+y( 871) =  -7.3000e-02 + j* -4.6000e-02;
+x( 872) =   1.0549e-01 + j* -1.9664e-02;
+y( 872) =   1.0500e-01 + j* -2.0000e-02;
+x( 873) =   1.9262e-01 + j*  1.8004e-02;
+y( 873) =   1.9300e-01 + j*  1.8000e-02;
+x( 874) =  -5.3146e-02 + j* -7.3101e-02;
+y( 874) =  -5.3000e-02 + j* -7.3000e-02;
+x( 875) =  -1.1834e-01 + j* -1.4889e-01;
+y( 875) =  -1.1800e-01 + j* -1.4900e-01;
+x( 876) =   1.9189e-02 + j* -1.9093e-02;
+y( 876) =   1.9000e-02 + j* -1.9000e-02;
+x( 877) =  -4.1714e-02 + j*  2.6376e-02;
+y( 877) =  -4.2000e-02 + j*  2.6000e-02;
+x( 878) =   4.0552e-02 + j*  8.8243e-03;
+y( 878) =   4.1000e-02 + j*  9.0000e-03;
+x( 879) =   2.8454e-02 + j* -7.6476e-02;
+y( 879) =   2.8000e-02 + j* -7.6000e-02;
+x( 880) =  -3.7604e-02 + j* -6.8419e-02;
+y( 880) =  -3.8000e-02 + j* -6.8000e-02;
+x( 881) =  -5.7429e-03 + j*  4.9411e-03;
+y( 881) =  -6.0000e-03 + j*  5.0000e-03;
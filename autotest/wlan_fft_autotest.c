@@ -0,0 +1,119 @@
+// Test transform backends against a direct DFT, both out of place and in
+// place, and check that objects of the same size share plans correctly
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "liquid-wlan.internal.h"
+
+// run test with a specific backend, size, and direction
+int wlan_fft_runtest(int          _backend,
+                     unsigned int _n,
+                     int          _dir);
+
+int main() {
+    int backends[3] = {LIQUID_WLAN_FFT_BUILTIN, LIQUID_WLAN_FFT_LIQUID, LIQUID_WLAN_FFT_FFTW};
+    unsigned int i;
+    for (i=0; i<3; i++) {
+        // FFTW is optional
+        if (backends[i] == LIQUID_WLAN_FFT_FFTW &&
+            liquid_wlan_fft_set_backend(LIQUID_WLAN_FFT_FFTW) != 0)
+        {
+            printf("FFTW backend not available\n");
+            continue;
+        }
+
+        wlan_fft_runtest(backends[i],  64, WLAN_FFT_FORWARD);
+        wlan_fft_runtest(backends[i],  64, WLAN_FFT_BACKWARD);
+        wlan_fft_runtest(backends[i], 128, WLAN_FFT_FORWARD);
+        wlan_fft_runtest(backends[i], 128, WLAN_FFT_BACKWARD);
+    }
+
+    // invalid backend is rejected
+    if (liquid_wlan_fft_set_backend(-1) == 0) {
+        fprintf(stderr,"fail: %s, invalid backend accepted\n", __FILE__);
+        exit(1);
+    }
+
+    return 0;
+}
+
+int wlan_fft_runtest(int          _backend,
+                     unsigned int _n,
+                     int          _dir)
+{
+    if (liquid_wlan_fft_set_backend(_backend) != 0) {
+        fprintf(stderr,"fail: %s, could not set backend %d\n", __FILE__, _backend);
+        exit(1);
+    }
+
+    // buffers for two out-of-place objects and one in-place object
+    float complex x0[_n], y0[_n];
+    float complex x1[_n], y1[_n];
+    float complex z[_n];
+    float complex y_ref[_n];
+
+    wlan_fft q0 = wlan_fft_create(_n, x0, y0, _dir);
+    wlan_fft q1 = wlan_fft_create(_n, x1, y1, _dir);
+    wlan_fft q2 = wlan_fft_create(_n, z,  z,  _dir);
+    if (wlan_fft_get_backend(q0) != _backend) {
+        fprintf(stderr,"fail: %s, object using backend %d, expected %d\n",
+                __FILE__, wlan_fft_get_backend(q0), _backend);
+        exit(1);
+    }
+
+    // pseudo-random input, different for each object
+    unsigned int i;
+    unsigned int k;
+    for (i=0; i<_n; i++) {
+        x0[i] = cosf(0.7f*i*i + 0.1f) + _Complex_I*sinf(1.3f*i + 0.5f*i*i);
+        x1[i] = conjf(x0[i]) * (1.0f + 0.01f*i);
+        z[i]  = x0[i];
+    }
+
+    // direct transform of first input
+    float sgn = _dir == WLAN_FFT_FORWARD ? -1.0f : 1.0f;
+    for (k=0; k<_n; k++) {
+        double complex v = 0;
+        for (i=0; i<_n; i++) {
+            double theta = 2*M_PI*(double)((i*k) % _n) / (double)_n;
+            v += x0[i] * (cos(theta) + _Complex_I*sgn*sin(theta));
+        }
+        y_ref[k] = v;
+    }
+
+    wlan_fft_execute(q0);
+    wlan_fft_execute(q1);
+    wlan_fft_execute(q2);
+
+    // compare; the second object must not disturb the first and its
+    // input must be preserved
+    float rmse_0 = 0.0f;
+    float rmse_2 = 0.0f;
+    float norm   = 0.0f;
+    unsigned int num_errors = 0;
+    for (i=0; i<_n; i++) {
+        rmse_0 += crealf((y0[i]-y_ref[i])*conjf(y0[i]-y_ref[i]));
+        rmse_2 += crealf((z[i] -y_ref[i])*conjf(z[i] -y_ref[i]));
+        norm   += crealf(y_ref[i]*conjf(y_ref[i]));
+        num_errors += cabsf(x1[i] - conjf(x0[i])*(1.0f + 0.01f*i)) > 1e-6f;
+    }
+    rmse_0 = sqrtf(rmse_0 / norm);
+    rmse_2 = sqrtf(rmse_2 / norm);
+
+    wlan_fft_destroy(q0);
+    wlan_fft_destroy(q1);
+    wlan_fft_destroy(q2);
+
+    printf("backend %d, n = %3u, dir = %d: relative error %.2e (out of place), %.2e (in place)\n",
+            _backend, _n, _dir, rmse_0, rmse_2);
+    if (rmse_0 > 1e-4f || rmse_2 > 1e-4f || num_errors > 0) {
+        fprintf(stderr,"fail: %s, transform mismatch (backend = %d, n = %u, dir = %d)\n",
+                __FILE__, _backend, _n, _dir);
+        exit(1);
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Test output stage of wlan frame generator (resampling and frequency
+// shift) against ideal band-limited interpolation of the baseband frame
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific output rate and frequency shift
+//  _rate       :   output rate relative to 20 M samples/s
+//  _fshift     :   frequency shift (cycles/output sample)
+//  _tol        :   maximum relative error (dB)
+int wlanframegen_output_runtest(float _rate,
+                                float _fshift,
+                                float _tol);
+
+int main() {
+    wlanframegen_output_runtest(1.0f,    0.1f,  -100.0f);  // shift only
+    wlanframegen_output_runtest(2.0f,    0.0f,   -40.0f);
+    wlanframegen_output_runtest(1.25f,   0.0f,   -40.0f);  // 25 M samples/s
+    wlanframegen_output_runtest(1.536f, -0.2f,   -40.0f);  // 30.72 M samples/s
+    wlanframegen_output_runtest(3.7f,    0.33f,  -40.0f);
+    return 0;
+}
+
+int wlanframegen_output_runtest(float _rate,
+                                float _fshift,
+                                float _tol)
+{
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = WLANFRAME_RATE_36;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // render baseband and output frames
+    wlanframegen fg  = wlanframegen_create();
+    wlanframegen fgo = wlanframegen_create_output(_rate, _fshift);
+    wlanframegen_assemble(fg,  annexg_G1, txvector);
+    wlanframegen_assemble(fgo, annexg_G1, txvector);
+    unsigned int nx = wlanframegen_get_num_samples(fg);
+    unsigned int ny = wlanframegen_get_num_samples(fgo);
+    unsigned int ny_txvector = wlanframegen_get_num_samples_txvector(fgo, txvector);
+    float complex * x = (float complex*) malloc(nx*sizeof(float complex));
+    float complex * y = (float complex*) malloc(ny*sizeof(float complex));
+    wlanframegen_write_frame(fg, x, nx);
+    unsigned int num_written = wlanframegen_write_frame(fgo, y, ny);
+    wlanframegen_destroy(fg);
+    wlanframegen_destroy(fgo);
+
+    // output sample k lies at input time k/rate - d, where d is the
+    // output stage's lead-in (zero without resampling)
+    float d = _rate == 1.0f ? 0.0f : 0.5f*((float)ny/_rate - (float)nx) + 0.5f;
+    d = roundf(d);
+
+    // compare against reference: long Kaiser-windowed sinc interpolator
+    float e2 = 0.0f;
+    float p2 = 0.0f;
+    unsigned int k;
+    int n;
+    for (k=0; k<ny; k++) {
+        double t = (double)k/(double)_rate - d;
+        double complex v = 0;
+        for (n=(int)floor(t)-63; n<=(int)floor(t)+64; n++) {
+            if (n < 0 || n >= (int)nx) continue;
+            double u = t - n;
+            double r = u / 64.0;
+            if (fabs(r) >= 1.0) continue;
+            double sinc = fabs(u) < 1e-9 ? 1.0 : sin(M_PI*u)/(M_PI*u);
+            v += x[n] * sinc * cos(0.5*M_PI*r) * cos(0.5*M_PI*r);
+        }
+        v *= cexp(_Complex_I*2*M_PI*_fshift*(double)k);
+        e2 += cabsf(y[k] - (float complex)v) * cabsf(y[k] - (float complex)v);
+        p2 += cabs(v)*cabs(v);
+    }
+    float err = 10*log10f(e2/p2);
+
+    free(x);
+    free(y);
+
+    printf("rate %6.3f, shift %5.2f: %6u -> %6u samples, error %7.2f dB\n",
+            _rate, _fshift, nx, ny, err);
+    if (num_written != ny || ny < (unsigned int)(nx*_rate) || err > _tol ||
+        ny != ny_txvector) {
+        fprintf(stderr,"fail: %s, output stage mismatch (rate = %f, shift = %f)\n",
+                __FILE__, _rate, _fshift);
+        exit(1);
+    }
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Test whole-frame rendering of wlan frame generator against symbol-by-
+// symbol generation, and cached SIGNAL symbols against freshly rendered
+// ones
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific rate and payload length
+int wlanframegen_write_frame_runtest(unsigned int _rate,
+                                     unsigned int _length);
+
+// cycle through more (rate, length) pairs than the SIGNAL cache holds,
+// comparing every frame against one from a new generator
+int wlanframegen_signal_cache_runtest();
+
+int main() {
+    // run tests
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_6,     1);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_6,   100);
+    //wlanframegen_write_frame_runtest(WLANFRAME_RATE_9,   100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_12,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_18,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_24,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_36,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_48,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_54,  100);
+    wlanframegen_write_frame_runtest(WLANFRAME_RATE_54, 1500);
+
+    wlanframegen_signal_cache_runtest();
+
+    return 0;
+}
+
+int wlanframegen_write_frame_runtest(unsigned int _rate,
+                                     unsigned int _length)
+{
+    // data options
+    unsigned char msg_org[_length];
+    unsigned int i;
+    for (i=0; i<_length; i++)
+        msg_org[i] = annexg_G1[i % 100] ^ (i / 100);
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = _length;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // create frame generator and assemble frame
+    wlanframegen fg = wlanframegen_create();
+    wlanframegen_assemble(fg, msg_org, txvector);
+
+    // allocate buffers
+    unsigned int num_samples = wlanframegen_get_num_samples(fg);
+    if (num_samples != 80*wlanframegen_getframelen(fg) ||
+        num_samples != wlanframegen_get_num_samples_txvector(fg, txvector)) {
+        fprintf(stderr,"fail: %s, number of samples mismatch (rate = %u)\n", __FILE__, _rate);
+        exit(1);
+    }
+    float complex * frame_sym = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * frame_all = (float complex*) malloc(num_samples*sizeof(float complex));
+
+    // generate frame one symbol at a time
+    unsigned int n = 0;
+    int last_frame = 0;
+    while (!last_frame) {
+        if (n + 80 > num_samples) {
+            fprintf(stderr,"fail: %s, frame exceeds %u samples (rate = %u)\n", __FILE__, num_samples, _rate);
+            exit(1);
+        }
+        last_frame = wlanframegen_writesymbol(fg, &frame_sym[n]);
+        n += 80;
+    }
+
+    // generate entire frame (twice, to check that the frame restarts)
+    unsigned int num_written = 0;
+    unsigned int j;
+    for (j=0; j<2; j++) {
+        memset(frame_all, 0x00, num_samples*sizeof(float complex));
+        num_written = wlanframegen_write_frame(fg, frame_all, num_samples);
+    }
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+
+    // run test
+    unsigned int num_errors = 0;
+    for (i=0; i<num_samples; i++)
+        num_errors += cabsf(frame_all[i] - frame_sym[i]) > 1e-6f;
+
+    free(frame_sym);
+    free(frame_all);
+
+    printf("rate %u, length %4u: %6u samples, %u errors\n", _rate, _length, num_samples, num_errors);
+    if (n != num_samples || num_written != num_samples || num_errors > 0) {
+        fprintf(stderr,"fail: %s, frame mismatch (rate = %u, length = %u)\n", __FILE__, _rate, _length);
+        exit(1);
+    }
+
+    return 0;
+}
+
+int wlanframegen_signal_cache_runtest()
+{
+    unsigned int rates[7] = {WLANFRAME_RATE_6,  WLANFRAME_RATE_12, WLANFRAME_RATE_18,
+                             WLANFRAME_RATE_24, WLANFRAME_RATE_36, WLANFRAME_RATE_48,
+                             WLANFRAME_RATE_54};
+    struct wlan_txvector_s txvector;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // generator that is re-used throughout
+    wlanframegen fg = wlanframegen_create();
+
+    float complex frame_test[1200]; // longest frame: 6 M bits/s, 12 bytes
+    float complex frame_ref [1200];
+    unsigned int num_errors = 0;
+    unsigned int i;
+    unsigned int j;
+    for (i=0; i<3*12; i++) {
+        // 12 distinct keys, each visited three times
+        txvector.DATARATE = rates[(i % 12) % 7];
+        txvector.LENGTH   = 1 + (i % 12);
+
+        // render with re-used generator
+        wlanframegen_assemble(fg, annexg_G1, txvector);
+        unsigned int n = wlanframegen_write_frame(fg, frame_test, 1200);
+
+        // render with new generator (empty cache)
+        wlanframegen fg_ref = wlanframegen_create();
+        wlanframegen_assemble(fg_ref, annexg_G1, txvector);
+        wlanframegen_write_frame(fg_ref, frame_ref, 1200);
+        wlanframegen_destroy(fg_ref);
+
+        for (j=0; j<n; j++)
+            num_errors += cabsf(frame_test[j] - frame_ref[j]) > 1e-6f;
+    }
+
+    wlanframegen_destroy(fg);
+
+    printf("signal cache: %u errors\n", num_errors);
+    if (num_errors > 0) {
+        fprintf(stderr,"fail: %s, cached SIGNAL mismatch\n", __FILE__);
+        exit(1);
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Test maximum payload length and symbol capture configuration of the
+// wlan frame synchronizer
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific configuration
+//  _length         :   payload length [bytes]
+//  _max_length     :   maximum accepted payload length [bytes]
+//  _num_symbols    :   symbol capture depth
+//  _num_threads    :   number of decoder threads (0: inline)
+int wlanframesync_buffers_runtest(unsigned int _length,
+                                  unsigned int _max_length,
+                                  unsigned int _num_symbols,
+                                  unsigned int _num_threads);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+int main() {
+    // symbol capture disabled, partial, and full frame (100 bytes at
+    // 6 M bits/s is 34 symbols, or 1632 data subcarrier symbols)
+    wlanframesync_buffers_runtest(100, 4095,      0, 0);
+    wlanframesync_buffers_runtest(100, 4095,    100, 0);
+    wlanframesync_buffers_runtest(100, 4095, 100000, 0);
+    wlanframesync_buffers_runtest(100, 4095,    100, 2);
+
+    // payload at and beyond maximum length
+    wlanframesync_buffers_runtest(100,  100,      0, 0);
+    wlanframesync_buffers_runtest(100,   50,      0, 0);
+    wlanframesync_buffers_runtest(100,   50,      0, 2);
+
+    return 0;
+}
+
+// structure for tracking decoded frames (callbacks may run concurrently)
+struct wlanframesync_buffers_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int num_framesyms;     // expected number of frame symbols
+    int          header_valid;      // expected header validity
+    unsigned int num_frames;
+    unsigned int valid;
+    pthread_mutex_t mutex;
+};
+
+int wlanframesync_buffers_runtest(unsigned int _length,
+                                  unsigned int _max_length,
+                                  unsigned int _num_symbols,
+                                  unsigned int _num_threads)
+{
+    unsigned int num_frames = 2;    // number of frames to transmit
+
+    // data options
+    unsigned char * msg_org = annexg_G1;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = _length;
+    txvector.DATARATE    = WLANFRAME_RATE_6;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator
+    wlanframegen fg = wlanframegen_create();
+    wlanframegen_assemble(fg, msg_org, txvector);
+    unsigned int num_data_symbols = wlanframegen_getframelen(fg) - 6;
+
+    // initialize test data object
+    struct wlanframesync_buffers_autotest_s testdata;
+    testdata.msg_org       = msg_org;
+    testdata.length        = _length;
+    testdata.header_valid  = _length <= _max_length;
+    testdata.num_framesyms = !testdata.header_valid ? 0 :
+        (_num_symbols < 48*num_data_symbols ? _num_symbols : 48*num_data_symbols);
+    testdata.num_frames    = 0;
+    testdata.valid         = 1;
+    pthread_mutex_init(&testdata.mutex, NULL);
+
+    // create and configure frame synchronizer
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    if (_num_threads > 0)
+        wlanframesync_set_decoder_threads(fs, _num_threads, num_frames);
+    if (wlanframesync_set_max_length(fs, _max_length) != 0 ||
+        wlanframesync_set_symbol_capture(fs, _num_symbols) != 0)
+    {
+        fprintf(stderr,"fail: %s, could not configure synchronizer\n", __FILE__);
+        exit(1);
+    }
+
+    unsigned int i;
+    unsigned int j;
+    for (i=0; i<num_frames; i++) {
+        // generate/synchronize frame
+        wlanframegen_assemble(fg, msg_org, txvector);
+        int last_frame = 0;
+        while (!last_frame) {
+            last_frame = wlanframegen_writesymbol(fg, buffer);
+            wlanframesync_execute(fs, buffer, 80);
+        }
+
+        // inter-frame gap
+        memset(buffer, 0x00, sizeof(buffer));
+        for (j=0; j<4; j++)
+            wlanframesync_execute(fs, buffer, 80);
+    }
+
+    // wait for all frames to be delivered
+    wlanframesync_flush(fs);
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+    pthread_mutex_destroy(&testdata.mutex);
+
+    // check results
+    if (testdata.num_frames != num_frames) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: received %u / %u frames\n", testdata.num_frames, num_frames);
+        testdata.valid = 0;
+    }
+
+    if (!testdata.valid) {
+        fprintf(stderr,"fail: %s, synchronization failure (length = %u, max = %u, symbols = %u, threads = %u)\n",
+                __FILE__, _length, _max_length, _num_symbols, _num_threads);
+        exit(1);
+    }
+
+    return 0;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_buffers_autotest_s * testdata = (struct wlanframesync_buffers_autotest_s*) _userdata;
+
+    // count errors
+    unsigned int num_bit_errors = _header_valid ?
+        count_bit_errors_array(_payload, testdata->msg_org, _rxvector.LENGTH) : 0;
+
+    // captured symbols should lie on the BPSK constellation
+    unsigned int i;
+    unsigned int num_sym_errors = 0;
+    for (i=0; i<_stats.num_framesyms; i++)
+        num_sym_errors += cabsf(_stats.framesyms[i]) < 0.9f || cabsf(_stats.framesyms[i]) > 1.1f;
+
+    pthread_mutex_lock(&testdata->mutex);
+    if (_header_valid != testdata->header_valid) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: unexpected header validity (%d)\n", _header_valid);
+        testdata->valid = 0;
+    } else if (num_bit_errors != 0) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: errors detected!\n");
+        testdata->valid = 0;
+    } else if (_header_valid && testdata->length != _rxvector.LENGTH) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: length mismatch\n");
+        testdata->valid = 0;
+    } else if (_stats.num_framesyms != testdata->num_framesyms) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: captured %u symbols, expected %u\n",
+                _stats.num_framesyms, testdata->num_framesyms);
+        testdata->valid = 0;
+    } else if (num_sym_errors != 0) {
+        fprintf(stderr,"wlanframesync_buffers_autotest: captured symbols off constellation\n");
+        testdata->valid = 0;
+    } else {
+        // increment number of frames received
+        testdata->num_frames++;
+    }
+    pthread_mutex_unlock(&testdata->mutex);
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Test channel estimators over fixed multipath channels: every method
+// decodes a mild two-tap channel; zero-forcing and DFT estimation decode
+// a long channel and one with an echo ahead of the strongest path; and
+// truncating the DFT estimate to fewer taps than the channel loses the
+// frame. The two-tap and early-echo DFT cases depend on its NULL
+// subcarrier interpolation and precursor taps, respectively. Also checks
+// that invalid methods and tap counts are rejected.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+// run test with a specific rate, estimator and channel, returning the
+// number of frames decoded without errors
+unsigned int wlanframesync_chanest_runtest(unsigned int          _rate,
+                                           int                   _method,
+                                           unsigned int          _ntaps,
+                                           const float complex * _h,
+                                           unsigned int          _h_len);
+
+// run test and check number of frames decoded
+void wlanframesync_chanest_check(const char *          _name,
+                                 unsigned int          _rate,
+                                 int                   _method,
+                                 unsigned int          _ntaps,
+                                 const float complex * _h,
+                                 unsigned int          _h_len,
+                                 unsigned int          _num_expected);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+// structure for tracking decoded frames
+struct wlanframesync_chanest_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int num_frames;
+};
+
+#define CHANEST_NUM_FRAMES  (3)     // number of frames per test
+#define CHANEST_LENGTH      (500)   // payload length [bytes]
+
+int main() {
+    // validate estimator options
+    wlanframesync fs = wlanframesync_create(callback, NULL);
+    if (wlanframesync_set_chanest(fs, -1, 16) == 0 ||
+        wlanframesync_set_chanest(fs,  3, 16) == 0 ||
+        wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_DFT,  0) == 0 ||
+        wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_DFT, 61) == 0)
+    {
+        fprintf(stderr,"fail: %s, invalid estimator options accepted\n", __FILE__);
+        exit(1);
+    }
+    if (wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_POLY, 0) != 0 ||
+        wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_LTS,  0) != 0 ||
+        wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_DFT,  1) != 0 ||
+        wlanframesync_set_chanest(fs, WLANFRAMESYNC_CHANEST_DFT, 60) != 0)
+    {
+        fprintf(stderr,"fail: %s, valid estimator options rejected\n", __FILE__);
+        exit(1);
+    }
+    wlanframesync_destroy(fs);
+
+    // mild channel: direct path and a single echo; at 54 M bits/s, the
+    // DFT estimate relies on interpolating across NULL subcarriers
+    // to limit leakage when truncating
+    float complex h0[2] = {1.0f, 0.4f*_Complex_I};
+    wlanframesync_chanest_check("two-tap", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_POLY,  0, h0, 2, CHANEST_NUM_FRAMES);
+    wlanframesync_chanest_check("two-tap", WLANFRAME_RATE_54, WLANFRAMESYNC_CHANEST_LTS,   0, h0, 2, CHANEST_NUM_FRAMES);
+    wlanframesync_chanest_check("two-tap", WLANFRAME_RATE_54, WLANFRAMESYNC_CHANEST_DFT,  16, h0, 2, CHANEST_NUM_FRAMES);
+
+    // long channel with a weak tap ahead of the strongest one
+    float complex h1[9] = { 0.25f,
+                            1.00f,
+                            0.60f,
+                           -0.45f*_Complex_I,
+                            0.30f,
+                            0.20f*_Complex_I,
+                           -0.15f,
+                            0.10f,
+                            0.05f*_Complex_I};
+    wlanframesync_chanest_check("9-tap", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_LTS,  0, h1, 9, CHANEST_NUM_FRAMES);
+    wlanframesync_chanest_check("9-tap", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_DFT, 16, h1, 9, CHANEST_NUM_FRAMES);
+
+    // truncating the estimate well below the channel length loses frames
+    wlanframesync_chanest_check("9-tap", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_DFT,  1, h1, 9, 0);
+
+    // echo arriving three samples ahead of the strongest path: timing
+    // locks onto the strongest path, so the DFT estimate must keep the
+    // taps preceding the origin
+    float complex h2[5] = {0.5f, 0.0f, 0.0f, 1.0f, 0.3f*_Complex_I};
+    wlanframesync_chanest_check("pre-echo", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_LTS,  0, h2, 5, CHANEST_NUM_FRAMES);
+    wlanframesync_chanest_check("pre-echo", WLANFRAME_RATE_36, WLANFRAMESYNC_CHANEST_DFT,  8, h2, 5, CHANEST_NUM_FRAMES);
+
+    return 0;
+}
+
+void wlanframesync_chanest_check(const char *          _name,
+                                 unsigned int          _rate,
+                                 int                   _method,
+                                 unsigned int          _ntaps,
+                                 const float complex * _h,
+                                 unsigned int          _h_len,
+                                 unsigned int          _num_expected)
+{
+    const char * methods[3] = {"poly", "lts", "dft"};
+    unsigned int num_decoded = wlanframesync_chanest_runtest(_rate, _method, _ntaps, _h, _h_len);
+    printf("%-8s %-4s (ntaps = %2u) : %u / %u frames decoded\n",
+            _name, methods[_method], _ntaps, num_decoded, CHANEST_NUM_FRAMES);
+    if (num_decoded != _num_expected) {
+        fprintf(stderr,"fail: %s, %s channel, %s estimator decoded %u frames (expected %u)\n",
+                __FILE__, _name, methods[_method], num_decoded, _num_expected);
+        exit(1);
+    }
+}
+
+unsigned int wlanframesync_chanest_runtest(unsigned int          _rate,
+                                           int                   _method,
+                                           unsigned int          _ntaps,
+                                           const float complex * _h,
+                                           unsigned int          _h_len)
+{
+    // data options (fixed seed: identical payloads for each test)
+    unsigned char msg_org[CHANEST_LENGTH];
+    unsigned int i;
+    srand(1);
+    for (i=0; i<CHANEST_LENGTH; i++)
+        msg_org[i] = rand() & 0xff;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = CHANEST_LENGTH;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // channel normalized to unit energy
+    float h_energy = 0.0f;
+    for (i=0; i<_h_len; i++)
+        h_energy += crealf(_h[i]*conjf(_h[i]));
+    float complex h_buf[_h_len];
+    memset(h_buf, 0x00, sizeof(h_buf));
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator and synchronizer
+    struct wlanframesync_chanest_autotest_s testdata;
+    testdata.msg_org    = msg_org;
+    testdata.length     = CHANEST_LENGTH;
+    testdata.num_frames = 0;
+    wlanframegen fg = wlanframegen_create();
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    if (wlanframesync_set_chanest(fs, _method, _ntaps) != 0) {
+        fprintf(stderr,"fail: %s, could not set channel estimator\n", __FILE__);
+        exit(1);
+    }
+
+    unsigned int n;
+    unsigned int j;
+    unsigned int k;
+    for (n=0; n<CHANEST_NUM_FRAMES; n++) {
+        // generate frame and push through channel; the gap keeps frames
+        // from overlapping in the channel
+        wlanframegen_assemble(fg, msg_org, txvector);
+        int last_frame = 0;
+        unsigned int num_gap = 0;
+        while (num_gap < 4) {
+            if (!last_frame) {
+                last_frame = wlanframegen_writesymbol(fg, buffer);
+            } else {
+                memset(buffer, 0x00, sizeof(buffer));
+                num_gap++;
+            }
+            for (j=0; j<80; j++) {
+                for (k=_h_len-1; k>0; k--)
+                    h_buf[k] = h_buf[k-1];
+                h_buf[0] = buffer[j];
+
+                float complex y = 0.0f;
+                for (k=0; k<_h_len; k++)
+                    y += _h[k]*h_buf[k];
+                buffer[j] = y / sqrtf(h_energy);
+            }
+            wlanframesync_execute(fs, buffer, 80);
+        }
+    }
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+
+    return testdata.num_frames;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_chanest_autotest_s * testdata = (struct wlanframesync_chanest_autotest_s*) _userdata;
+
+    // count frames received without errors
+    if (_header_valid && _rxvector.LENGTH == testdata->length &&
+        count_bit_errors_array(_payload, testdata->msg_org, testdata->length) == 0)
+    {
+        testdata->num_frames++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Test decision-directed channel tracking: a long frame over a slowly
+// time-varying two-tap channel is lost with the preamble estimate alone
+// but decodes once tracking is enabled. Also checks that step sizes
+// outside [0,1), and tracking with the Q15 profile, are rejected.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+// run test with a specific tracking step size, returning the number of
+// frames decoded without errors
+unsigned int wlanframesync_chantrack_runtest(float _mu);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+// structure for tracking decoded frames
+struct wlanframesync_chantrack_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int num_frames;
+};
+
+#define CHANTRACK_NUM_FRAMES (3)    // number of frames per test
+#define CHANTRACK_LENGTH     (1500) // payload length [bytes]
+
+int main() {
+    // validate step size
+    wlanframesync fs = wlanframesync_create(callback, NULL);
+    if (wlanframesync_set_chantrack(fs, -0.1f) == 0 ||
+        wlanframesync_set_chantrack(fs,  1.0f) == 0 ||
+        wlanframesync_set_chantrack(fs,  1.5f) == 0)
+    {
+        fprintf(stderr,"fail: %s, invalid step size accepted\n", __FILE__);
+        exit(1);
+    }
+    if (wlanframesync_set_chantrack(fs, 0.0f) != 0 ||
+        wlanframesync_set_chantrack(fs, 0.5f) != 0)
+    {
+        fprintf(stderr,"fail: %s, valid step size rejected\n", __FILE__);
+        exit(1);
+    }
+
+    // tracking is not supported by the fixed-point profile, in either order
+    if (wlanframesync_set_profile(fs, WLANFRAMESYNC_PROFILE_Q15) == 0 ||
+        wlanframesync_set_chantrack(fs, 0.0f) != 0 ||
+        wlanframesync_set_profile(fs, WLANFRAMESYNC_PROFILE_Q15) != 0 ||
+        wlanframesync_set_chantrack(fs, 0.5f) == 0 ||
+        wlanframesync_set_chantrack(fs, 0.0f) != 0)
+    {
+        fprintf(stderr,"fail: %s, tracking combined with Q15 profile\n", __FILE__);
+        exit(1);
+    }
+    wlanframesync_destroy(fs);
+
+    // without tracking, the channel drifts away from the preamble estimate
+    unsigned int num_decoded = wlanframesync_chantrack_runtest(0.0f);
+    printf("mu = 0.0 : %u / %u frames decoded\n", num_decoded, CHANTRACK_NUM_FRAMES);
+    if (num_decoded != 0) {
+        fprintf(stderr,"fail: %s, channel does not defeat untracked receiver\n", __FILE__);
+        exit(1);
+    }
+
+    // with tracking, every frame decodes
+    num_decoded = wlanframesync_chantrack_runtest(0.2f);
+    printf("mu = 0.2 : %u / %u frames decoded\n", num_decoded, CHANTRACK_NUM_FRAMES);
+    if (num_decoded != CHANTRACK_NUM_FRAMES) {
+        fprintf(stderr,"fail: %s, tracking decoded %u / %u frames\n", __FILE__, num_decoded, CHANTRACK_NUM_FRAMES);
+        exit(1);
+    }
+
+    return 0;
+}
+
+unsigned int wlanframesync_chantrack_runtest(float _mu)
+{
+    // channel: direct path and a delayed echo whose phase rotates at the
+    // normalized Doppler frequency fd
+    float        fd = 2e-5f;    // echo Doppler frequency
+    float        a  = 0.5f;     // echo amplitude
+
+    // data options (fixed seed: identical payloads for each test)
+    unsigned char msg_org[CHANTRACK_LENGTH];
+    unsigned int i;
+    srand(1);
+    for (i=0; i<CHANTRACK_LENGTH; i++)
+        msg_org[i] = rand() & 0xff;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = CHANTRACK_LENGTH;
+    txvector.DATARATE    = WLANFRAME_RATE_24;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator and synchronizer
+    struct wlanframesync_chantrack_autotest_s testdata;
+    testdata.msg_org    = msg_org;
+    testdata.length     = CHANTRACK_LENGTH;
+    testdata.num_frames = 0;
+    wlanframegen fg = wlanframegen_create();
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    wlanframesync_set_chantrack(fs, _mu);
+
+    unsigned int n;
+    unsigned int j;
+    unsigned long int t = 0;    // sample index
+    float complex x_prev = 0.0f;
+    for (n=0; n<CHANTRACK_NUM_FRAMES; n++) {
+        // generate frame and push through channel
+        wlanframegen_assemble(fg, msg_org, txvector);
+        int last_frame = 0;
+        while (!last_frame) {
+            last_frame = wlanframegen_writesymbol(fg, buffer);
+            for (j=0; j<80; j++) {
+                float complex x = buffer[j];
+                buffer[j] = (x + a*cexpf(_Complex_I*2*M_PI*fd*t)*x_prev) / sqrtf(1 + a*a);
+                x_prev = x;
+                t++;
+            }
+            wlanframesync_execute(fs, buffer, 80);
+        }
+
+        // inter-frame gap
+        memset(buffer, 0x00, sizeof(buffer));
+        x_prev = 0.0f;
+        for (j=0; j<4; j++)
+            wlanframesync_execute(fs, buffer, 80);
+        t += 320;
+    }
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+
+    return testdata.num_frames;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_chantrack_autotest_s * testdata = (struct wlanframesync_chantrack_autotest_s*) _userdata;
+
+    // count frames received without errors
+    if (_header_valid && _rxvector.LENGTH == testdata->length &&
+        count_bit_errors_array(_payload, testdata->msg_org, testdata->length) == 0)
+    {
+        testdata->num_frames++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Test synchronization of frames from interleaved integer I/Q input
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific rate and sample format (16 or 8 bits)
+int wlanframesync_cs16_runtest(unsigned int _rate, unsigned int _bits);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+int main() {
+    unsigned int rates[] = {
+        WLANFRAME_RATE_6,  WLANFRAME_RATE_12, WLANFRAME_RATE_18,
+        WLANFRAME_RATE_24, WLANFRAME_RATE_36, WLANFRAME_RATE_48,
+        WLANFRAME_RATE_54};
+    unsigned int i;
+    for (i=0; i<sizeof(rates)/sizeof(rates[0]); i++) {
+        wlanframesync_cs16_runtest(rates[i], 16);
+        wlanframesync_cs16_runtest(rates[i],  8);
+    }
+
+    return 0;
+}
+
+// structure for tracking decoded frames
+struct wlanframesync_cs16_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int datarate;
+    unsigned int num_frames;
+    unsigned int valid;
+};
+
+int wlanframesync_cs16_runtest(unsigned int _rate,
+                               unsigned int _bits)
+{
+    unsigned int num_frames = 4;        // number of frames to transmit
+    unsigned int num_idle   = 37*80;    // idle samples before each frame
+    unsigned int block_len  = 37;       // input block size (not a multiple of symbol length)
+    float        gain       = 0.25f;    // signal amplitude relative to full scale
+    float        full_scale = _bits == 16 ? 32768.0f : 128.0f;
+
+    // data options
+    unsigned char * msg_org = annexg_G1;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // create frame generator and generate frame once
+    wlanframegen fg = wlanframegen_create();
+    wlanframegen_assemble(fg, msg_org, txvector);
+    unsigned int frame_len = 80*wlanframegen_getframelen(fg);
+    unsigned int num_samples = num_idle + frame_len;
+    float complex * frame = (float complex*) malloc(num_samples*sizeof(float complex));
+    memset(frame, 0x00, num_idle*sizeof(float complex));
+    unsigned int n = num_idle;
+    int last_symbol = 0;
+    while (!last_symbol) {
+        last_symbol = wlanframegen_writesymbol(fg, &frame[n]);
+        n += 80;
+    }
+
+    // quantize to interleaved integer samples, clipping to full scale
+    int16_t * buf16 = (int16_t*) malloc(2*num_samples*sizeof(int16_t));
+    int8_t  * buf8  = (int8_t *) malloc(2*num_samples*sizeof(int8_t ));
+    unsigned int i;
+    for (i=0; i<2*num_samples; i++) {
+        float v = roundf(gain * full_scale * (i%2 ? cimagf(frame[i/2]) : crealf(frame[i/2])));
+        v = v >  full_scale - 1 ?  full_scale - 1 : v;
+        v = v < -full_scale     ? -full_scale     : v;
+        buf16[i] = (int16_t)v;
+        buf8[i]  = (int8_t) v;
+    }
+
+    // initialize test data object
+    struct wlanframesync_cs16_autotest_s testdata;
+    testdata.msg_org    = msg_org;
+    testdata.length     = txvector.LENGTH;
+    testdata.datarate   = txvector.DATARATE;
+    testdata.num_frames = 0;
+    testdata.valid      = 1;
+
+    // create frame synchronizer, ignoring idle channel
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    wlanframesync_set_squelch(fs, -40.0f);
+
+    unsigned int j;
+    for (j=0; j<num_frames; j++) {
+        for (i=0; i<num_samples; i+=block_len) {
+            unsigned int k = i + block_len < num_samples ? block_len : num_samples - i;
+            if (_bits == 16)
+                wlanframesync_execute_cs16(fs, &buf16[2*i], k);
+            else
+                wlanframesync_execute_cs8 (fs, &buf8 [2*i], k);
+        }
+    }
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+    free(frame);
+    free(buf16);
+    free(buf8);
+
+    // check results
+    if (testdata.num_frames != num_frames) {
+        fprintf(stderr,"wlanframesync_cs16_autotest: decoded %u / %u frames\n", testdata.num_frames, num_frames);
+        testdata.valid = 0;
+    }
+
+    if (!testdata.valid) {
+        fprintf(stderr,"fail: %s, synchronization failure (rate = %u, cs%u)\n", __FILE__, _rate, _bits);
+        exit(1);
+    }
+
+    return 0;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_cs16_autotest_s * testdata = (struct wlanframesync_cs16_autotest_s*) _userdata;
+
+    if (!_header_valid) {
+        fprintf(stderr,"wlanframesync_cs16_autotest: header invalid!\n");
+        testdata->valid = 0;
+    } else if (count_bit_errors_array(_payload, testdata->msg_org, _rxvector.LENGTH) != 0) {
+        fprintf(stderr,"wlanframesync_cs16_autotest: errors detected!\n");
+        testdata->valid = 0;
+    } else if (testdata->length != _rxvector.LENGTH || testdata->datarate != _rxvector.DATARATE) {
+        fprintf(stderr,"wlanframesync_cs16_autotest: header mismatch\n");
+        testdata->valid = 0;
+    } else {
+        testdata->num_frames++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+// Test short sequence gain estimation against full 64-point transform
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+#include "liquid-wlan.internal.h"
+
+int main(int argc, char*argv[])
+{
+    unsigned int num_trials = 20;
+    float        tol        = 1e-4f;
+
+    float complex x[64];    // time-domain input
+    float complex X[64];    // full transform of input
+    float complex G[64];    // estimated gain
+
+    unsigned int n, i;
+    for (n=0; n<num_trials; n++) {
+        // random input: short sequence through random gain plus noise
+        float complex g = randnf() + _Complex_I*randnf();
+        for (i=0; i<64; i++)
+            x[i] = g*wlanframe_s0[i] + 0.1f*(randnf() + _Complex_I*randnf());
+
+        // estimate gain
+        wlanframesync_estimate_gain_S0(x, G);
+
+        // compute reference using full transform
+        fft_run(64, x, X, LIQUID_FFT_FORWARD, 0);
+
+        for (i=0; i<64; i++) {
+            float complex G_ref = 0.0f;
+            if ( (i%4)==0 && i != 0 && (i <= 24 || i >= 40) )
+                G_ref = X[i] * conjf(wlanframe_S0[i]) * 0.054127f;
+
+            if (cabsf(G[i] - G_ref) > tol*(1.0f + cabsf(G_ref))) {
+                fprintf(stderr,"fail: %s, bin %2u mismatch: %12.8f + j%12.8f (expected %12.8f + j%12.8f)\n",
+                        __FILE__, i, crealf(G[i]), cimagf(G[i]), crealf(G_ref), cimagf(G_ref));
+                exit(1);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Test header callback decode/skip/abort control on back-to-back frames
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// header callback: skip 24 M bits/s frames, abort 54 M bits/s frames
+static int header_callback(struct wlan_rxvector_s _rxvector,
+                           framesyncstats_s       _stats,
+                           void *                 _userdata);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+// structure for tracking frames
+struct wlanframesync_header_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int num_headers;
+    unsigned int num_frames;
+    unsigned int valid;
+};
+
+int main() {
+    // frame rates to transmit
+    unsigned int rates[] = {
+        WLANFRAME_RATE_6,  WLANFRAME_RATE_24, WLANFRAME_RATE_12,
+        WLANFRAME_RATE_54, WLANFRAME_RATE_24, WLANFRAME_RATE_36,
+        WLANFRAME_RATE_24, WLANFRAME_RATE_48, WLANFRAME_RATE_54,
+        WLANFRAME_RATE_18};
+    unsigned int num_frames = sizeof(rates)/sizeof(rates[0]);
+
+    // data options
+    unsigned char * msg_org = annexg_G1;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator
+    wlanframegen fg = wlanframegen_create();
+
+    // initialize test data object
+    struct wlanframesync_header_autotest_s testdata;
+    testdata.msg_org     = msg_org;
+    testdata.length      = txvector.LENGTH;
+    testdata.num_headers = 0;
+    testdata.num_frames  = 0;
+    testdata.valid       = 1;
+
+    // create frame synchronizer
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    wlanframesync_set_header_callback(fs, header_callback);
+
+    unsigned int i;
+    unsigned int num_decode = 0, num_skip = 0, num_abort = 0;
+    unsigned long long num_samples_decode = 0, num_samples_skip = 0;
+    for (i=0; i<num_frames; i++) {
+        // generate/synchronize frame
+        txvector.DATARATE = rates[i];
+        wlanframegen_assemble(fg, msg_org, txvector);
+        unsigned int nsym = wlanframegen_getframelen(fg) - 6;
+        switch (rates[i]) {
+        case WLANFRAME_RATE_24: num_skip++;   num_samples_skip   += 80*nsym; break;
+        case WLANFRAME_RATE_54: num_abort++;                                 break;
+        default:                num_decode++; num_samples_decode += 80*nsym;
+        }
+
+        int last_frame = 0;
+        while (!last_frame) {
+            last_frame = wlanframegen_writesymbol(fg, buffer);
+            wlanframesync_execute(fs, buffer, 80);
+        }
+
+        // short inter-frame gap
+        memset(buffer, 0x00, sizeof(buffer));
+        wlanframesync_execute(fs, buffer, 80);
+    }
+    wlanframesync_airtimestats_s stats = wlanframesync_get_airtimestats(fs);
+    printf("headers %u, decoded %u (%llu samples), skipped %u (%llu samples), aborted %u\n",
+            testdata.num_headers,
+            stats.num_frames_decoded, stats.num_samples_decoded,
+            stats.num_frames_skipped, stats.num_samples_skipped,
+            stats.num_frames_aborted);
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+
+    // check results
+    if (testdata.num_headers != num_frames) {
+        fprintf(stderr,"wlanframesync_header_autotest: received %u / %u headers\n", testdata.num_headers, num_frames);
+        testdata.valid = 0;
+    } else if (testdata.num_frames != num_decode) {
+        fprintf(stderr,"wlanframesync_header_autotest: decoded %u / %u frames\n", testdata.num_frames, num_decode);
+        testdata.valid = 0;
+    } else if (stats.num_frames_decoded != num_decode ||
+               stats.num_frames_skipped != num_skip   ||
+               stats.num_frames_aborted != num_abort)
+    {
+        fprintf(stderr,"wlanframesync_header_autotest: frame count mismatch\n");
+        testdata.valid = 0;
+    } else if (stats.num_samples_decoded != num_samples_decode ||
+               stats.num_samples_skipped != num_samples_skip)
+    {
+        fprintf(stderr,"wlanframesync_header_autotest: airtime mismatch\n");
+        testdata.valid = 0;
+    }
+
+    if (!testdata.valid) {
+        fprintf(stderr,"fail: %s, header callback failure\n", __FILE__);
+        exit(1);
+    }
+
+    return 0;
+}
+
+static int header_callback(struct wlan_rxvector_s _rxvector,
+                           framesyncstats_s       _stats,
+                           void *                 _userdata)
+{
+    struct wlanframesync_header_autotest_s * testdata = (struct wlanframesync_header_autotest_s*) _userdata;
+    testdata->num_headers++;
+
+    if (testdata->length != _rxvector.LENGTH) {
+        fprintf(stderr,"wlanframesync_header_autotest: length mismatch\n");
+        testdata->valid = 0;
+    }
+
+    switch (_rxvector.DATARATE) {
+    case WLANFRAME_RATE_24: return WLANFRAMESYNC_HEADER_SKIP;
+    case WLANFRAME_RATE_54: return WLANFRAMESYNC_HEADER_ABORT;
+    default:;
+    }
+    return WLANFRAMESYNC_HEADER_DECODE;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_header_autotest_s * testdata = (struct wlanframesync_header_autotest_s*) _userdata;
+
+    if (!_header_valid) {
+        fprintf(stderr,"wlanframesync_header_autotest: header invalid!\n");
+        testdata->valid = 0;
+    } else if (_rxvector.DATARATE == WLANFRAME_RATE_24 || _rxvector.DATARATE == WLANFRAME_RATE_54) {
+        fprintf(stderr,"wlanframesync_header_autotest: received frame that should have been dropped\n");
+        testdata->valid = 0;
+    } else if (count_bit_errors_array(_payload, testdata->msg_org, _rxvector.LENGTH) != 0) {
+        fprintf(stderr,"wlanframesync_header_autotest: errors detected!\n");
+        testdata->valid = 0;
+    } else {
+        testdata->num_frames++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Test synchronization of back-to-back wlan frames with pipelined decoding
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific rate
+int wlanframesync_pipelined_runtest(unsigned int _rate);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+int main() {
+    // run tests
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_6);
+    //wlanframesync_pipelined_runtest(WLANFRAME_RATE_9);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_12);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_18);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_24);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_36);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_48);
+    wlanframesync_pipelined_runtest(WLANFRAME_RATE_54);
+
+    return 0;
+}
+
+// structure for tracking decoded frames (callbacks may run concurrently)
+struct wlanframesync_pipelined_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int datarate;
+    unsigned int num_frames;
+    unsigned int valid;
+    pthread_mutex_t mutex;
+};
+
+int wlanframesync_pipelined_runtest(unsigned int _rate)
+{
+    unsigned int num_frames  = 8;   // number of frames to transmit
+    unsigned int num_threads = 2;   // number of decoder threads
+
+    // data options
+    unsigned char * msg_org = annexg_G1;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator
+    wlanframegen fg = wlanframegen_create();
+
+    // initialize test data object
+    struct wlanframesync_pipelined_autotest_s testdata;
+    testdata.msg_org    = msg_org;
+    testdata.length     = txvector.LENGTH;
+    testdata.datarate   = txvector.DATARATE;
+    testdata.num_frames = 0;
+    testdata.valid      = 1;
+    pthread_mutex_init(&testdata.mutex, NULL);
+
+    // create frame synchronizer with enough buffers that no frame is dropped
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    wlanframesync_set_decoder_threads(fs, num_threads, num_frames);
+
+    unsigned int i;
+    for (i=0; i<num_frames; i++) {
+        // generate/synchronize frame
+        wlanframegen_assemble(fg, msg_org, txvector);
+        int last_frame = 0;
+        while (!last_frame) {
+            last_frame = wlanframegen_writesymbol(fg, buffer);
+            wlanframesync_execute(fs, buffer, 80);
+        }
+
+        // inter-frame gap
+        memset(buffer, 0x00, sizeof(buffer));
+        unsigned int j;
+        for (j=0; j<4; j++)
+            wlanframesync_execute(fs, buffer, 80);
+    }
+
+    // wait for all frames to be delivered
+    wlanframesync_flush(fs);
+    wlanframesync_decoderstats_s stats = wlanframesync_get_decoderstats(fs);
+    printf("rate %u: queued %u, decoded %u, dropped %u, max depth %u, latency avg %.3f ms, max %.3f ms\n",
+            _rate,
+            stats.num_frames_queued,
+            stats.num_frames_decoded,
+            stats.num_frames_dropped,
+            stats.queue_depth_max,
+            stats.latency_avg*1e3f,
+            stats.latency_max*1e3f);
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+    pthread_mutex_destroy(&testdata.mutex);
+
+    // check results
+    if (testdata.num_frames != num_frames) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: decoded %u / %u frames\n", testdata.num_frames, num_frames);
+        testdata.valid = 0;
+    } else if (stats.num_frames_queued != num_frames || stats.num_frames_decoded != num_frames) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: decoder statistics mismatch\n");
+        testdata.valid = 0;
+    } else if (stats.num_frames_dropped != 0 || stats.queue_depth != 0) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: unexpected dropped/pending frames\n");
+        testdata.valid = 0;
+    }
+
+    if (!testdata.valid) {
+        fprintf(stderr,"fail: %s, synchronization failure (rate = %u)\n", __FILE__, _rate);
+        exit(1);
+    }
+
+    return 0;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_pipelined_autotest_s * testdata = (struct wlanframesync_pipelined_autotest_s*) _userdata;
+
+    // count errors
+    unsigned int num_bit_errors = _header_valid ?
+        count_bit_errors_array(_payload, testdata->msg_org, _rxvector.LENGTH) : 0;
+
+    pthread_mutex_lock(&testdata->mutex);
+    if (!_header_valid) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: header invalid!\n");
+        testdata->valid = 0;
+    } else if (num_bit_errors != 0) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: errors detected!\n");
+        testdata->valid = 0;
+    } else if (testdata->length != _rxvector.LENGTH) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: length mismatch\n");
+        testdata->valid = 0;
+    } else if (testdata->datarate != _rxvector.DATARATE) {
+        fprintf(stderr,"wlanframesync_pipelined_autotest: rate mismatch\n");
+        testdata->valid = 0;
+    } else {
+        // increment number of frames decoded
+        testdata->num_frames++;
+    }
+    pthread_mutex_unlock(&testdata->mutex);
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Test per-state profiling counters: every input sample is counted in
+// exactly one state, decoded and skipped frames are accounted for, and
+// the counters reset. Without profiling compiled in, the counters must
+// remain zero.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// header callback: skip 24 M bits/s frames
+static int header_callback(struct wlan_rxvector_s _rxvector,
+                           framesyncstats_s       _stats,
+                           void *                 _userdata)
+{
+    return _rxvector.DATARATE == WLANFRAME_RATE_24 ? WLANFRAMESYNC_HEADER_SKIP : WLANFRAMESYNC_HEADER_DECODE;
+}
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    *(unsigned int*)_userdata += _header_valid && memcmp(_payload, annexg_G1, _rxvector.LENGTH) == 0;
+    return 0;
+}
+
+// sum of samples counted in every synchronizer state
+static unsigned long long profile_num_samples(wlanframesync_profilestats_s _p)
+{
+    return _p.seekplcp.num_samples + _p.rxshort0.num_samples + _p.rxshort1.num_samples +
+           _p.rxlong.num_samples   + _p.rxsignal.num_samples + _p.rxdata.num_samples   +
+           _p.skipdata.num_samples;
+}
+
+int main() {
+    unsigned int rates[] = {WLANFRAME_RATE_6, WLANFRAME_RATE_24, WLANFRAME_RATE_54, WLANFRAME_RATE_24};
+    unsigned int num_frames = sizeof(rates)/sizeof(rates[0]);
+
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    wlanframegen fg = wlanframegen_create();
+    unsigned int num_valid = 0;
+    wlanframesync fs = wlanframesync_create(callback, (void*)&num_valid);
+    wlanframesync_set_header_callback(fs, header_callback);
+
+    // generate frames separated by silence, feeding the synchronizer in
+    // blocks which do not align with symbol boundaries
+    float complex buffer[1237];
+    unsigned long long num_samples = 0;
+    unsigned long long num_samples_decode = 0;
+    unsigned long long num_samples_skip   = 0;
+    unsigned int i;
+    for (i=0; i<num_frames; i++) {
+        txvector.DATARATE = rates[i];
+        wlanframegen_assemble(fg, annexg_G1, txvector);
+        unsigned int nsym = wlanframegen_getframelen(fg) - 6;
+        if (rates[i] == WLANFRAME_RATE_24) num_samples_skip   += 80*nsym;
+        else                               num_samples_decode += 80*nsym;
+
+        memset(buffer, 0x00, sizeof(buffer));
+        wlanframesync_execute(fs, buffer, 300);
+        num_samples += 300;
+        unsigned int n = wlanframegen_get_num_samples(fg);
+        float complex * frame = (float complex*) malloc(n*sizeof(float complex));
+        wlanframegen_write_frame(fg, frame, n);
+        unsigned int j;
+        for (j=0; j<n; j+=1237) {
+            unsigned int m = n - j < 1237 ? n - j : 1237;
+            wlanframesync_execute(fs, &frame[j], m);
+            num_samples += m;
+        }
+        free(frame);
+    }
+    memset(buffer, 0x00, sizeof(buffer));
+    wlanframesync_execute(fs, buffer, 300);
+    num_samples += 300;
+
+    wlanframesync_profilestats_s p = wlanframesync_get_profilestats(fs);
+    printf("profiling %s\n", p.enabled ? "enabled" : "disabled");
+    printf("  %-10s %10s %12s\n", "state", "samples", "time [us]");
+    const char * names[8] = {"seekplcp", "rxshort0", "rxshort1", "rxlong",
+                             "rxsignal", "rxdata",   "skipdata", "decode"};
+    wlanframesync_profilecounter_s c[8] = {p.seekplcp, p.rxshort0, p.rxshort1, p.rxlong,
+                                           p.rxsignal, p.rxdata,   p.skipdata, p.decode};
+    for (i=0; i<8; i++)
+        printf("  %-10s %10llu %12.1f\n", names[i], c[i].num_samples, 1e-3*c[i].time_ns);
+
+    int valid = 1;
+    if (num_valid != 2) {
+        fprintf(stderr,"wlanframesync_profile_autotest: decoded %u / 2 frames\n", num_valid);
+        valid = 0;
+    } else if (!p.enabled) {
+        for (i=0; i<8; i++)
+            valid &= c[i].num_samples == 0 && c[i].time_ns == 0;
+        if (!valid)
+            fprintf(stderr,"wlanframesync_profile_autotest: counters not zero with profiling disabled\n");
+    } else if (profile_num_samples(p) != num_samples) {
+        fprintf(stderr,"wlanframesync_profile_autotest: counted %llu / %llu samples\n",
+                profile_num_samples(p), num_samples);
+        valid = 0;
+    } else if (p.skipdata.num_samples + p.rxdata.num_samples != num_samples_skip + num_samples_decode ||
+               p.decode.num_samples != num_samples_decode)
+    {
+        fprintf(stderr,"wlanframesync_profile_autotest: DATA field sample count mismatch\n");
+        valid = 0;
+    } else if (p.seekplcp.time_ns == 0 || p.rxdata.time_ns == 0 || p.decode.time_ns == 0) {
+        fprintf(stderr,"wlanframesync_profile_autotest: processing time not recorded\n");
+        valid = 0;
+    }
+
+    // reset counters
+    wlanframesync_reset_profilestats(fs);
+    if (profile_num_samples(wlanframesync_get_profilestats(fs)) != 0) {
+        fprintf(stderr,"wlanframesync_profile_autotest: counters not reset\n");
+        valid = 0;
+    }
+
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+
+    if (!valid) {
+        fprintf(stderr,"fail: %s, profiling counter failure\n", __FILE__);
+        exit(1);
+    }
+    return 0;
+}
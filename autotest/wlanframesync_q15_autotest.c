@@ -0,0 +1,332 @@
+// Test synchronization of wlan frames with the fixed-point (Q15) receive
+// profile, both inline and with pipelined decoding; check that the
+// Viterbi decoders stay within their output buffers; and compare packet
+// error rates against the floating-point profile over a noisy multipath
+// channel
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.h"
+#include "liquid-wlan.internal.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific rate, gain, and number of decoder threads
+int wlanframesync_q15_runtest(unsigned int _rate,
+                              float        _gain,
+                              unsigned int _num_threads);
+
+// decode encoded message with hard and soft Viterbi decoders, checking
+// output and guard bytes past the end of the decoded message
+void wlanframesync_q15_fec_bounds(unsigned int _fec_scheme);
+
+// run frames through noisy multipath channel into float and Q15
+// synchronizers, checking Q15 packet error rate against float
+void wlanframesync_q15_per(unsigned int _rate,
+                           float        _snr);
+
+// callback function
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata);
+
+int main() {
+    // run tests (inline decoding)
+    wlanframesync_q15_runtest(WLANFRAME_RATE_6,  1.0f,  0);
+    //wlanframesync_q15_runtest(WLANFRAME_RATE_9,  1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_12, 1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_18, 1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_24, 1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_36, 1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_48, 1.0f,  0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_54, 1.0f,  0);
+
+    // input level well away from nominal
+    wlanframesync_q15_runtest(WLANFRAME_RATE_54, 0.01f, 0);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_54, 20.0f, 0);
+
+    // pipelined decoding
+    wlanframesync_q15_runtest(WLANFRAME_RATE_6,  1.0f,  2);
+    wlanframesync_q15_runtest(WLANFRAME_RATE_54, 1.0f,  2);
+
+    // decoder output bounds
+    wlanframesync_q15_fec_bounds(LIQUID_WLAN_FEC_R1_2);
+    wlanframesync_q15_fec_bounds(LIQUID_WLAN_FEC_R2_3);
+    wlanframesync_q15_fec_bounds(LIQUID_WLAN_FEC_R3_4);
+
+    // packet error rate against float profile: Q15 with soft decisions
+    // must not do worse than float with hard decisions, whether float
+    // loses most frames or none
+    wlanframesync_q15_per(WLANFRAME_RATE_12, 10.0f);
+    wlanframesync_q15_per(WLANFRAME_RATE_12, 16.0f);
+    wlanframesync_q15_per(WLANFRAME_RATE_36, 24.0f);
+
+    return 0;
+}
+
+// structure for tracking decoded frames (callbacks may run concurrently)
+struct wlanframesync_q15_autotest_s {
+    unsigned char * msg_org;
+    unsigned int length;
+    unsigned int datarate;
+    unsigned int num_frames;
+    unsigned int valid;
+    int verbose;            // report each failed frame
+    pthread_mutex_t mutex;
+};
+
+int wlanframesync_q15_runtest(unsigned int _rate,
+                              float        _gain,
+                              unsigned int _num_threads)
+{
+    unsigned int num_frames = 4;    // number of frames to transmit
+
+    // data options
+    unsigned char * msg_org = annexg_G1;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // arrays
+    float complex buffer[80];   // data buffer
+
+    // create frame generator
+    wlanframegen fg = wlanframegen_create();
+
+    // initialize test data object
+    struct wlanframesync_q15_autotest_s testdata;
+    testdata.msg_org    = msg_org;
+    testdata.length     = txvector.LENGTH;
+    testdata.datarate   = txvector.DATARATE;
+    testdata.num_frames = 0;
+    testdata.valid      = 1;
+    testdata.verbose    = 1;
+    pthread_mutex_init(&testdata.mutex, NULL);
+
+    // create frame synchronizer with fixed-point profile
+    wlanframesync fs = wlanframesync_create(callback, (void*)&testdata);
+    if (wlanframesync_set_profile(fs, WLANFRAMESYNC_PROFILE_Q15) != 0) {
+        fprintf(stderr,"fail: %s, could not set Q15 profile\n", __FILE__);
+        exit(1);
+    }
+    if (_num_threads > 0)
+        wlanframesync_set_decoder_threads(fs, _num_threads, num_frames);
+
+    unsigned int i;
+    unsigned int j;
+    for (i=0; i<num_frames; i++) {
+        // generate/synchronize frame
+        wlanframegen_assemble(fg, msg_org, txvector);
+        int last_frame = 0;
+        while (!last_frame) {
+            last_frame = wlanframegen_writesymbol(fg, buffer);
+            for (j=0; j<80; j++)
+                buffer[j] *= _gain;
+            wlanframesync_execute(fs, buffer, 80);
+        }
+
+        // inter-frame gap
+        memset(buffer, 0x00, sizeof(buffer));
+        for (j=0; j<4; j++)
+            wlanframesync_execute(fs, buffer, 80);
+    }
+
+    // wait for all frames to be delivered
+    wlanframesync_flush(fs);
+
+    // destroy objects
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+    pthread_mutex_destroy(&testdata.mutex);
+
+    // check results
+    if (testdata.num_frames != num_frames) {
+        fprintf(stderr,"wlanframesync_q15_autotest: decoded %u / %u frames\n", testdata.num_frames, num_frames);
+        testdata.valid = 0;
+    }
+
+    if (!testdata.valid) {
+        fprintf(stderr,"fail: %s, synchronization failure (rate = %u, gain = %g, threads = %u)\n",
+                __FILE__, _rate, _gain, _num_threads);
+        exit(1);
+    }
+
+    return 0;
+}
+
+void wlanframesync_q15_fec_bounds(unsigned int _fec_scheme)
+{
+    // message length (multiple of 12 bytes for whole encoded bytes at
+    // every code rate) and guard length past the decoded message
+    unsigned int dec_msg_len = 36;
+    unsigned int guard_len   = 2*dec_msg_len;
+    unsigned int enc_msg_len = _fec_scheme == LIQUID_WLAN_FEC_R1_2 ? 2*dec_msg_len :
+                               _fec_scheme == LIQUID_WLAN_FEC_R2_3 ? 3*dec_msg_len/2 :
+                                                                     4*dec_msg_len/3;
+
+    // random message with zero tail bits
+    unsigned char msg_org[dec_msg_len];
+    unsigned char msg_enc[enc_msg_len];
+    unsigned char soft_enc[8*enc_msg_len];
+    unsigned int i;
+    srand(1);
+    for (i=0; i<dec_msg_len; i++)
+        msg_org[i] = rand() & 0xff;
+    msg_org[dec_msg_len-1] = 0x00;
+    wlan_fec_encode(_fec_scheme, dec_msg_len, msg_org, msg_enc);
+    for (i=0; i<8*enc_msg_len; i++)
+        soft_enc[i] = (msg_enc[i/8] >> (7-(i%8))) & 0x01 ? LIQUID_WLAN_SOFTBIT_1 : LIQUID_WLAN_SOFTBIT_0;
+
+    // decode into buffers with guard bytes
+    unsigned char msg_dec[2][dec_msg_len + guard_len];
+    memset(msg_dec, 0xa5, sizeof(msg_dec));
+    wlan_fec_decode     (_fec_scheme, dec_msg_len, msg_enc,  msg_dec[0]);
+    wlan_fec_decode_soft(_fec_scheme, dec_msg_len, soft_enc, msg_dec[1]);
+
+    unsigned int k;
+    for (k=0; k<2; k++) {
+        int valid = memcmp(msg_dec[k], msg_org, dec_msg_len) == 0;
+        for (i=0; i<guard_len; i++)
+            valid &= msg_dec[k][dec_msg_len + i] == 0xa5;
+        if (!valid) {
+            fprintf(stderr,"fail: %s, %s decoder (scheme %u) output or guard mismatch\n",
+                    __FILE__, k ? "soft" : "hard", _fec_scheme);
+            exit(1);
+        }
+    }
+}
+
+void wlanframesync_q15_per(unsigned int _rate,
+                           float        _snr)
+{
+    unsigned int num_frames = 100;  // number of frames to transmit
+    float        tolerance  = 0.05; // Q15 PER may exceed float PER by this much
+
+    // data options
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = _rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+    unsigned char msg_org[100];
+
+    // channel: fixed two-tap multipath and noise, scaled as in the
+    // performance example
+    float complex h[2]  = {0.9f, 0.4f*_Complex_I};
+    float noise_floor = -40.0f;
+    float nstd  = powf(10.0f, noise_floor/20.0f);
+    float gamma = powf(10.0f, (_snr + noise_floor)/20.0f);
+
+    // create frame generator and one synchronizer per profile; both see
+    // the same samples
+    struct wlanframesync_q15_autotest_s testdata[2];
+    wlanframesync fs[2];
+    unsigned int k;
+    for (k=0; k<2; k++) {
+        testdata[k].msg_org    = msg_org;
+        testdata[k].length     = txvector.LENGTH;
+        testdata[k].datarate   = txvector.DATARATE;
+        testdata[k].num_frames = 0;
+        testdata[k].valid      = 1;
+        testdata[k].verbose    = 0;
+        pthread_mutex_init(&testdata[k].mutex, NULL);
+        fs[k] = wlanframesync_create(callback, (void*)&testdata[k]);
+    }
+    wlanframesync_set_profile(fs[1], WLANFRAMESYNC_PROFILE_Q15);
+    wlanframegen fg = wlanframegen_create();
+
+    float complex buffer[80];
+    float complex x_prev = 0.0f;
+    unsigned int i;
+    unsigned int j;
+    srand(1);
+    for (i=0; i<num_frames; i++) {
+        for (j=0; j<txvector.LENGTH; j++)
+            msg_org[j] = rand() & 0xff;
+        wlanframegen_assemble(fg, msg_org, txvector);
+
+        // generate frame followed by a gap of noise
+        int last_frame = 0;
+        unsigned int num_gap = 0;
+        while (num_gap < 4) {
+            if (!last_frame) {
+                last_frame = wlanframegen_writesymbol(fg, buffer);
+            } else {
+                memset(buffer, 0x00, sizeof(buffer));
+                num_gap++;
+            }
+            for (j=0; j<80; j++) {
+                float complex x = buffer[j];
+                buffer[j] = gamma*(h[0]*x + h[1]*x_prev) +
+                            nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+                x_prev = x;
+            }
+            for (k=0; k<2; k++)
+                wlanframesync_execute(fs[k], buffer, 80);
+        }
+    }
+
+    wlanframegen_destroy(fg);
+    float per[2];
+    for (k=0; k<2; k++) {
+        wlanframesync_destroy(fs[k]);
+        pthread_mutex_destroy(&testdata[k].mutex);
+        per[k] = 1.0f - (float)testdata[k].num_frames / (float)num_frames;
+    }
+    unsigned int rate_mbps[8] = {6, 9, 12, 18, 24, 36, 48, 54};
+    printf("%2u M bits/s, SNR %4.1f dB : PER float %5.3f, Q15 %5.3f\n",
+            rate_mbps[_rate], _snr, per[0], per[1]);
+
+    if (per[1] > per[0] + tolerance) {
+        fprintf(stderr,"fail: %s, Q15 PER %.3f exceeds float PER %.3f by more than %.2f (%u M bits/s, SNR = %.1f dB)\n",
+                __FILE__, per[1], per[0], tolerance, rate_mbps[_rate], _snr);
+        exit(1);
+    }
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct wlanframesync_q15_autotest_s * testdata = (struct wlanframesync_q15_autotest_s*) _userdata;
+
+    // count errors (only when length matches the original message)
+    int length_valid = _header_valid && testdata->length == _rxvector.LENGTH;
+    unsigned int num_bit_errors = length_valid ?
+        count_bit_errors_array(_payload, testdata->msg_org, _rxvector.LENGTH) : 0;
+
+    const char * error = NULL;
+    if (!_header_valid)
+        error = "header invalid!";
+    else if (!length_valid)
+        error = "length mismatch";
+    else if (testdata->datarate != _rxvector.DATARATE)
+        error = "rate mismatch";
+    else if (num_bit_errors != 0)
+        error = "errors detected!";
+
+    pthread_mutex_lock(&testdata->mutex);
+    if (error != NULL) {
+        if (testdata->verbose)
+            fprintf(stderr,"wlanframesync_q15_autotest: %s\n", error);
+        testdata->valid = 0;
+    } else {
+        // increment number of frames decoded
+        testdata->num_frames++;
+    }
+    pthread_mutex_unlock(&testdata->mutex);
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Test wlan multi-channel synthesizer against ideal band-limited
+// interpolation and mixing of individually rendered channel frames
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific number of channels; every channel but the
+// last carries one frame
+//  _num_channels   :   number of channels
+//  _chunk          :   number of output samples per call, in channels
+int wlansynth_runtest(unsigned int _num_channels,
+                      unsigned int _chunk);
+
+int main() {
+    wlansynth_runtest(2,   1);
+    wlansynth_runtest(4, 100);
+    wlansynth_runtest(5, 333);  // non power-of-two transform
+    wlansynth_runtest(8, 512);
+    return 0;
+}
+
+int wlansynth_runtest(unsigned int _num_channels,
+                      unsigned int _chunk)
+{
+    unsigned int M = _num_channels;
+    unsigned int rates[4] = {WLANFRAME_RATE_6, WLANFRAME_RATE_54, WLANFRAME_RATE_24, WLANFRAME_RATE_12};
+    struct wlan_txvector_s txvector;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // render channel frames individually
+    wlanframegen fg = wlanframegen_create();
+    unsigned int nx = 3200;   // channel samples compared (covers frames)
+    float complex * x = (float complex*) calloc(M*nx, sizeof(float complex));
+    unsigned int k;
+    for (k=0; k<M-1; k++) {
+        txvector.DATARATE = rates[k % 4];
+        txvector.LENGTH   = 20 + 13*k;
+        wlanframegen_assemble(fg, annexg_G1, txvector);
+        wlanframegen_write_frame(fg, &x[k*nx], nx);
+    }
+    wlanframegen_destroy(fg);
+
+    // synthesize
+    wlansynth q = wlansynth_create(M, 2);
+    for (k=0; k<M-1; k++) {
+        txvector.DATARATE = rates[k % 4];
+        txvector.LENGTH   = 20 + 13*k;
+        if (wlansynth_push(q, k, annexg_G1, txvector) != 0) {
+            fprintf(stderr,"fail: %s, could not push frame on channel %u\n", __FILE__, k);
+            exit(1);
+        }
+    }
+    unsigned int ny = M*nx;
+    unsigned int delay = wlansynth_get_delay(q);
+    float complex * y = (float complex*) malloc(ny*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<nx; i+=_chunk)
+        wlansynth_execute(q, &y[M*i], M*(i + _chunk < nx ? _chunk : nx - i));
+    int rc = wlansynth_push(q, M, annexg_G1, txvector);
+    wlansynth_destroy(q);
+
+    // compare against reference over span where the filterbank has
+    // seen all relevant input
+    float e2 = 0.0f;
+    float p2 = 0.0f;
+    unsigned int l;
+    int n;
+    for (l=delay; l<ny; l++) {
+        double t = ((double)l - (double)delay) / (double)M;
+        double complex v = 0;
+        for (k=0; k<M-1; k++) {
+            double complex vk = 0;
+            for (n=(int)floor(t)-63; n<=(int)floor(t)+64; n++) {
+                if (n < 0 || n >= (int)nx) continue;
+                double u = t - n;
+                double r = u / 64.0;
+                double sinc = fabs(u) < 1e-9 ? 1.0 : sin(M_PI*u)/(M_PI*u);
+                vk += x[k*nx + n] * sinc * cos(0.5*M_PI*r) * cos(0.5*M_PI*r);
+            }
+            v += vk * cexp(_Complex_I*2*M_PI*(double)k*(double)l/(double)M);
+        }
+        e2 += cabsf(y[l] - (float complex)v) * cabsf(y[l] - (float complex)v);
+        p2 += cabs(v)*cabs(v);
+    }
+    float err = 10*log10f(e2/p2);
+
+    free(x);
+    free(y);
+
+    printf("channels %u, chunk %3u: %6u samples, error %7.2f dB\n", M, _chunk, ny, err);
+    if (err > -38.0f || rc == 0) {
+        fprintf(stderr,"fail: %s, synthesizer mismatch (channels = %u)\n", __FILE__, M);
+        exit(1);
+    }
+    return 0;
+}
@@ -0,0 +1,141 @@
+// Test wlan transmit queue stream against frames rendered individually
+// and overlap-added at the expected inter-frame spacing
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "liquid-wlan.h"
+
+#include "annex-g-data/G1.c"
+
+// run test with a specific spacing and ring buffer length
+//  _ifs        :   inter-frame spacing (samples)
+//  _ring_len   :   ring buffer length (samples)
+//  _chunk      :   number of samples per read
+int wlantxqueue_runtest(unsigned int _ifs,
+                        unsigned int _ring_len,
+                        unsigned int _chunk);
+
+// fill queue while nothing is read, checking that it reports full
+int wlantxqueue_full_runtest();
+
+int main() {
+    // ring buffers are shorter than a frame so the worker never runs
+    // idle between frames pushed before reading starts
+    wlantxqueue_runtest(WLANTXQUEUE_SIFS, 400,  37);
+    wlantxqueue_runtest(WLANTXQUEUE_DIFS, 100,  80);
+    wlantxqueue_runtest(40,               100,   1);
+    wlantxqueue_runtest(0,                400, 997);
+
+    wlantxqueue_full_runtest();
+
+    return 0;
+}
+
+int wlantxqueue_runtest(unsigned int _ifs,
+                        unsigned int _ring_len,
+                        unsigned int _chunk)
+{
+    unsigned int num_frames = 4;
+    unsigned int rates[4]   = {WLANFRAME_RATE_6, WLANFRAME_RATE_54, WLANFRAME_RATE_12, WLANFRAME_RATE_36};
+    unsigned int lengths[4] = {20, 100, 1, 64};
+    struct wlan_txvector_s txvector;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // reference stream: each frame starts 'ifs' samples after the last
+    // DATA symbol of the previous one
+    wlanframegen fg = wlanframegen_create();
+    unsigned int ref_len = 0;
+    unsigned int i;
+    for (i=0; i<num_frames; i++) {
+        txvector.DATARATE = rates[i];
+        txvector.LENGTH   = lengths[i];
+        wlanframegen_assemble(fg, annexg_G1, txvector);
+        ref_len += wlanframegen_get_num_samples(fg) - 80 + _ifs;
+    }
+    ref_len += 80 + 200;    // ramp-down and trailing idle samples
+    float complex * y_ref  = (float complex*) calloc(ref_len, sizeof(float complex));
+    float complex * y_test = (float complex*) malloc(ref_len*sizeof(float complex));
+    float complex * frame  = (float complex*) malloc(ref_len*sizeof(float complex));
+    unsigned int t = 0;
+    unsigned int j;
+    for (i=0; i<num_frames; i++) {
+        txvector.DATARATE = rates[i];
+        txvector.LENGTH   = lengths[i];
+        wlanframegen_assemble(fg, annexg_G1, txvector);
+        unsigned int n = wlanframegen_write_frame(fg, frame, ref_len);
+        for (j=0; j<n; j++)
+            y_ref[t + j] += frame[j];
+        t += n - 80 + _ifs;
+    }
+    wlanframegen_destroy(fg);
+
+    // push all frames, then read stream
+    float complex ring[_ring_len];
+    wlantxqueue q = wlantxqueue_create(ring, _ring_len, num_frames);
+    wlantxqueue_set_ifs(q, _ifs);
+    for (i=0; i<num_frames; i++) {
+        txvector.DATARATE = rates[i];
+        txvector.LENGTH   = lengths[i];
+        if (wlantxqueue_push(q, annexg_G1, txvector) != 0) {
+            fprintf(stderr,"fail: %s, could not push frame %u\n", __FILE__, i);
+            exit(1);
+        }
+    }
+    for (i=0; i<ref_len; i+=_chunk)
+        wlantxqueue_read(q, &y_test[i], i + _chunk < ref_len ? _chunk : ref_len - i);
+    unsigned int num_pending = wlantxqueue_get_num_pending(q);
+    wlantxqueue_destroy(q);
+
+    // compare
+    unsigned int num_errors = 0;
+    for (i=0; i<ref_len; i++)
+        num_errors += cabsf(y_test[i] - y_ref[i]) > 1e-6f;
+
+    free(y_ref);
+    free(y_test);
+    free(frame);
+
+    printf("ifs %3u, ring %3u, chunk %3u: %6u samples, %u errors\n",
+            _ifs, _ring_len, _chunk, ref_len, num_errors);
+    if (num_errors > 0 || num_pending != 0) {
+        fprintf(stderr,"fail: %s, stream mismatch (ifs = %u, ring = %u, chunk = %u)\n",
+                __FILE__, _ifs, _ring_len, _chunk);
+        exit(1);
+    }
+    return 0;
+}
+
+int wlantxqueue_full_runtest()
+{
+    unsigned int max_frames = 2;
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = WLANFRAME_RATE_6;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+
+    // worker blocks on the ring buffer, holding at most one frame
+    // besides the queued ones
+    float complex ring[100];
+    wlantxqueue q = wlantxqueue_create(ring, 100, max_frames);
+    unsigned int i;
+    unsigned int num_pushed = 0;
+    for (i=0; i<10; i++)
+        num_pushed += wlantxqueue_push(q, NULL, txvector) == 0;
+
+    // invalid frame is rejected
+    txvector.LENGTH = 0;
+    int rc = wlantxqueue_push(q, NULL, txvector);
+    wlantxqueue_destroy(q);
+
+    printf("full queue: %u frames accepted\n", num_pushed);
+    if (num_pushed < max_frames || num_pushed > max_frames + 1 || rc == 0) {
+        fprintf(stderr,"fail: %s, queue limit not enforced\n", __FILE__);
+        exit(1);
+    }
+    return 0;
+}
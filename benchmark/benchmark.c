@@ -0,0 +1,384 @@
+// benchmark harness
+//
+// The number of calls per repetition is calibrated (doubling) until one
+// repetition lasts at least the minimum time, which also warms caches and
+// branch predictors; a further untimed repetition precedes the timed
+// ones. Times are taken with the monotonic clock and, on x86, with the
+// time-stamp counter.
+//
+// Results can be written as CSV or JSON, one record per benchmark, and
+// compared against a baseline CSV file from an earlier run: a benchmark
+// regresses if its mean time per call is slower by more than the
+// threshold and the difference is significant under Welch's t-test
+// (one-sided, 99%) over the timed repetitions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <getopt.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+#   define BENCHMARK_HAVE_TSC 1
+#else
+#   define BENCHMARK_HAVE_TSC 0
+#endif
+
+// build type, e.g. Release, set by build system
+#ifndef BENCHMARK_BUILD_TYPE
+#   define BENCHMARK_BUILD_TYPE "unspecified"
+#endif
+
+#include "benchmark.h"
+
+// data rates in M bits/s, indexed by WLANFRAME_RATE_*
+static const unsigned int benchmark_rate_mbps[8] = {6, 9, 12, 18, 24, 36, 48, 54};
+
+// baseline record
+struct benchmark_baseline_s {
+    char         name[64];      // kernel name
+    unsigned int rate;          // data rate [M bits/s] (0: not applicable)
+    unsigned int length;        // payload length [bytes] (0: not applicable)
+    double       ns_mean;       // mean time per call [ns]
+    double       ns_stddev;     // standard deviation [ns]
+    unsigned int repetitions;   // number of timed repetitions
+};
+
+// results and comparison state
+static FILE *                        benchmark_fid             = NULL;
+static int                           benchmark_json            = 0;
+static unsigned int                  benchmark_num_records     = 0;
+static struct benchmark_baseline_s * benchmark_base            = NULL;
+static unsigned int                  benchmark_num_base        = 0;
+static unsigned int                  benchmark_num_compared    = 0;
+static unsigned int                  benchmark_num_regressions = 0;
+static char                          benchmark_cpu_flags[128]  = "";
+
+static double benchmark_time()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+static unsigned long long benchmark_cycles()
+{
+#if BENCHMARK_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int benchmark_compare(const void * _a, const void * _b)
+{
+    double a = *(const double*)_a;
+    double b = *(const double*)_b;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// data rate in M bits/s, 0 if not applicable
+static unsigned int benchmark_mbps(int _rate)
+{
+    return _rate >= 0 && _rate < 8 ? benchmark_rate_mbps[_rate] : 0;
+}
+
+// set space-separated list of instruction set extensions
+static void benchmark_detect_cpu_flags()
+{
+    benchmark_cpu_flags[0] = '\0';
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))    strcat(benchmark_cpu_flags, "sse2 ");
+    if (__builtin_cpu_supports("sse4.1"))  strcat(benchmark_cpu_flags, "sse4.1 ");
+    if (__builtin_cpu_supports("avx"))     strcat(benchmark_cpu_flags, "avx ");
+    if (__builtin_cpu_supports("avx2"))    strcat(benchmark_cpu_flags, "avx2 ");
+    if (__builtin_cpu_supports("fma"))     strcat(benchmark_cpu_flags, "fma ");
+    if (__builtin_cpu_supports("avx512f")) strcat(benchmark_cpu_flags, "avx512f ");
+#elif defined(__ARM_NEON)
+    strcat(benchmark_cpu_flags, "neon ");
+#endif
+    size_t n = strlen(benchmark_cpu_flags);
+    if (n > 0)
+        benchmark_cpu_flags[n-1] = '\0';
+    else
+        strcpy(benchmark_cpu_flags, "none");
+}
+
+// one-sided 99% critical value of Student's t distribution
+static double benchmark_t_crit(double _df)
+{
+    static const double t99[30] = {
+        31.821, 6.965, 4.541, 3.747, 3.365, 3.143, 2.998, 2.896, 2.821, 2.764,
+         2.718, 2.681, 2.650, 2.624, 2.602, 2.583, 2.567, 2.552, 2.539, 2.528,
+         2.518, 2.508, 2.500, 2.492, 2.485, 2.479, 2.473, 2.467, 2.462, 2.457};
+    if (_df < 1)  return t99[0];
+    if (_df > 30) return 2.326;
+    return t99[(int)_df - 1];
+}
+
+// read baseline CSV file
+static void benchmark_read_baseline(const char * _filename)
+{
+    FILE * fid = fopen(_filename, "r");
+    if (fid == NULL) {
+        fprintf(stderr,"error: benchmark_start(), could not open baseline '%s' for reading\n", _filename);
+        exit(1);
+    }
+    char line[512];
+    unsigned int num_alloc = 0;
+    while (fgets(line, sizeof(line), fid) != NULL) {
+        struct benchmark_baseline_s b;
+        double ns_median;
+        // kernel,rate,length,ns_per_op,ns_mean,ns_stddev,repetitions,...
+        if (sscanf(line, "%63[^,],%u,%u,%lf,%lf,%lf,%u",
+                   b.name, &b.rate, &b.length, &ns_median, &b.ns_mean, &b.ns_stddev, &b.repetitions) != 7)
+            continue;   // header or malformed line
+        if (benchmark_num_base == num_alloc) {
+            num_alloc = num_alloc ? 2*num_alloc : 64;
+            benchmark_base = (struct benchmark_baseline_s*) realloc(benchmark_base,
+                                num_alloc*sizeof(struct benchmark_baseline_s));
+        }
+        benchmark_base[benchmark_num_base++] = b;
+    }
+    fclose(fid);
+    if (benchmark_num_base == 0) {
+        fprintf(stderr,"error: benchmark_start(), no results in baseline '%s'\n", _filename);
+        exit(1);
+    }
+}
+
+void benchmark_opts_default(struct benchmark_opts_s * _opts)
+{
+    _opts->repetitions = 10;
+    _opts->min_time    = 0.01;
+    _opts->filter      = NULL;
+    _opts->quick       = 0;
+    _opts->output      = NULL;
+    _opts->baseline    = NULL;
+    _opts->threshold   = 0.10;
+}
+
+void benchmark_opts_init(struct benchmark_opts_s * _opts,
+                         int                       _argc,
+                         char *                    _argv[])
+{
+    benchmark_opts_default(_opts);
+
+    int dopt;
+    while ((dopt = getopt(_argc,_argv,"hr:t:k:qo:b:T:")) != EOF) {
+        switch (dopt) {
+        case 'h':
+            printf("Usage: %s [OPTION]\n", _argv[0]);
+            printf(" -h         : print help\n");
+            printf(" -r <num>   : number of timed repetitions,          default: 10\n");
+            printf(" -t <time>  : minimum time per repetition [s],      default: 0.01\n");
+            printf(" -k <name>  : run only kernels containing <name>\n");
+            printf(" -q         : quick run (reduced sweep, short repetitions)\n");
+            printf(" -o <file>  : write results (.json: JSON, otherwise CSV)\n");
+            printf(" -b <file>  : compare against baseline results (CSV)\n");
+            printf(" -T <frac>  : minimum slowdown reported as regression, default: 0.10\n");
+            exit(0);
+        case 'r': _opts->repetitions = atoi(optarg);    break;
+        case 't': _opts->min_time    = atof(optarg);    break;
+        case 'k': _opts->filter      = optarg;          break;
+        case 'q': _opts->quick       = 1;               break;
+        case 'o': _opts->output      = optarg;          break;
+        case 'b': _opts->baseline    = optarg;          break;
+        case 'T': _opts->threshold   = atof(optarg);    break;
+        default:
+            exit(1);
+        }
+    }
+
+    if (_opts->repetitions < 1) {
+        fprintf(stderr,"error: %s, number of repetitions must be at least 1\n", _argv[0]);
+        exit(1);
+    } else if (_opts->threshold < 0) {
+        fprintf(stderr,"error: %s, regression threshold must not be negative\n", _argv[0]);
+        exit(1);
+    }
+    if (_opts->quick) {
+        _opts->repetitions = _opts->repetitions < 3 ? _opts->repetitions : 3;
+        _opts->min_time    = _opts->min_time < 0.001 ? _opts->min_time : 0.001;
+    }
+
+    benchmark_start(_opts);
+}
+
+void benchmark_start(const struct benchmark_opts_s * _opts)
+{
+    benchmark_detect_cpu_flags();
+
+    if (_opts->output != NULL && benchmark_fid == NULL) {
+        benchmark_fid = fopen(_opts->output, "w");
+        if (benchmark_fid == NULL) {
+            fprintf(stderr,"error: benchmark_start(), could not open '%s' for writing\n", _opts->output);
+            exit(1);
+        }
+        size_t n = strlen(_opts->output);
+        benchmark_json = n >= 5 && strcmp(_opts->output + n - 5, ".json") == 0;
+        if (benchmark_json)
+            fprintf(benchmark_fid, "[\n");
+        else
+            fprintf(benchmark_fid, "kernel,rate,length,ns_per_op,ns_mean,ns_stddev,repetitions,"
+                                   "samples_per_s,cycles_per_op,cpu_flags,build_type\n");
+    }
+
+    if (_opts->baseline != NULL && benchmark_base == NULL)
+        benchmark_read_baseline(_opts->baseline);
+}
+
+void benchmark_print_header()
+{
+    printf("%-28s %4s %5s : %11s %7s %10s %10s %10s %10s\n",
+            "kernel", "rate", "len", "ns/call", "+/-", "ns/byte", "cyc/byte", "ns/symbol", "Msamp/s");
+}
+
+int benchmark_run(const struct benchmark_opts_s * _opts,
+                  const struct benchmark_s *      _b,
+                  struct benchmark_result_s *     _r)
+{
+    if (_opts->filter != NULL && strstr(_b->name, _opts->filter) == NULL)
+        return 0;
+
+    // calibrate number of calls per repetition (also warms up)
+    unsigned long int n = 1;
+    while (1) {
+        double t0 = benchmark_time();
+        _b->kernel(_b->context, n);
+        if (benchmark_time() - t0 >= _opts->min_time || n >= (1UL << 40))
+            break;
+        n *= 2;
+    }
+    _b->kernel(_b->context, n);
+
+    // timed repetitions
+    unsigned int R = _opts->repetitions;
+    double * ns     = (double*) malloc(R*sizeof(double));
+    double * cycles = (double*) malloc(R*sizeof(double));
+    unsigned int i;
+    for (i=0; i<R; i++) {
+        double             t0 = benchmark_time();
+        unsigned long long c0 = benchmark_cycles();
+        _b->kernel(_b->context, n);
+        unsigned long long c1 = benchmark_cycles();
+        double             t1 = benchmark_time();
+        ns[i]     = 1e9*(t1 - t0) / (double)n;
+        cycles[i] = (double)(c1 - c0) / (double)n;
+    }
+
+    // statistics
+    struct benchmark_result_s r;
+    r.num_calls       = n;
+    r.num_repetitions = R;
+    r.ns_mean         = 0.0;
+    for (i=0; i<R; i++)
+        r.ns_mean += ns[i] / R;
+    r.ns_stddev = 0.0;
+    for (i=0; i<R; i++)
+        r.ns_stddev += (ns[i] - r.ns_mean)*(ns[i] - r.ns_mean);
+    r.ns_stddev = R > 1 ? sqrt(r.ns_stddev / (R-1)) : 0.0;
+    qsort(ns,     R, sizeof(double), benchmark_compare);
+    qsort(cycles, R, sizeof(double), benchmark_compare);
+    r.ns_min    = ns[0];
+    r.ns_median = R % 2 ? ns[R/2]     : 0.5*(ns[R/2-1]     + ns[R/2]);
+    r.cycles    = R % 2 ? cycles[R/2] : 0.5*(cycles[R/2-1] + cycles[R/2]);
+    if (!BENCHMARK_HAVE_TSC)
+        r.cycles = 0.0;
+    free(ns);
+    free(cycles);
+
+    // print result, normalized by work per call
+    char rate[12]   = "-";
+    char length[12] = "-";
+    if (_b->rate != BENCHMARK_RATE_NONE) snprintf(rate,   sizeof(rate),   "%u", benchmark_mbps(_b->rate));
+    if (_b->length > 0)                  snprintf(length, sizeof(length), "%u", _b->length);
+    printf("%-28s %4s %5s : %11.1f %6.1f%%", _b->name, rate, length,
+            r.ns_median, 100.0*r.ns_stddev/r.ns_mean);
+    if (_b->bytes > 0)   printf(" %10.3f", r.ns_median/_b->bytes);   else printf(" %10s", "-");
+    if (_b->bytes > 0 && r.cycles > 0)
+                         printf(" %10.2f", r.cycles/_b->bytes);      else printf(" %10s", "-");
+    if (_b->symbols > 0) printf(" %10.1f", r.ns_median/_b->symbols); else printf(" %10s", "-");
+    if (_b->samples > 0) printf(" %10.3f", 1e3*_b->samples/r.ns_median); else printf(" %10s", "-");
+    printf("\n");
+
+    benchmark_record(_opts, _b, &r);
+
+    if (_r != NULL)
+        *_r = r;
+    return 1;
+}
+
+void benchmark_record(const struct benchmark_opts_s *   _opts,
+                      const struct benchmark_s *        _b,
+                      const struct benchmark_result_s * _r)
+{
+    unsigned int rate = benchmark_mbps(_b->rate);
+    double samples_per_s = _b->samples > 0 ? 1e9*_b->samples/_r->ns_median : 0.0;
+
+    // write record
+    if (benchmark_fid != NULL && benchmark_json) {
+        fprintf(benchmark_fid, "%s  {\"kernel\": \"%s\", \"rate\": %u, \"length\": %u, "
+                "\"ns_per_op\": %.3f, \"ns_mean\": %.3f, \"ns_stddev\": %.3f, \"repetitions\": %u, "
+                "\"samples_per_s\": %.1f, \"cycles_per_op\": %.1f, \"cpu_flags\": \"%s\", \"build_type\": \"%s\"}",
+                benchmark_num_records ? ",\n" : "", _b->name, rate, _b->length,
+                _r->ns_median, _r->ns_mean, _r->ns_stddev, _r->num_repetitions,
+                samples_per_s, _r->cycles, benchmark_cpu_flags, BENCHMARK_BUILD_TYPE);
+    } else if (benchmark_fid != NULL) {
+        fprintf(benchmark_fid, "%s,%u,%u,%.3f,%.3f,%.3f,%u,%.1f,%.1f,%s,%s\n",
+                _b->name, rate, _b->length,
+                _r->ns_median, _r->ns_mean, _r->ns_stddev, _r->num_repetitions,
+                samples_per_s, _r->cycles, benchmark_cpu_flags, BENCHMARK_BUILD_TYPE);
+    }
+    benchmark_num_records++;
+
+    // compare against baseline (Welch's t-test on mean time per call)
+    unsigned int i;
+    for (i=0; i<benchmark_num_base; i++) {
+        const struct benchmark_baseline_s * base = &benchmark_base[i];
+        if (strcmp(base->name, _b->name) != 0 || base->rate != rate || base->length != _b->length)
+            continue;
+
+        benchmark_num_compared++;
+        unsigned int na = base->repetitions;
+        unsigned int nb = _r->num_repetitions;
+        double va = base->ns_stddev*base->ns_stddev / na;
+        double vb = _r->ns_stddev*_r->ns_stddev / nb;
+        double d  = _r->ns_mean - base->ns_mean;
+        double t  = INFINITY;
+        double df = 1e9;
+        if (va + vb > 0) {
+            t  = d / sqrt(va + vb);
+            df = (va + vb)*(va + vb) / ((na > 1 ? va*va/(na-1) : 0) + (nb > 1 ? vb*vb/(nb-1) : 0));
+        }
+        double slowdown = d / base->ns_mean;
+        if (slowdown > _opts->threshold && t > benchmark_t_crit(df)) {
+            benchmark_num_regressions++;
+            fprintf(stderr,"regression: %s, rate %u, length %u: %.1f ns -> %.1f ns (+%.1f%%, t = %.1f)\n",
+                    _b->name, rate, _b->length, base->ns_mean, _r->ns_mean, 100.0*slowdown, t);
+        }
+        break;
+    }
+}
+
+int benchmark_finish(const struct benchmark_opts_s * _opts)
+{
+    if (benchmark_fid != NULL) {
+        if (benchmark_json)
+            fprintf(benchmark_fid, "\n]\n");
+        fclose(benchmark_fid);
+        benchmark_fid = NULL;
+    }
+
+    if (benchmark_base == NULL)
+        return 0;
+
+    printf("# compared %u / %u results with baseline '%s': %u regression(s)\n",
+            benchmark_num_compared, benchmark_num_records, _opts->baseline, benchmark_num_regressions);
+    free(benchmark_base);
+    benchmark_base = NULL;
+    return benchmark_num_regressions > 0 ? 1 : 0;
+}
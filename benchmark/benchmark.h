@@ -0,0 +1,92 @@
+// benchmark harness: calibration, warm-up, repeated timing and statistics,
+// machine-readable results and comparison against a stored baseline
+#ifndef __LIQUID_WLAN_BENCHMARK_H__
+#define __LIQUID_WLAN_BENCHMARK_H__
+
+// rate value for benchmarks independent of the data rate
+#define BENCHMARK_RATE_NONE (-1)
+
+// benchmark options, set from the command line
+struct benchmark_opts_s {
+    unsigned int repetitions;   // number of timed repetitions
+    double       min_time;      // minimum duration of each repetition [s]
+    const char * filter;        // run only benchmarks whose name contains this string
+    int          quick;         // reduced sweep (fewer rates and lengths)
+    const char * output;        // results file (JSON if name ends in .json, CSV otherwise), or NULL
+    const char * baseline;      // baseline results (CSV) to compare against, or NULL
+    double       threshold;     // minimum relative slowdown reported as a regression
+};
+
+// run kernel _n times
+typedef void (*benchmark_kernel)(void *            _context,
+                                 unsigned long int _n);
+
+// benchmark definition; work per call is used to normalize results
+struct benchmark_s {
+    const char *     name;      // kernel name
+    int              rate;      // data rate, e.g. WLANFRAME_RATE_6 (or BENCHMARK_RATE_NONE)
+    unsigned int     length;    // payload length [bytes] (0 if not applicable)
+    double           bytes;     // payload bytes processed per call (0: not reported)
+    double           symbols;   // OFDM symbols processed per call (0: not reported)
+    double           samples;   // samples processed per call (0: not reported)
+    benchmark_kernel kernel;    // kernel
+    void *           context;   // kernel state
+};
+
+// benchmark result (times per call)
+struct benchmark_result_s {
+    unsigned long int num_calls;        // calls per repetition
+    unsigned int      num_repetitions;  // number of timed repetitions
+    double            ns_min;           // minimum [ns]
+    double            ns_median;        // median [ns]
+    double            ns_mean;          // mean [ns]
+    double            ns_stddev;        // standard deviation [ns]
+    double            cycles;           // median time-stamp counter cycles (0: unavailable)
+};
+
+// set default options
+//  _opts   :   options to set
+void benchmark_opts_default(struct benchmark_opts_s * _opts);
+
+// parse command-line options, printing usage and exiting on -h, and open
+// results and baseline files
+//  _opts   :   options to set
+//  _argc   :   number of arguments
+//  _argv   :   argument list
+void benchmark_opts_init(struct benchmark_opts_s * _opts,
+                         int                       _argc,
+                         char *                    _argv[]);
+
+// open results file and read baseline given in options; called by
+// benchmark_opts_init() and needed only by programs parsing their own
+// command line
+//  _opts   :   options
+void benchmark_start(const struct benchmark_opts_s * _opts);
+
+// print column headings
+void benchmark_print_header();
+
+// run benchmark if it passes the filter, printing and recording its
+// result; returns 1 if it was run, 0 otherwise
+//  _opts   :   options
+//  _b      :   benchmark definition
+//  _r      :   result (may be NULL)
+int benchmark_run(const struct benchmark_opts_s * _opts,
+                  const struct benchmark_s *      _b,
+                  struct benchmark_result_s *     _r);
+
+// write result to results file and compare it against the baseline,
+// reporting a significant slowdown as a regression
+//  _opts   :   options
+//  _b      :   benchmark definition (kernel is not used)
+//  _r      :   result
+void benchmark_record(const struct benchmark_opts_s *   _opts,
+                      const struct benchmark_s *        _b,
+                      const struct benchmark_result_s * _r);
+
+// close results file and summarize comparison; returns the program exit
+// status: 1 if any regression was found, 0 otherwise
+//  _opts   :   options
+int benchmark_finish(const struct benchmark_opts_s * _opts);
+
+#endif // __LIQUID_WLAN_BENCHMARK_H__
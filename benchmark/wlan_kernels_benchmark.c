@@ -0,0 +1,440 @@
+// Benchmark individual transmit and receive kernels across data rates
+// and payload lengths
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <complex.h>
+#include <liquid/liquid.h>
+
+#include "liquid-wlan.internal.h"
+#include "benchmark.h"
+
+// maximum payload length (bytes)
+#define LENGTH_MAX  (4095)
+
+// kernel state
+struct kernel_context_s {
+    unsigned int    rate;           // data rate
+    unsigned int    length;         // payload length (bytes)
+    unsigned int    fec_scheme;     // convolutional code
+    unsigned int    mod_scheme;     // modulation scheme
+    unsigned int    nbpsc;          // coded bits per subcarrier
+    unsigned int    nsym;           // number of DATA symbols
+    unsigned int    dec_msg_len;    // decoded length incl. SERVICE, tail and pad (bytes)
+    unsigned int    enc_msg_len;    // encoded length (bytes)
+
+    unsigned char * msg_org;        // payload [size: LENGTH_MAX]
+    unsigned char * msg_dec;        // decoded message
+    unsigned char * msg_enc;        // encoded message
+    unsigned char * msg_int;        // interleaved message
+    unsigned char * soft;           // soft bits, one per coded bit
+    unsigned char * syms;           // modem symbols
+    float complex * x;              // samples [size: 64]
+    float complex * G;              // gains [size: 64]
+    int16_t *       x_q15;          // fixed-point samples [size: 128]
+    int32_t         weight;         // soft demodulation weight
+    wlanframesync   fs;             // synchronizer (S1, rxdata kernels)
+    wlan_fft        fft;            // transform (FFT kernels)
+};
+
+// set rate- and length-dependent parameters, encoding the payload
+static void kernel_context_set(struct kernel_context_s * _c,
+                               unsigned int              _rate,
+                               unsigned int              _length)
+{
+    _c->rate        = _rate;
+    _c->length      = _length;
+    _c->fec_scheme  = wlanframe_ratetab[_rate].fec_scheme;
+    _c->mod_scheme  = wlanframe_ratetab[_rate].mod_scheme;
+    _c->nbpsc       = wlanframe_ratetab[_rate].nbpsc;
+    unsigned int ndbps = wlanframe_ratetab[_rate].ndbps;
+    _c->nsym        = (16 + 8*_length + 6 + ndbps - 1) / ndbps;
+    _c->dec_msg_len = _c->nsym * ndbps / 8;
+    _c->enc_msg_len = wlan_packet_compute_enc_msg_len(_rate, _length);
+
+    // packet codec requires whole bytes per OFDM symbol, which rate 9 M
+    // bits/s (36 data bits) does not have; only symbol kernels apply
+    unsigned int i;
+    if (ndbps % 8 == 0) {
+        wlan_packet_encode(_rate, 0x5d, _length, _c->msg_org, _c->msg_int);
+        wlan_fec_encode(_c->fec_scheme, _c->dec_msg_len, _c->msg_org, _c->msg_enc);
+        for (i=0; i<8*_c->enc_msg_len; i++)
+            _c->soft[i] = (_c->msg_enc[i/8] >> (7-(i%8))) & 1 ? LIQUID_WLAN_SOFTBIT_1 : LIQUID_WLAN_SOFTBIT_0;
+    }
+    for (i=0; i<48*_c->nsym; i++)
+        _c->syms[i] = rand() & ((1 << _c->nbpsc) - 1);
+    for (i=0; i<64; i++)
+        _c->x[i] = wlan_modulate(_c->mod_scheme, _c->syms[i % 48]);
+    _c->weight = wlan_demodulate_soft_weight(_c->mod_scheme, 1.0f);
+}
+
+//
+// kernels
+//
+
+static void kernel_scramble(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_data_scramble(c->msg_org, c->msg_dec, c->dec_msg_len, 0x5d);
+}
+
+static void kernel_fec_encode(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_fec_encode(c->fec_scheme, c->dec_msg_len, c->msg_org, c->msg_enc);
+}
+
+static void kernel_viterbi(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_fec_decode(c->fec_scheme, c->dec_msg_len, c->msg_enc, c->msg_dec);
+}
+
+static void kernel_viterbi_soft(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_fec_decode_soft(c->fec_scheme, c->dec_msg_len, c->soft, c->msg_dec);
+}
+
+static void kernel_interleave(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_interleaver_encode_symbol(c->rate, c->msg_enc, c->msg_int);
+}
+
+static void kernel_deinterleave(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_interleaver_decode_symbol(c->rate, c->msg_int, c->msg_dec);
+}
+
+static void kernel_deinterleave_soft(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_interleaver_decode_symbol_soft(c->rate, c->soft, &c->soft[288]);
+}
+
+static void kernel_modulate(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    unsigned int k;
+    for (i=0; i<_n; i++) {
+        for (k=0; k<48; k++)
+            c->x[k] = wlan_modulate(c->mod_scheme, c->syms[k]);
+    }
+}
+
+static void kernel_demodulate(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    unsigned int k;
+    for (i=0; i<_n; i++) {
+        for (k=0; k<48; k++)
+            c->syms[k] = wlan_demodulate(c->mod_scheme, c->x[k]);
+    }
+}
+
+static void kernel_demodulate_soft(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    unsigned int k;
+    for (i=0; i<_n; i++) {
+        for (k=0; k<48; k++) {
+            wlan_demodulate_soft(c->mod_scheme,
+                                 (int32_t)(4096*crealf(c->x[k])),
+                                 (int32_t)(4096*cimagf(c->x[k])),
+                                 c->weight, &c->soft[k*c->nbpsc]);
+        }
+    }
+}
+
+static void kernel_repack(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    unsigned int num_written;
+    for (i=0; i<_n; i++) {
+        liquid_wlan_repack_bytes(c->msg_enc, 8, c->enc_msg_len,
+                                 c->syms, c->nbpsc, 48*c->nsym, &num_written);
+    }
+}
+
+static void kernel_packet_encode(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_packet_encode(c->rate, 0x5d, c->length, c->msg_org, c->msg_int);
+}
+
+static void kernel_packet_decode(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_packet_decode(c->rate, 0x5d, c->length, c->msg_int, c->msg_dec);
+}
+
+static void kernel_packet_decode_soft(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_packet_decode_soft(c->rate, 0x5d, c->length, c->soft, c->msg_dec);
+}
+
+static void kernel_gain_S0(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlanframesync_estimate_gain_S0(c->x, c->G);
+}
+
+static void kernel_gain_S1(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlanframesync_estimate_gain_S1(c->fs, c->x, c->G);
+}
+
+static void kernel_rxdata_symbol(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlanframesync_rxdata_symbol(c->fs);
+}
+
+static void kernel_rxdata_symbol_q15(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlanframesync_rxdata_symbol_q15(c->fs);
+}
+
+static void kernel_fft(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_fft_execute(c->fft);
+}
+
+static void kernel_fft_q15(void * _context, unsigned long int _n)
+{
+    struct kernel_context_s * c = (struct kernel_context_s*) _context;
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        wlan_fft64_q15(c->x_q15);
+}
+
+// create synchronizer whose state reflects a received frame at the
+// given rate, leaving noise in its input buffer
+static wlanframesync kernel_prime_framesync(struct kernel_context_s * _c,
+                                            int                       _profile)
+{
+    struct wlan_txvector_s txvector;
+    txvector.LENGTH      = 100;
+    txvector.DATARATE    = _c->rate;
+    txvector.SERVICE     = 0;
+    txvector.TXPWR_LEVEL = 0;
+    wlanframegen fg = wlanframegen_create();
+    wlanframegen_assemble(fg, _c->msg_org, txvector);
+    unsigned int n = wlanframegen_get_num_samples(fg);
+    float complex * buf = (float complex*) calloc(n + 400, sizeof(float complex));
+    wlanframegen_write_frame(fg, &buf[200], n);
+    wlanframegen_destroy(fg);
+    unsigned int i;
+    for (i=0; i<n+400; i++)
+        buf[i] += 0.01f*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+    wlanframesync fs = wlanframesync_create(NULL, NULL);
+    wlanframesync_set_profile(fs, _profile);
+    wlanframesync_execute(fs, buf, n + 400);
+    free(buf);
+    return fs;
+}
+
+int main(int argc, char*argv[])
+{
+    struct benchmark_opts_s opts;
+    benchmark_opts_init(&opts, argc, argv);
+
+    // sweep
+    unsigned int rates_all[8]   = {WLANFRAME_RATE_6,  WLANFRAME_RATE_9,  WLANFRAME_RATE_12,
+                                   WLANFRAME_RATE_18, WLANFRAME_RATE_24, WLANFRAME_RATE_36,
+                                   WLANFRAME_RATE_48, WLANFRAME_RATE_54};
+    unsigned int rates_quick[2] = {WLANFRAME_RATE_6, WLANFRAME_RATE_54};
+    unsigned int lengths_all[4]   = {14, 100, 1500, 4095};
+    unsigned int lengths_quick[1] = {100};
+    unsigned int * rates   = opts.quick ? rates_quick   : rates_all;
+    unsigned int * lengths = opts.quick ? lengths_quick : lengths_all;
+    unsigned int num_rates   = opts.quick ? 2 : 8;
+    unsigned int num_lengths = opts.quick ? 1 : 4;
+
+    // allocate buffers for longest payload
+    struct kernel_context_s c;
+    unsigned int enc_len_max = wlan_packet_compute_enc_msg_len_max(LENGTH_MAX);
+    c.msg_org = (unsigned char*) malloc(LENGTH_MAX + 64);
+    c.msg_dec = (unsigned char*) malloc(LENGTH_MAX + 64);
+    c.msg_enc = (unsigned char*) malloc(enc_len_max);
+    c.msg_int = (unsigned char*) malloc(enc_len_max);
+    c.soft    = (unsigned char*) malloc(8*enc_len_max);
+    c.syms    = (unsigned char*) malloc(8*enc_len_max);
+    c.x       = (float complex*) malloc(64*sizeof(float complex));
+    c.G       = (float complex*) malloc(64*sizeof(float complex));
+    c.x_q15   = (int16_t*) malloc(128*sizeof(int16_t));
+    unsigned int i;
+    for (i=0; i<LENGTH_MAX + 64; i++)
+        c.msg_org[i] = rand() & 0xff;
+    for (i=0; i<128; i++)
+        c.x_q15[i] = (int16_t)((rand() & 0x3fff) - 0x2000);
+
+    benchmark_print_header();
+    unsigned int r;
+    unsigned int l;
+    struct benchmark_s b;
+
+    // payload-level kernels
+    for (l=0; l<num_lengths; l++) {
+        kernel_context_set(&c, WLANFRAME_RATE_6, lengths[l]);
+        struct benchmark_s bs = {"scramble", BENCHMARK_RATE_NONE, lengths[l],
+                                 lengths[l], 0, 0, kernel_scramble, &c};
+        benchmark_run(&opts, &bs, NULL);
+    }
+    struct {
+        const char *     name;
+        benchmark_kernel kernel;
+    } packet_kernels[7] = {
+        {"fec_encode",          kernel_fec_encode},
+        {"viterbi",             kernel_viterbi},
+        {"viterbi_soft",        kernel_viterbi_soft},
+        {"repack",              kernel_repack},
+        {"packet_encode",       kernel_packet_encode},
+        {"packet_decode",       kernel_packet_decode},
+        {"packet_decode_soft",  kernel_packet_decode_soft},
+    };
+    unsigned int k;
+    for (k=0; k<7; k++) {
+        for (r=0; r<num_rates; r++) {
+            // packet codec does not support rate 9 M bits/s
+            if (rates[r] == WLANFRAME_RATE_9)
+                continue;
+            for (l=0; l<num_lengths; l++) {
+                kernel_context_set(&c, rates[r], lengths[l]);
+                b.name    = packet_kernels[k].name;
+                b.rate    = rates[r];
+                b.length  = lengths[l];
+                b.bytes   = lengths[l];
+                b.symbols = c.nsym;
+                b.samples = 0;
+                b.kernel  = packet_kernels[k].kernel;
+                b.context = &c;
+                benchmark_run(&opts, &b, NULL);
+            }
+        }
+    }
+
+    // symbol-level kernels
+    struct {
+        const char *     name;
+        benchmark_kernel kernel;
+    } symbol_kernels[6] = {
+        {"interleave",          kernel_interleave},
+        {"deinterleave",        kernel_deinterleave},
+        {"deinterleave_soft",   kernel_deinterleave_soft},
+        {"modulate",            kernel_modulate},
+        {"demodulate",          kernel_demodulate},
+        {"demodulate_soft",     kernel_demodulate_soft},
+    };
+    for (k=0; k<6; k++) {
+        for (r=0; r<num_rates; r++) {
+            kernel_context_set(&c, rates[r], 100);
+            b.name    = symbol_kernels[k].name;
+            b.rate    = rates[r];
+            b.length  = 0;
+            b.bytes   = wlanframe_ratetab[rates[r]].ndbps / 8.0;
+            b.symbols = 1;
+            b.samples = 0;
+            b.kernel  = symbol_kernels[k].kernel;
+            b.context = &c;
+            benchmark_run(&opts, &b, NULL);
+        }
+    }
+
+    // receiver kernels
+    kernel_context_set(&c, WLANFRAME_RATE_6, 100);
+    c.fs = wlanframesync_create(NULL, NULL);
+    struct benchmark_s b_S0 = {"estimate_gain_S0", BENCHMARK_RATE_NONE, 0, 0, 1, 64, kernel_gain_S0, &c};
+    struct benchmark_s b_S1 = {"estimate_gain_S1", BENCHMARK_RATE_NONE, 0, 0, 1, 64, kernel_gain_S1, &c};
+    benchmark_run(&opts, &b_S0, NULL);
+    benchmark_run(&opts, &b_S1, NULL);
+    wlanframesync_destroy(c.fs);
+    for (k=0; k<2; k++) {
+        for (r=0; r<num_rates; r++) {
+            // rate 9 M bits/s frames cannot be generated
+            if (rates[r] == WLANFRAME_RATE_9)
+                continue;
+            kernel_context_set(&c, rates[r], 100);
+            c.fs = kernel_prime_framesync(&c, k ? WLANFRAMESYNC_PROFILE_Q15 : WLANFRAMESYNC_PROFILE_FLOAT);
+            b.name    = k ? "rxdata_symbol_q15" : "rxdata_symbol";
+            b.rate    = rates[r];
+            b.length  = 0;
+            b.bytes   = wlanframe_ratetab[rates[r]].ndbps / 8.0;
+            b.symbols = 1;
+            b.samples = 80;
+            b.kernel  = k ? kernel_rxdata_symbol_q15 : kernel_rxdata_symbol;
+            b.context = &c;
+            benchmark_run(&opts, &b, NULL);
+            wlanframesync_destroy(c.fs);
+        }
+    }
+
+    // transforms, per backend
+    const char * fft_names[3]    = {"fft64_builtin", "fft64_liquid", "fft64_fftw"};
+    int          fft_backends[3] = {LIQUID_WLAN_FFT_BUILTIN, LIQUID_WLAN_FFT_LIQUID, LIQUID_WLAN_FFT_FFTW};
+    for (k=0; k<3; k++) {
+        if (liquid_wlan_fft_set_backend(fft_backends[k]) != 0)
+            continue;
+        c.fft = wlan_fft_create(64, c.x, c.G, WLAN_FFT_FORWARD);
+        struct benchmark_s bf = {fft_names[k], BENCHMARK_RATE_NONE, 0, 0, 1, 64, kernel_fft, &c};
+        benchmark_run(&opts, &bf, NULL);
+        wlan_fft_destroy(c.fft);
+    }
+    liquid_wlan_fft_set_backend(LIQUID_WLAN_FFT_AUTO);
+    struct benchmark_s bq = {"fft64_q15", BENCHMARK_RATE_NONE, 0, 0, 1, 64, kernel_fft_q15, &c};
+    benchmark_run(&opts, &bq, NULL);
+
+    free(c.msg_org);
+    free(c.msg_dec);
+    free(c.msg_enc);
+    free(c.msg_int);
+    free(c.soft);
+    free(c.syms);
+    free(c.x);
+    free(c.G);
+    free(c.x_q15);
+    return benchmark_finish(&opts);
+}
@@ -0,0 +1,354 @@
+// End-to-end loopback benchmark: frames are generated at each data rate
+// and payload length, passed through a channel with multipath, carrier
+// frequency offset and noise, and received. Reported are the decoded
+// payload throughput per core, the processing time per frame for each
+// phase, and the packet error rate.
+//
+// Phases (thread CPU time per frame):
+//   gen    : frame generation
+//   chan   : channel emulation
+//   sync   : receiver up to the decoded SIGNAL field (detection, timing,
+//            CFO and channel estimation, header decoding), including the
+//            noise searched before the frame
+//   data   : receiver from the decoded SIGNAL field to the payload
+//            callback (DATA symbols, deinterleaving, decoding)
+//   tail   : receiver after the payload callback (searching trailing noise)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <complex.h>
+#include <getopt.h>
+#include <time.h>
+#include <liquid/liquid.h>
+#include "liquid-wlan.h"
+#include "benchmark.h"
+
+void usage()
+{
+    printf("Usage: wlan_loopback_benchmark [OPTION]\n");
+    printf(" -h         : print help\n");
+    printf(" -n <num>   : frames per rate and length,            default: 20\n");
+    printf(" -s <snr>   : signal-to-noise ratio (dB),            default: 30\n");
+    printf(" -F <dphi>  : max carrier frequency offset (rad),    default: 0.03\n");
+    printf(" -M <len>   : multipath channel length (0: AWGN),    default: 4\n");
+    printf(" -r <rate>  : only rate {6,12,18,24,36,48,54} M bits/s\n");
+    printf(" -L <len>   : only payload length (bytes)\n");
+    printf(" -c <est>   : channel estimator {poly,lts,dft},      default: lts\n");
+    printf(" -p <prof>  : receive profile {float,q15},           default: float\n");
+    printf(" -S <seed>  : random seed,                           default: 1\n");
+    printf(" -q         : quick run (reduced sweep, few frames)\n");
+    printf(" -o <file>  : write receiver results (.json: JSON, otherwise CSV)\n");
+    printf(" -b <file>  : compare against baseline results (CSV)\n");
+    printf(" -T <frac>  : minimum slowdown reported as regression, default: 0.10\n");
+}
+
+// rates in M bits/s, indexed by WLANFRAME_RATE_*
+static const unsigned int rate_mbps[8] = {6, 9, 12, 18, 24, 36, 48, 54};
+
+// receiver state for a single frame
+struct loopback_rx_s {
+    unsigned char * payload;        // transmitted payload
+    unsigned int    length;         // transmitted payload length
+    unsigned int    rate;           // transmitted data rate
+    int             header_decoded; // SIGNAL field decoded with expected values
+    int             frame_valid;    // payload received without error
+    double          t_header;       // thread CPU time at header callback [s]
+    double          t_frame;        // thread CPU time at payload callback [s]
+};
+
+static int compare_double(const void * _a, const void * _b)
+{
+    double a = *(const double*)_a;
+    double b = *(const double*)_b;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// thread CPU time [s]
+static double cputime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+static int header_callback(struct wlan_rxvector_s _rxvector,
+                           framesyncstats_s       _stats,
+                           void *                 _userdata)
+{
+    struct loopback_rx_s * rx = (struct loopback_rx_s*) _userdata;
+    if (_rxvector.LENGTH == rx->length && _rxvector.DATARATE == rx->rate) {
+        rx->header_decoded = 1;
+        rx->t_header       = cputime();
+    }
+    return WLANFRAMESYNC_HEADER_DECODE;
+}
+
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
+{
+    struct loopback_rx_s * rx = (struct loopback_rx_s*) _userdata;
+    if (!_header_valid || _rxvector.LENGTH != rx->length || _rxvector.DATARATE != rx->rate)
+        return 0;
+    rx->frame_valid = memcmp(_payload, rx->payload, rx->length) == 0;
+    rx->t_frame     = cputime();
+    return 0;
+}
+
+int main(int argc, char*argv[])
+{
+    // options
+    unsigned int num_frames  = 20;      // frames per rate and length
+    float        SNRdB       = 30.0f;   // signal-to-noise ratio [dB]
+    float        cfo_max     = 0.03f;   // maximum carrier frequency offset [rad/sample]
+    unsigned int channel_len = 4;       // multipath channel length (0: AWGN)
+    int          only_rate   = -1;      // single rate (-1: all)
+    int          only_length = -1;      // single payload length (-1: all)
+    int          chanest     = WLANFRAMESYNC_CHANEST_LTS;
+    int          profile     = WLANFRAMESYNC_PROFILE_FLOAT;
+    unsigned int seed        = 1;
+    int          quick       = 0;
+    struct benchmark_opts_s opts;       // results and baseline
+    benchmark_opts_default(&opts);
+
+    int dopt;
+    while ((dopt = getopt(argc,argv,"hn:s:F:M:r:L:c:p:S:qo:b:T:")) != EOF) {
+        switch (dopt) {
+        case 'h': usage();                          return 0;
+        case 'n': num_frames  = atoi(optarg);       break;
+        case 's': SNRdB       = atof(optarg);       break;
+        case 'F': cfo_max     = atof(optarg);       break;
+        case 'M': channel_len = atoi(optarg);       break;
+        case 'r':
+            for (only_rate=0; only_rate<8; only_rate++) {
+                if (rate_mbps[only_rate] == (unsigned int)atoi(optarg))
+                    break;
+            }
+            if (only_rate == 8 || only_rate == WLANFRAME_RATE_9) {
+                fprintf(stderr,"error: %s, invalid rate '%s'\n", argv[0], optarg);
+                exit(1);
+            }
+            break;
+        case 'L': only_length = atoi(optarg);       break;
+        case 'c':
+            if      (strcmp(optarg,"poly")==0) chanest = WLANFRAMESYNC_CHANEST_POLY;
+            else if (strcmp(optarg,"lts" )==0) chanest = WLANFRAMESYNC_CHANEST_LTS;
+            else if (strcmp(optarg,"dft" )==0) chanest = WLANFRAMESYNC_CHANEST_DFT;
+            else {
+                fprintf(stderr,"error: %s, invalid channel estimator '%s'\n", argv[0], optarg);
+                exit(1);
+            }
+            break;
+        case 'p':
+            if      (strcmp(optarg,"float")==0) profile = WLANFRAMESYNC_PROFILE_FLOAT;
+            else if (strcmp(optarg,"q15"  )==0) profile = WLANFRAMESYNC_PROFILE_Q15;
+            else {
+                fprintf(stderr,"error: %s, invalid receive profile '%s'\n", argv[0], optarg);
+                exit(1);
+            }
+            break;
+        case 'S': seed        = atoi(optarg);       break;
+        case 'q': quick       = 1;                  break;
+        case 'o': opts.output    = optarg;          break;
+        case 'b': opts.baseline  = optarg;          break;
+        case 'T': opts.threshold = atof(optarg);    break;
+        default:
+            exit(1);
+        }
+    }
+    if (num_frames == 0) {
+        fprintf(stderr,"error: %s, number of frames must be at least 1\n", argv[0]);
+        exit(1);
+    } else if (channel_len > 16) {
+        fprintf(stderr,"error: %s, multipath channel length cannot exceed cyclic prefix (16)\n", argv[0]);
+        exit(1);
+    } else if (only_length == 0 || only_length > 4095) {
+        fprintf(stderr,"error: %s, payload length must be in [1,4095]\n", argv[0]);
+        exit(1);
+    }
+    srand(seed);
+    benchmark_start(&opts);
+
+    // sweep (rate 9 M bits/s is not supported by the frame generator)
+    unsigned int rates_all[7]   = {WLANFRAME_RATE_6,  WLANFRAME_RATE_12, WLANFRAME_RATE_18,
+                                   WLANFRAME_RATE_24, WLANFRAME_RATE_36, WLANFRAME_RATE_48,
+                                   WLANFRAME_RATE_54};
+    unsigned int rates_quick[2] = {WLANFRAME_RATE_6, WLANFRAME_RATE_54};
+    unsigned int lengths_all[5]   = {14, 100, 500, 1500, 4095};
+    unsigned int lengths_quick[1] = {100};
+    unsigned int * rates   = quick ? rates_quick   : rates_all;
+    unsigned int * lengths = quick ? lengths_quick : lengths_all;
+    unsigned int num_rates   = quick ? 2 : 7;
+    unsigned int num_lengths = quick ? 1 : 5;
+    if (quick && num_frames > 3)
+        num_frames = 3;
+    if (only_rate >= 0) {
+        rates     = (unsigned int*)&only_rate;
+        num_rates = 1;
+    }
+    if (only_length > 0) {
+        lengths     = (unsigned int*)&only_length;
+        num_lengths = 1;
+    }
+
+    // channel
+    float noise_floor = -40.0f;         // noise floor [dB]
+    float nstd  = powf(10.0f, noise_floor/20.0f);
+    float gamma = powf(10.0f, (SNRdB + noise_floor)/20.0f);
+    nco_crcf nco = nco_crcf_create(LIQUID_VCO);
+
+    // buffers, sized for longest frame
+    unsigned int    pad     = 456;      // maximum noise before and after frame
+    unsigned int    buf_len = 80*(5 + 1366 + 1) + 2*pad;
+    float complex * buf     = (float complex*) malloc(buf_len*sizeof(float complex));
+    unsigned char   payload[4095];
+    double *        ns_rx   = (double*) malloc(num_frames*sizeof(double));
+
+    struct loopback_rx_s rx;
+    rx.payload = payload;
+    wlanframegen  fg = wlanframegen_create();
+    wlanframesync fs = wlanframesync_create(callback, &rx);
+    wlanframesync_set_header_callback(fs, header_callback);
+    if (wlanframesync_set_chanest(fs, chanest, 16) != 0)
+        exit(1);
+    if (wlanframesync_set_profile(fs, profile) != 0)
+        exit(1);
+
+    printf("# SNR: %.1f dB, CFO: |dphi| < %.3f rad/sample, multipath: %u taps, profile: %s\n",
+            SNRdB, cfo_max, channel_len + 1, profile == WLANFRAMESYNC_PROFILE_Q15 ? "q15" : "float");
+    printf("# %4s %5s %6s %9s %10s : %9s %9s %9s %9s %9s %9s  (us/frame)\n",
+            "rate", "len", "frames", "PER", "Mbps/core", "gen", "chan", "sync", "data", "tail", "rx");
+    unsigned int r;
+    unsigned int l;
+    unsigned int i;
+    unsigned int j;
+    unsigned int n;
+    for (r=0; r<num_rates; r++) {
+        for (l=0; l<num_lengths; l++) {
+            struct wlan_txvector_s txvector;
+            txvector.LENGTH      = lengths[l];
+            txvector.DATARATE    = rates[r];
+            txvector.SERVICE     = 0;
+            txvector.TXPWR_LEVEL = 0;
+            rx.length = lengths[l];
+            rx.rate   = rates[r];
+
+            unsigned int num_valid = 0;
+            double t_gen  = 0.0;
+            double t_chan = 0.0;
+            double t_sync = 0.0;
+            double t_data = 0.0;
+            double t_tail = 0.0;
+            double t_rx   = 0.0;
+            double num_rx_samples = 0.0;
+            for (n=0; n<num_frames; n++) {
+                // generate frame, preceded and followed by silence
+                for (i=0; i<lengths[l]; i++)
+                    payload[i] = rand() & 0xff;
+                unsigned int d0 = 200 + (rand() & 0xff);
+                unsigned int d1 = 200;
+                double t0 = cputime();
+                wlanframegen_assemble(fg, payload, txvector);
+                unsigned int frame_len = wlanframegen_get_num_samples(fg);
+                unsigned int num_samples = d0 + frame_len + d1;
+                memset(buf, 0, num_samples*sizeof(float complex));
+                wlanframegen_write_frame(fg, &buf[d0], frame_len);
+                double t1 = cputime();
+
+                // random multipath channel with exponentially decaying power
+                // profile, normalized to unit energy
+                float complex h[17];
+                float complex h_buf[17];
+                float h_energy = 0.0f;
+                for (i=0; i<=channel_len; i++) {
+                    h[i] = i==0 ? 1.0f : (randnf() + _Complex_I*randnf())*M_SQRT1_2*expf(-2.0f*(float)i/(float)channel_len);
+                    h_buf[i] = 0.0f;
+                    h_energy += crealf(h[i]*conjf(h[i]));
+                }
+                for (i=0; i<=channel_len; i++)
+                    h[i] *= gamma / sqrtf(h_energy);
+
+                // apply multipath, carrier offset and noise
+                nco_crcf_reset(nco);
+                nco_crcf_set_frequency(nco, cfo_max*(2.0f*randf() - 1.0f));
+                nco_crcf_set_phase(nco, 2.0f*M_PI*randf());
+                for (i=0; i<num_samples; i++) {
+                    for (j=channel_len; j>0; j--)
+                        h_buf[j] = h_buf[j-1];
+                    h_buf[0] = buf[i];
+                    float complex y = 0.0f;
+                    for (j=0; j<=channel_len; j++)
+                        y += h[j]*h_buf[j];
+                    nco_crcf_mix_up(nco, y, &buf[i]);
+                    nco_crcf_step(nco);
+                    buf[i] += nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+                }
+                double t2 = cputime();
+
+                // receive
+                rx.header_decoded = 0;
+                rx.frame_valid    = 0;
+                rx.t_header       = 0.0;
+                rx.t_frame        = 0.0;
+                wlanframesync_reset(fs);
+                wlanframesync_execute(fs, buf, num_samples);
+                wlanframesync_flush(fs);
+                double t3 = cputime();
+
+                // accumulate phases; a frame which is not received is
+                // accounted to synchronization
+                t_gen  += t1 - t0;
+                t_chan += t2 - t1;
+                t_rx   += t3 - t2;
+                ns_rx[n] = 1e9*(t3 - t2);
+                num_rx_samples += num_samples;
+                if (rx.header_decoded && rx.t_frame > 0.0) {
+                    t_sync += rx.t_header - t2;
+                    t_data += rx.t_frame  - rx.t_header;
+                    t_tail += t3 - rx.t_frame;
+                } else {
+                    t_sync += t3 - t2;
+                }
+                num_valid += rx.frame_valid;
+            }
+
+            float PER  = 1.0f - (float)num_valid / (float)num_frames;
+            float mbps = t_rx > 0.0 ? 8e-6*lengths[l]*num_valid / t_rx : 0.0f;
+            printf("  %4u %5u %6u %9.3f %10.3f : %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+                    rate_mbps[rates[r]], lengths[l], num_frames, PER, mbps,
+                    1e6*t_gen /num_frames, 1e6*t_chan/num_frames,
+                    1e6*t_sync/num_frames, 1e6*t_data/num_frames,
+                    1e6*t_tail/num_frames, 1e6*t_rx  /num_frames);
+            fflush(stdout);
+
+            // record receiver time per frame
+            struct benchmark_result_s result;
+            result.num_calls       = 1;
+            result.num_repetitions = num_frames;
+            result.ns_mean         = 1e9*t_rx / num_frames;
+            result.ns_stddev       = 0.0;
+            for (n=0; n<num_frames; n++)
+                result.ns_stddev += (ns_rx[n] - result.ns_mean)*(ns_rx[n] - result.ns_mean);
+            result.ns_stddev = num_frames > 1 ? sqrt(result.ns_stddev / (num_frames-1)) : 0.0;
+            qsort(ns_rx, num_frames, sizeof(double), compare_double);
+            result.ns_min    = ns_rx[0];
+            result.ns_median = num_frames % 2 ? ns_rx[num_frames/2] :
+                               0.5*(ns_rx[num_frames/2-1] + ns_rx[num_frames/2]);
+            result.cycles    = 0.0;
+            struct benchmark_s b = {"loopback_rx", (int)rates[r], lengths[l], lengths[l],
+                0, num_rx_samples / num_frames, NULL, NULL};
+            benchmark_record(&opts, &b, &result);
+        }
+    }
+
+    nco_crcf_destroy(nco);
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(fs);
+    free(buf);
+    free(ns_rx);
+    return benchmark_finish(&opts);
+}
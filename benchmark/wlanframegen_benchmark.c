@@ -1,88 +1,75 @@
+// Benchmark frame generation across data rates and payload lengths
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include <complex.h>
-#include <sys/resource.h>
 #include "liquid-wlan.h"
+#include "benchmark.h"
 
-double calculate_execution_time(struct rusage _start, struct rusage _finish)
-{
-    return _finish.ru_utime.tv_sec - _start.ru_utime.tv_sec
-        + 1e-6*(_finish.ru_utime.tv_usec - _start.ru_utime.tv_usec)
-        + _finish.ru_stime.tv_sec - _start.ru_stime.tv_sec
-        + 1e-6*(_finish.ru_stime.tv_usec - _start.ru_stime.tv_usec);
-}
+// frame generator state
+struct wlanframegen_context_s {
+    wlanframegen            fg;         // frame generator
+    struct wlan_txvector_s  txvector;   // transmit vector
+    unsigned char *         payload;    // payload
+};
 
-// Helper function to keep code base small
-void wlanframegen_benchmark(struct rusage *     _start,
-                            struct rusage *     _finish,
-                            unsigned long int * _num_iterations,
-                            unsigned int        _rate)
+// assemble and generate complete frame, one symbol at a time
+static void wlanframegen_kernel(void * _context, unsigned long int _n)
 {
-    unsigned long int i;
-    unsigned int dec_msg_len = 100;
-
-    // options
-    struct wlan_txvector_s txvector;
-    txvector.LENGTH      = dec_msg_len;
-    txvector.DATARATE    = _rate;
-    txvector.SERVICE     = 0;
-    txvector.TXPWR_LEVEL = 0;
-    
-    // create sample buffer
+    struct wlanframegen_context_s * c = (struct wlanframegen_context_s*) _context;
     float complex buffer[80];
-   
-    // initialize
-    unsigned char msg_org[dec_msg_len];
-    for (i=0; i<dec_msg_len; i++)
-        msg_org[i] = rand() & 0xff;
-
-    // create frame generator
-    wlanframegen fg = wlanframegen_create();
-
-    // sample counter
-    unsigned long int n = 0;
-
-    // start trials
-    getrusage(RUSAGE_SELF, _start);
-
-    for (i=0; i<(*_num_iterations); i++) {
-        // assemble frame
-        wlanframegen_assemble(fg, msg_org, txvector);
-
-        // generate frame
-        int last_frame = 0;
-        while (!last_frame) {
-            // write symbol to buffer
-            last_frame = wlanframegen_writesymbol(fg, buffer);
-
-            // increase sample counter
-            n += 80;
-        }
+    unsigned long int i;
+    for (i=0; i<_n; i++) {
+        wlanframegen_assemble(c->fg, c->payload, c->txvector);
+        while (!wlanframegen_writesymbol(c->fg, buffer))
+            ;
     }
-    getrusage(RUSAGE_SELF, _finish);
-
-    // set number of iterations to number of samples generated
-    *_num_iterations = n;
-
-    // destroy frame generator
-    wlanframegen_destroy(fg);
 }
 
-int main() {
-    unsigned long int n = 40000;
-    struct rusage start, finish;
-    unsigned int rate = WLANFRAME_RATE_6;
-
-    // run benchmark(s)
-    wlanframegen_benchmark(&start, &finish, &n, rate);
-
-    // compute execution time
-    float extime = calculate_execution_time(start, finish);
+int main(int argc, char*argv[])
+{
+    struct benchmark_opts_s opts;
+    benchmark_opts_init(&opts, argc, argv);
+
+    // sweep (rate 9 M bits/s is not supported by the frame generator)
+    unsigned int rates_all[7]   = {WLANFRAME_RATE_6,  WLANFRAME_RATE_12, WLANFRAME_RATE_18,
+                                   WLANFRAME_RATE_24, WLANFRAME_RATE_36, WLANFRAME_RATE_48,
+                                   WLANFRAME_RATE_54};
+    unsigned int rates_quick[2] = {WLANFRAME_RATE_6, WLANFRAME_RATE_54};
+    unsigned int lengths_all[4]   = {14, 100, 1500, 4095};
+    unsigned int lengths_quick[1] = {100};
+    unsigned int * rates   = opts.quick ? rates_quick   : rates_all;
+    unsigned int * lengths = opts.quick ? lengths_quick : lengths_all;
+    unsigned int num_rates   = opts.quick ? 2 : 7;
+    unsigned int num_lengths = opts.quick ? 1 : 4;
+
+    struct wlanframegen_context_s c;
+    c.fg      = wlanframegen_create();
+    c.payload = (unsigned char*) malloc(4095);
+    unsigned int i;
+    for (i=0; i<4095; i++)
+        c.payload[i] = rand() & 0xff;
+
+    benchmark_print_header();
+    unsigned int r;
+    unsigned int l;
+    for (r=0; r<num_rates; r++) {
+        for (l=0; l<num_lengths; l++) {
+            c.txvector.LENGTH      = lengths[l];
+            c.txvector.DATARATE    = rates[r];
+            c.txvector.SERVICE     = 0;
+            c.txvector.TXPWR_LEVEL = 0;
+            wlanframegen_assemble(c.fg, c.payload, c.txvector);
+            unsigned int num_samples = wlanframegen_get_num_samples(c.fg);
+
+            struct benchmark_s b = {"wlanframegen", (int)rates[r], lengths[l],
+                lengths[l], num_samples/80.0, num_samples, wlanframegen_kernel, &c};
+            benchmark_run(&opts, &b, NULL);
+        }
+    }
 
-    // print results
-    printf("%-24s : time : %8.5f s, iterations : %8lu (%10.4e samples/s)\n", "wlanframegen", extime, n, (float)n/extime);
-    
-    return 0;
+    wlanframegen_destroy(c.fg);
+    free(c.payload);
+    return benchmark_finish(&opts);
 }
-
@@ -1,63 +1,116 @@
+// Benchmark frame synchronization on noise and on complete frames across
+// data rates and payload lengths
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include <complex.h>
-#include <sys/resource.h>
 #include <liquid/liquid.h>
 #include "liquid-wlan.h"
+#include "benchmark.h"
+
+// frame synchronizer state
+struct wlanframesync_context_s {
+    wlanframesync   fs;             // frame synchronizer
+    float complex * buf;            // input samples
+    unsigned int    num_samples;    // number of input samples
+    unsigned int    num_frames;     // number of frames received
+};
 
-double calculate_execution_time(struct rusage _start, struct rusage _finish)
+static int callback(int                    _header_valid,
+                    unsigned char *        _payload,
+                    struct wlan_rxvector_s _rxvector,
+                    framesyncstats_s       _stats,
+                    void *                 _userdata)
 {
-    return _finish.ru_utime.tv_sec - _start.ru_utime.tv_sec
-        + 1e-6*(_finish.ru_utime.tv_usec - _start.ru_utime.tv_usec)
-        + _finish.ru_stime.tv_sec - _start.ru_stime.tv_sec
-        + 1e-6*(_finish.ru_stime.tv_usec - _start.ru_stime.tv_usec);
+    (*(unsigned int*)_userdata)++;
+    return 0;
 }
 
-// Helper function to keep code base small
-void wlanframesync_benchmark(struct rusage *     _start,
-                             struct rusage *     _finish,
-                             unsigned long int * _num_iterations,
-                             unsigned int        _rate)
+static void wlanframesync_kernel(void * _context, unsigned long int _n)
 {
-    // create buffer (full of noise)
-    unsigned int n = 800;
-    float complex buffer[n];
-
+    struct wlanframesync_context_s * c = (struct wlanframesync_context_s*) _context;
     unsigned long int i;
-    for (i=0; i<n; i++) {
-        buffer[i] = 0.001f*( randnf() + _Complex_I*randnf() )*M_SQRT1_2;
+    for (i=0; i<_n; i++) {
+        wlanframesync_execute(c->fs, c->buf, c->num_samples);
+        wlanframesync_flush(c->fs);
     }
+}
 
-    // create frame synchronizer
-    wlanframesync fs = wlanframesync_create(NULL, NULL);
+// add noise to buffer
+static void add_noise(float complex * _buf, unsigned int _n, float _nstd)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _buf[i] += _nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+}
 
-    // start trials
-    getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        wlanframesync_execute(fs, buffer, n);
-    }
-    getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= n;
+int main(int argc, char*argv[])
+{
+    struct benchmark_opts_s opts;
+    benchmark_opts_init(&opts, argc, argv);
 
-    // destroy frame sync
-    wlanframesync_destroy(fs);
-}
+    // sweep (rate 9 M bits/s is not supported by the frame generator)
+    unsigned int rates_all[7]   = {WLANFRAME_RATE_6,  WLANFRAME_RATE_12, WLANFRAME_RATE_18,
+                                   WLANFRAME_RATE_24, WLANFRAME_RATE_36, WLANFRAME_RATE_48,
+                                   WLANFRAME_RATE_54};
+    unsigned int rates_quick[2] = {WLANFRAME_RATE_6, WLANFRAME_RATE_54};
+    unsigned int lengths_all[4]   = {14, 100, 1500, 4095};
+    unsigned int lengths_quick[1] = {100};
+    unsigned int * rates   = opts.quick ? rates_quick   : rates_all;
+    unsigned int * lengths = opts.quick ? lengths_quick : lengths_all;
+    unsigned int num_rates   = opts.quick ? 2 : 7;
+    unsigned int num_lengths = opts.quick ? 1 : 4;
 
-int main() {
-    unsigned long int n = 20000;
-    struct rusage start, finish;
-    unsigned int rate = WLANFRAME_RATE_6;
+    struct wlanframesync_context_s c;
+    c.num_frames = 0;
+    c.fs = wlanframesync_create(callback, &c.num_frames);
 
-    // run benchmark(s)
-    wlanframesync_benchmark(&start, &finish, &n, rate);
+    benchmark_print_header();
 
-    // compute execution time
-    float extime = calculate_execution_time(start, finish);
+    // noise only (searching for frames)
+    c.num_samples = 800;
+    c.buf = (float complex*) calloc(c.num_samples, sizeof(float complex));
+    add_noise(c.buf, c.num_samples, 0.001f);
+    struct benchmark_s b_noise = {"wlanframesync_noise", BENCHMARK_RATE_NONE, 0,
+        0, 0, c.num_samples, wlanframesync_kernel, &c};
+    benchmark_run(&opts, &b_noise, NULL);
+    free(c.buf);
 
-    // print results
-    printf("%-24s : time : %8.5f s, iterations : %8lu (%10.4e samples/s)\n", "wlanframesync", extime, n, (float)n/extime);
-    
-    return 0;
-}
+    // complete frames, preceded and followed by noise
+    wlanframegen fg = wlanframegen_create();
+    unsigned char * payload = (unsigned char*) malloc(4095);
+    unsigned int i;
+    for (i=0; i<4095; i++)
+        payload[i] = rand() & 0xff;
+    unsigned int r;
+    unsigned int l;
+    for (r=0; r<num_rates; r++) {
+        for (l=0; l<num_lengths; l++) {
+            struct wlan_txvector_s txvector;
+            txvector.LENGTH      = lengths[l];
+            txvector.DATARATE    = rates[r];
+            txvector.SERVICE     = 0;
+            txvector.TXPWR_LEVEL = 0;
+            wlanframegen_assemble(fg, payload, txvector);
+            unsigned int frame_len = wlanframegen_get_num_samples(fg);
+            c.num_samples = frame_len + 400;
+            c.buf = (float complex*) calloc(c.num_samples, sizeof(float complex));
+            wlanframegen_write_frame(fg, &c.buf[200], frame_len);
+            add_noise(c.buf, c.num_samples, 0.01f);
 
+            c.num_frames = 0;
+            struct benchmark_s b = {"wlanframesync", (int)rates[r], lengths[l],
+                lengths[l], frame_len/80.0, c.num_samples, wlanframesync_kernel, &c};
+            if (benchmark_run(&opts, &b, NULL) && c.num_frames == 0)
+                fprintf(stderr,"warning: %s, no frames received (rate %u, length %u)\n",
+                        argv[0], rates[r], lengths[l]);
+            free(c.buf);
+        }
+    }
+
+    wlanframegen_destroy(fg);
+    wlanframesync_destroy(c.fs);
+    free(payload);
+    return benchmark_finish(&opts);
+}
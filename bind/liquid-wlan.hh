@@ -0,0 +1,55 @@
+// common definitions for C++ bindings
+#ifndef __LIQUID_WLAN_HH__
+#define __LIQUID_WLAN_HH__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+#   if __has_include(<span>)
+#       include <span>
+#   endif
+#endif
+
+namespace liquid {
+namespace wlan {
+
+#if defined(__cpp_lib_span)
+// contiguous array view
+template<class T> using span = std::span<T>;
+#else
+// contiguous array view (subset of std::span for pre-C++20 builds)
+template<class T>
+class span
+{
+  public:
+    span() : p(nullptr), n(0) {}
+    span(T * _p, std::size_t _n) : p(_p), n(_n) {}
+
+    // view of built-in array
+    template<std::size_t N>
+    span(T (&_a)[N]) : p(_a), n(N) {}
+
+    // view of contiguous container (std::vector, std::array, ...)
+    template<class C, class = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<C&>().data()), T*>::value>::type>
+    span(C && _c) : p(_c.data()), n(_c.size()) {}
+
+    T *         data()  const { return p; }
+    std::size_t size()  const { return n; }
+    bool        empty() const { return n == 0; }
+    T *         begin() const { return p; }
+    T *         end()   const { return p + n; }
+    T &         operator[](std::size_t _i) const { return p[_i]; }
+
+  private:
+    T *         p;
+    std::size_t n;
+};
+#endif
+
+} // namespace wlan
+} // namespace liquid
+
+#endif // __LIQUID_WLAN_HH__
@@ -3,69 +3,210 @@
 #include <string.h>
 #include <math.h>
 #include <assert.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "wlanframegen.hh"
 
 using namespace liquid;
 
-void wlan::framegen::assemble(unsigned int _length,
-                              unsigned int _datarate,
-                              unsigned int _service,
-                              unsigned int _txpwr_level)
+#ifdef LIQUID_PYTHONLIB
+// get payload buffer, holding a reference to its memory
+static py::buffer_info py_payload_buffer(py::object _p)
 {
-    if (_length < 1 || _length > 1500)
-        throw std::invalid_argument("invalid payload size");
-
-    // for now allocate dummy packet to encode
-    unsigned char * payload = new unsigned char[_length];
-
-    // assemble internal object
-    struct wlan_txvector_s txvector;
-    txvector.LENGTH     = _length;
-    txvector.DATARATE   = _datarate;
-    txvector.SERVICE    = _service;
-    txvector.TXPWR_LEVEL= _txpwr_level;
-    wlanframegen_assemble(fg, payload, txvector);
-
-    // free temporarily-allocated memory array
-    delete [] payload;
+    if (!py::isinstance<py::buffer>(_p))
+        throw std::invalid_argument("payloads must be bytes-like objects");
+    py::buffer_info info = _p.cast<py::buffer>().request();
+    if (info.itemsize != 1 || info.ndim > 1 || (info.ndim == 1 && info.strides[0] != 1))
+        throw std::invalid_argument("payloads must be contiguous byte buffers");
+    return info;
 }
 
-#ifdef LIQUID_PYTHONLIB
-py::array_t<std::complex<float>> wlan::framegen::py_execute(unsigned int _length,
-                                                            unsigned int _datarate)
+py::array_t<std::complex<float>> wlan::framegen::py_execute(py::object   _length,
+                                                            unsigned int _datarate,
+                                                            py::object   _payload)
 {
-    // assemble frame
-    assemble(_length, _datarate);
+    // assemble frame, from payload if given
+    if (_payload.is_none()) {
+        assemble(_length.is_none() ? 200 : _length.cast<unsigned int>(), _datarate);
+    } else {
+        py::buffer_info info = py_payload_buffer(_payload);
+        size_t n = _length.is_none() ? info.size : _length.cast<unsigned int>();
+        if (n > (size_t)info.size)
+            throw std::invalid_argument("invalid payload length");
+        assemble(span<const uint8_t>((const uint8_t*)info.ptr, n), _datarate);
+    }
 
     // determine length of frame in samples
-    unsigned int frame_len = length();
+    unsigned int num_samples = wlanframegen_get_num_samples(fg);
 
     // allocate output buffer
-    py::array_t<std::complex<float>> buf(80*frame_len);
+    py::array_t<std::complex<float>> buf(num_samples);
 
     // generate frame
     std::complex<float> * p = (std::complex<float>*) buf.request().ptr;
-    for (auto i=0U; i<frame_len; i++)
-        wlanframegen_writesymbol(fg, p + i*80);
+    write_frame(p, num_samples);
 
     // pass to top-level execute method
     return buf;
 }
 
+// get per-frame parameter given either as scalar or as sequence with one
+// value per frame
+static std::vector<unsigned int> py_per_frame(py::object   _v,
+                                              size_t       _n,
+                                              const char * _name)
+{
+    std::vector<unsigned int> v(_n);
+    if (!py::isinstance<py::sequence>(_v)) {
+        std::fill(v.begin(), v.end(), _v.cast<unsigned int>());
+        return v;
+    }
+    py::sequence s = _v.cast<py::sequence>();
+    if (s.size() != _n)
+        throw std::invalid_argument(std::string(_name) + " must be a scalar or have one value per frame");
+    for (size_t i=0; i<_n; i++)
+        v[i] = s[i].cast<unsigned int>();
+    return v;
+}
+
+py::tuple wlan::framegen::py_execute_batch(py::sequence _payloads,
+                                           py::object   _datarate,
+                                           py::object   _length,
+                                           bool         _padded,
+                                           unsigned int _num_threads)
+{
+    // get payload buffers (each holds a reference to its memory)
+    size_t num_frames = _payloads.size();
+    std::vector<py::buffer_info> payloads;
+    payloads.reserve(num_frames);
+    for (size_t i=0; i<num_frames; i++)
+        payloads.push_back(py_payload_buffer(_payloads[i]));
+
+    // per-frame options
+    std::vector<unsigned int> datarate = py_per_frame(_datarate, num_frames, "datarate");
+    std::vector<unsigned int> length(num_frames);
+    if (_length.is_none()) {
+        for (size_t i=0; i<num_frames; i++)
+            length[i] = payloads[i].size;
+    } else {
+        length = py_per_frame(_length, num_frames, "length");
+    }
+
+    // validate and determine size of each frame
+    std::vector<size_t> num_samples(num_frames);
+    size_t max_samples = 0;
+    size_t total_samples = 0;
+    for (size_t i=0; i<num_frames; i++) {
+        if (datarate[i] > WLANFRAME_RATE_54 || datarate[i] == WLANFRAME_RATE_9)
+            throw std::invalid_argument("invalid data rate");
+        if (length[i] < 1 || length[i] > 4095 || length[i] > (size_t)payloads[i].size)
+            throw std::invalid_argument("invalid payload length");
+        struct wlan_txvector_s txvector;
+        txvector.LENGTH     = length[i];
+        txvector.DATARATE   = datarate[i];
+        txvector.SERVICE    = 0;
+        txvector.TXPWR_LEVEL= 1;
+        num_samples[i] = wlanframegen_get_num_samples_txvector(fg, txvector);
+        max_samples    = std::max(max_samples, num_samples[i]);
+        total_samples += num_samples[i];
+    }
+
+    // allocate output, offsets of each frame into the flattened samples
+    // (row starts, if padded), and number of samples in each frame
+    py::array_t<uint64_t> offsets(num_frames + 1);
+    py::array_t<uint64_t> lengths(num_frames);
+    uint64_t * o = offsets.mutable_data();
+    uint64_t * l = lengths.mutable_data();
+    std::vector<size_t> start(num_frames);
+    size_t n = 0;
+    for (size_t i=0; i<num_frames; i++) {
+        start[i] = _padded ? i*max_samples : n;
+        o[i]     = start[i];
+        l[i]     = num_samples[i];
+        n += num_samples[i];
+    }
+    o[num_frames] = _padded ? num_frames*max_samples : n;
+    std::vector<py::ssize_t> shape = {(py::ssize_t)num_frames, (py::ssize_t)max_samples};
+    py::array_t<std::complex<float>> samples = _padded ?
+        py::array_t<std::complex<float>>(shape) :
+        py::array_t<std::complex<float>>((py::ssize_t)total_samples);
+    std::complex<float> * y = samples.mutable_data();
+
+    // render frames on native threads, each with its own generator
+    unsigned int num_threads = _num_threads > 0 ? _num_threads :
+                               std::max(1u, std::thread::hardware_concurrency());
+    num_threads = (unsigned int) std::min((size_t)num_threads, num_frames);
+    if (num_frames > 0) {
+        py::gil_scoped_release release;
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            wlanframegen q = wlanframegen_create_output(rate, fshift);
+            size_t i;
+            while ((i = next++) < num_frames) {
+                struct wlan_txvector_s txvector;
+                txvector.LENGTH     = length[i];
+                txvector.DATARATE   = datarate[i];
+                txvector.SERVICE    = 0;
+                txvector.TXPWR_LEVEL= 1;
+                wlanframegen_assemble(q, (unsigned char*)payloads[i].ptr, txvector);
+                std::complex<float> * p = y + start[i];
+                wlanframegen_write_frame(q, p, num_samples[i]);
+                if (_padded)
+                    std::fill(p + num_samples[i], p + max_samples, std::complex<float>(0.0f));
+            }
+            wlanframegen_destroy(q);
+        };
+        std::vector<std::thread> threads;
+        for (unsigned int t=1; t<num_threads; t++)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread & t : threads)
+            t.join();
+    }
+
+    return py::make_tuple(samples, offsets, lengths);
+}
+
 void init_framegen(py::module &m)
 {
     py::class_<wlan::framegen>(m, "framegen", "Frame generator with 64-byte payload")
         .def(py::init<>())
+        .def(py::init<float,float>(),
+            "create with output stage resampling and frequency shifting frames",
+            py::arg("rate"),
+            py::arg("fshift")=0.0f)
         .def("__repr__", &wlan::framegen::repr)
         .def_property_readonly("length",
             &wlan::framegen::length,
             "get length of frame (symbols each 80 samples long)")
+        .def("reset",
+            &wlan::framegen::reset,
+            "reset frame generator object")
         .def("execute",
             &wlan::framegen::py_execute,
-            "generate a frame given header and payload",
-            py::arg("length")=200,
-            py::arg("datarate")=6)
+            "generate a frame given payload length and data rate index "
+            "(WLANFRAME_RATE_*); the payload is a bytes-like object (length "
+            "defaults to its size) or, if not given, arbitrary (length defaults "
+            "to 200 bytes)",
+            py::arg("length")=py::none(),
+            py::arg("datarate")=(unsigned int)WLANFRAME_RATE_48,
+            py::arg("payload")=py::none())
+        .def("execute_batch",
+            &wlan::framegen::py_execute_batch,
+            "generate frames from a sequence of payloads on native threads with the "
+            "GIL released; datarate (rate index, WLANFRAME_RATE_*) and length are "
+            "scalars or one per frame (length defaults to each payload's size). "
+            "Returns (samples, offsets, lengths): frames concatenated, or if padded, "
+            "as zero-padded rows; offsets [size: num_frames+1] of each frame in the "
+            "flattened samples; and the number of samples in each frame",
+            py::arg("payloads"),
+            py::arg("datarate")=(unsigned int)WLANFRAME_RATE_6,
+            py::arg("length")=py::none(),
+            py::arg("padded")=false,
+            py::arg("num_threads")=0)
         ;
 }
 #endif // LIQUID_PYTHONLIB
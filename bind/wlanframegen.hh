@@ -3,10 +3,15 @@
 #define __WLANFRAMEGEN_HH__
 
 #include <complex>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include <liquid/liquid.h>
 #include "liquid-wlan.h"
+#include "liquid-wlan.hh"
 #include "liquid-wlan.python.hh"
 
 namespace liquid {
@@ -16,12 +21,36 @@ class framegen
 {
   public:
     // default constructor
-    framegen() { fg = wlanframegen_create();  }
+    framegen() : rate(1.0f), fshift(0.0f) { fg = wlanframegen_create();  }
+
+    // constructor with output stage (rate relative to 20 M samples/s)
+    framegen(float _rate, float _fshift=0.0f) : rate(_rate), fshift(_fshift)
+        { fg = wlanframegen_create_output(_rate, _fshift); }
+
+    // not copyable: owns the generator object
+    framegen(const framegen &) = delete;
+    framegen & operator=(const framegen &) = delete;
+
+    // move constructor and assignment, leaving source empty
+    framegen(framegen && _rhs) noexcept : fg(_rhs.fg), rate(_rhs.rate), fshift(_rhs.fshift)
+        { _rhs.fg = NULL; }
+    framegen & operator=(framegen && _rhs) noexcept
+    {
+        if (this != &_rhs) {
+            if (fg != NULL) wlanframegen_destroy(fg);
+            fg     = _rhs.fg;
+            rate   = _rhs.rate;
+            fshift = _rhs.fshift;
+            _rhs.fg = NULL;
+        }
+        return *this;
+    }
 
     // destructor
-    ~framegen() { wlanframegen_destroy(fg); }
+    ~framegen() { if (fg != NULL) wlanframegen_destroy(fg); }
 
-    void reset() { }
+    // reset internal state
+    void reset() { wlanframegen_reset(fg); }
 
     // object type
     std::string type() const { return "framegen"; }
@@ -37,7 +66,31 @@ class framegen
     void assemble(unsigned int _length,
                   unsigned int _datarate = WLANFRAME_RATE_6,
                   unsigned int _service = 0,
-                  unsigned int _txpwr_level = 1);
+                  unsigned int _txpwr_level = 1)
+    {
+        // for now allocate dummy packet to encode
+        std::unique_ptr<unsigned char[]> payload(new unsigned char[_length]);
+        assemble(span<const uint8_t>(payload.get(), _length), _datarate, _service, _txpwr_level);
+    }
+
+    // assemble frame with payload; its size sets the frame length
+    void assemble(span<const uint8_t> _payload,
+                  unsigned int        _datarate = WLANFRAME_RATE_6,
+                  unsigned int        _service = 0,
+                  unsigned int        _txpwr_level = 1)
+    {
+        if (_payload.size() < 1 || _payload.size() > 1500)
+            throw std::invalid_argument("invalid payload size");
+        if (_datarate > WLANFRAME_RATE_54 || _datarate == WLANFRAME_RATE_9)
+            throw std::invalid_argument("invalid data rate");
+
+        struct wlan_txvector_s txvector;
+        txvector.LENGTH     = _payload.size();
+        txvector.DATARATE   = _datarate;
+        txvector.SERVICE    = _service;
+        txvector.TXPWR_LEVEL= _txpwr_level;
+        wlanframegen_assemble(fg, (unsigned char*)_payload.data(), txvector);
+    }
 
     /*! @brief write OFDM symbol returning flag if the frame is complete
      *  @param _buf input sample buffer, shape: (80,)
@@ -50,14 +103,75 @@ class framegen
     unsigned int length() const
         { return wlanframegen_getframelen(fg); }
 
+    /*! get length of frame in samples */
+    unsigned int num_samples() const
+        { return wlanframegen_get_num_samples(fg); }
+
+    /*! @brief write entire frame to buffer
+     *  @param _buf output sample buffer, shape: (num_samples(),)
+     *  @param _n   buffer length
+     *  @return number of samples written
+     */
+    unsigned int write_frame(std::complex<float> * _buf, unsigned int _n)
+        { return wlanframegen_write_frame(fg, _buf, _n); }
+
+    /*! @brief write entire frame to preallocated buffer
+     *  @param _buf output sample buffer, at least num_samples() long
+     *  @return number of samples written
+     */
+    unsigned int write_frame(span<std::complex<float>> _buf)
+    {
+        if (_buf.size() < num_samples())
+            throw std::length_error("output buffer shorter than frame");
+        return wlanframegen_write_frame(fg, _buf.data(), _buf.size());
+    }
+
+    /*! @brief write entire frame to container, resized to num_samples()
+     *         (re-using its capacity)
+     *  @param _buf output sample container
+     */
+    void write_frame(std::vector<std::complex<float>> & _buf)
+    {
+        _buf.resize(num_samples());
+        wlanframegen_write_frame(fg, _buf.data(), _buf.size());
+    }
+
   private:
     wlanframegen fg;
+    float        rate;      // output rate relative to 20 M samples/s
+    float        fshift;    // output frequency shift
 
 #ifdef LIQUID_PYTHONLIB
   public:
-    /*! generate frame of a fixed length and data rate */
-    py::array_t<std::complex<float>> py_execute(unsigned int _length=200,
-                                                unsigned int _datarate=6);
+    /*! @brief generate frame
+     *  @param _length      payload length (default: size of payload, or
+     *                      200 bytes without one)
+     *  @param _datarate    data rate index (WLANFRAME_RATE_*)
+     *  @param _payload     byte buffer (default: arbitrary payload)
+     */
+    py::array_t<std::complex<float>> py_execute(py::object   _length,
+                                                unsigned int _datarate,
+                                                py::object   _payload);
+
+    /*! @brief generate batch of frames from given payloads on native threads
+     *  @param _payloads    sequence of byte buffers (bytes, uint8 arrays, or
+     *                      rows of a 2-D uint8 array)
+     *  @param _datarate    data rate index (WLANFRAME_RATE_*), scalar or
+     *                      one per frame
+     *  @param _length      payload length, scalar or one per frame (default:
+     *                      length of each payload)
+     *  @param _padded      return padded 2-D array instead of ragged 1-D array
+     *  @param _num_threads number of threads (0: hardware concurrency)
+     *  @return tuple (samples, offsets, lengths): frames concatenated, or
+     *          padded frames as rows; offsets of each frame in the flattened
+     *          samples (row starts, if padded) [size: num_frames+1]; and the
+     *          number of samples in each frame [size: num_frames]
+     */
+    py::tuple py_execute_batch(py::sequence _payloads,
+                               py::object   _datarate,
+                               py::object   _length,
+                               bool         _padded,
+                               unsigned int _num_threads);
 #endif
 };
 
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+'''test frame generator bindings: batches against single frames'''
+import sys, unittest
+import numpy as np
+sys.path.extend(['.','..','./build'])
+import liquid_wlan as wlan
+
+# data rate indices (WLANFRAME_RATE_*)
+RATE_6, RATE_9, RATE_12, RATE_24, RATE_54 = 0, 1, 2, 4, 7
+
+class framegen_batch(unittest.TestCase):
+    '''execute_batch() generates the same frames as execute()'''
+    def setUp(self):
+        rng = np.random.default_rng(1)
+        self.payloads  = [rng.integers(0, 256, n, dtype=np.uint8).tobytes() for n in (100, 1, 1500, 37)]
+        self.datarates = [RATE_6, RATE_54, RATE_24, RATE_12]
+        fg = wlan.framegen()
+        self.frames = [fg.execute(datarate=r, payload=p) for p,r in zip(self.payloads, self.datarates)]
+
+    def test_ragged(self):
+        samples, offsets, lengths = wlan.framegen().execute_batch(self.payloads, datarate=self.datarates)
+        self.assertEqual(samples.ndim, 1)
+        self.assertEqual(list(lengths), [len(f) for f in self.frames])
+        self.assertEqual(list(offsets), [0] + list(np.cumsum(lengths)))
+        for i,f in enumerate(self.frames):
+            np.testing.assert_array_equal(samples[offsets[i]:offsets[i+1]], f)
+
+    def test_padded(self):
+        for num_threads in (1, 3):
+            samples, offsets, lengths = wlan.framegen().execute_batch(
+                self.payloads, datarate=self.datarates, padded=True, num_threads=num_threads)
+            num_samples = max(len(f) for f in self.frames)
+            self.assertEqual(samples.shape, (len(self.frames), num_samples))
+            self.assertEqual(list(lengths), [len(f) for f in self.frames])
+            self.assertEqual(list(offsets), [i*num_samples for i in range(len(self.frames)+1)])
+            for i,f in enumerate(self.frames):
+                np.testing.assert_array_equal(samples[i,:lengths[i]], f)
+                np.testing.assert_array_equal(samples.ravel()[offsets[i]:offsets[i]+lengths[i]], f)
+                self.assertFalse(samples[i,lengths[i]:].any())
+
+    def test_defaults(self):
+        # scalar data rate defaults to 6 M bits/s, and length to payload size
+        fg = wlan.framegen()
+        samples, offsets, lengths = fg.execute_batch(self.payloads[:2])
+        for i,p in enumerate(self.payloads[:2]):
+            np.testing.assert_array_equal(samples[offsets[i]:offsets[i+1]],
+                                          fg.execute(datarate=RATE_6, payload=p))
+
+        # shorter length encodes leading bytes of payload
+        samples, offsets, lengths = fg.execute_batch(self.payloads[2:3], length=200)
+        np.testing.assert_array_equal(samples, fg.execute(datarate=RATE_6, payload=self.payloads[2][:200]))
+        np.testing.assert_array_equal(samples, fg.execute(200, RATE_6, self.payloads[2]))
+
+    def test_empty(self):
+        samples, offsets, lengths = wlan.framegen().execute_batch([])
+        self.assertEqual(len(samples), 0)
+        self.assertEqual(list(offsets), [0])
+        self.assertEqual(len(lengths), 0)
+
+    def test_invalid(self):
+        fg = wlan.framegen()
+        for kwargs in (dict(datarate=RATE_9), dict(datarate=8), dict(length=101),
+                       dict(datarate=[RATE_6]), dict(length=[100])):
+            with self.assertRaises(ValueError):
+                fg.execute_batch(self.payloads[:1] * 2, **kwargs)
+        with self.assertRaises(ValueError):
+            fg.execute_batch([np.zeros(10, dtype=np.int16)])
+        with self.assertRaises(ValueError):
+            fg.execute(length=101, payload=self.payloads[0])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,251 @@
+// wlanframesync coroutine interface (C++20)
+//
+// A producer coroutine feeds samples with `co_await source.push(buf)` and
+// a consumer coroutine receives decoded frames with `co_await
+// source.next()`. Control passes between the two by symmetric transfer:
+// the producer is suspended while decoded frames are pending, so when no
+// consumer is waiting, backpressure reaches the sample source, and the
+// producer is resumed once the consumer has drained every frame. Both
+// coroutines must run on the same thread (or be externally serialized).
+#ifndef __WLANFRAMESOURCE_HH__
+#define __WLANFRAMESOURCE_HH__
+
+#if !defined(__cpp_impl_coroutine)
+#   error "wlanframesource.hh requires C++20 coroutine support"
+#endif
+
+#include <complex>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <liquid/liquid.h>
+#include "liquid-wlan.h"
+#include "liquid-wlan.hh"
+
+namespace liquid {
+namespace wlan {
+
+// event delivered by frame source
+struct frame_event
+{
+    enum kind_t {
+        HEADER,                         // SIGNAL field decoded (header events only)
+        FRAME,                          // frame received
+    };
+    kind_t               kind;
+    bool                 header_valid;  // flag indicating if header is valid
+    std::vector<uint8_t> payload;       // decoded payload (FRAME with valid header)
+    wlan_rxvector_s      rxvector;      // receive vector
+    framesyncstats_s     stats;         // frame statistics (symbols not retained)
+};
+
+class frame_source
+{
+  public:
+    // create frame source
+    //  _header_events  :   deliver a HEADER event ahead of each frame
+    explicit frame_source(bool _header_events=false) :
+        closed(false)
+    {
+        fs = wlanframesync_create(callback, this);
+        if (_header_events)
+            wlanframesync_set_header_callback(fs, header_callback);
+    }
+
+    // not copyable or movable: suspended coroutines refer to the object
+    frame_source(const frame_source &) = delete;
+    frame_source & operator=(const frame_source &) = delete;
+
+    // destructor; suspended coroutines are not resumed
+    ~frame_source() { wlanframesync_destroy(fs); }
+
+    // synchronizer object, for configuration (profile, squelch, ...)
+    wlanframesync handle() const { return fs; }
+
+    // awaitable feeding samples to synchronizer
+    class push_awaiter
+    {
+      public:
+        // process samples; no suspension unless frames are pending
+        bool await_ready()
+        {
+            q.process(buf, n, cs16);
+            return q.num_pending() == 0;
+        }
+
+        // suspend producer, transferring control to a waiting consumer
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> _h)
+        {
+            q.producer = _h;
+            return q.take(q.consumer);
+        }
+
+        void await_resume() {}
+
+      private:
+        friend class frame_source;
+        push_awaiter(frame_source & _q, const void * _buf, size_t _n, bool _cs16) :
+            q(_q), buf(_buf), n(_n), cs16(_cs16) {}
+        frame_source & q;
+        const void *   buf;
+        size_t         n;
+        bool           cs16;
+    };
+
+    // awaitable yielding the next event
+    class next_awaiter
+    {
+      public:
+        bool await_ready() { return q.num_pending() > 0 || q.closed; }
+
+        // suspend consumer, transferring control to a suspended producer
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> _h)
+        {
+            q.consumer = _h;
+            return q.take(q.producer);
+        }
+
+        // next event, or empty once the source is closed and drained
+        std::optional<frame_event> await_resume() { return q.pop(); }
+
+      private:
+        friend class frame_source;
+        next_awaiter(frame_source & _q) : q(_q) {}
+        frame_source & q;
+    };
+
+    // feed block of samples
+    push_awaiter push(span<const std::complex<float>> _buf)
+        { return push_awaiter(*this, _buf.data(), _buf.size(), false); }
+
+    // feed block of interleaved 16-bit I/Q samples (cs16)
+    push_awaiter push(span<const int16_t> _buf)
+    {
+        if (_buf.size() % 2)
+            throw std::invalid_argument("interleaved I/Q input must have an even number of elements");
+        return push_awaiter(*this, _buf.data(), _buf.size()/2, true);
+    }
+
+    // wait for next event
+    next_awaiter next() { return next_awaiter(*this); }
+
+    // signal end of samples; a waiting consumer is resumed (receiving an
+    // empty event once the remaining events are drained)
+    void close()
+    {
+        closed = true;
+        if (consumer)
+            take(consumer).resume();
+    }
+
+    // return event's payload storage for re-use by later frames
+    void recycle(frame_event && _event)
+    {
+        std::lock_guard<std::mutex> lock(pending_lock);
+        _event.payload.clear();
+        pool.push_back(std::move(_event.payload));
+    }
+
+  private:
+    wlanframesync fs;
+    bool          closed;
+
+    // suspended coroutines
+    std::coroutine_handle<> producer;
+    std::coroutine_handle<> consumer;
+
+    // pending events and payload storage for re-use; guarded as decoder
+    // threads may deliver frames
+    std::mutex                        pending_lock;
+    std::deque<frame_event>           pending;
+    std::vector<std::vector<uint8_t>> pool;
+
+    // take suspended coroutine, or no-op coroutine if none
+    std::coroutine_handle<> take(std::coroutine_handle<> & _h)
+    {
+        std::coroutine_handle<> h = _h ? _h : std::noop_coroutine();
+        _h = nullptr;
+        return h;
+    }
+
+    size_t num_pending()
+    {
+        std::lock_guard<std::mutex> lock(pending_lock);
+        return pending.size();
+    }
+
+    std::optional<frame_event> pop()
+    {
+        std::lock_guard<std::mutex> lock(pending_lock);
+        if (pending.empty())
+            return std::nullopt;
+        frame_event e = std::move(pending.front());
+        pending.pop_front();
+        return e;
+    }
+
+    // run synchronizer, delivering every frame before returning
+    void process(const void * _buf, size_t _n, bool _cs16)
+    {
+        if (closed)
+            throw std::logic_error("frame source is closed");
+        if (_cs16)
+            wlanframesync_execute_cs16(fs, (const int16_t*)_buf, _n);
+        else
+            wlanframesync_execute(fs, (std::complex<float>*)_buf, _n);
+        wlanframesync_flush(fs);
+    }
+
+    // queue event, moving payload into recycled storage
+    void deliver(frame_event::kind_t    _kind,
+                 int                    _header_valid,
+                 unsigned char *        _payload,
+                 struct wlan_rxvector_s _rxvector,
+                 framesyncstats_s       _stats)
+    {
+        std::lock_guard<std::mutex> lock(pending_lock);
+        frame_event e;
+        e.kind         = _kind;
+        e.header_valid = _header_valid != 0;
+        if (_kind == frame_event::FRAME && _header_valid && _payload != NULL) {
+            if (!pool.empty()) {
+                e.payload = std::move(pool.back());
+                pool.pop_back();
+            }
+            e.payload.assign(_payload, _payload + _rxvector.LENGTH);
+        }
+        e.rxvector           = _rxvector;
+        e.stats              = _stats;
+        e.stats.framesyms    = NULL;
+        e.stats.num_framesyms= 0;
+        pending.push_back(std::move(e));
+    }
+
+    static int callback(int                    _header_valid,
+                        unsigned char *        _payload,
+                        struct wlan_rxvector_s _rxvector,
+                        framesyncstats_s       _stats,
+                        void *                 _userdata)
+    {
+        ((frame_source*)_userdata)->deliver(frame_event::FRAME, _header_valid, _payload, _rxvector, _stats);
+        return 0;
+    }
+
+    static int header_callback(struct wlan_rxvector_s _rxvector,
+                               framesyncstats_s       _stats,
+                               void *                 _userdata)
+    {
+        ((frame_source*)_userdata)->deliver(frame_event::HEADER, 1, NULL, _rxvector, _stats);
+        return WLANFRAMESYNC_HEADER_DECODE;
+    }
+};
+
+} // namespace wlan
+} // namespace liquid
+
+#endif // __WLANFRAMESOURCE_HH__
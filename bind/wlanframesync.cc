@@ -9,19 +9,166 @@
 using namespace liquid;
 
 #ifdef LIQUID_PYTHONLIB
-void wlan::framesync::py_execute(py::array_t<std::complex<float>> & _buf)
+// get single-character element format of buffer, ignoring native and
+// little-endian byte order prefixes ("Zf" for complex64)
+static std::string py_buffer_format(const py::buffer_info & _info)
 {
-    // get buffer info
+    std::string format = _info.format;
+    if (!format.empty() && (format[0]=='@' || format[0]=='=' || format[0]=='<'))
+        format.erase(0,1);
+    return format;
+}
+
+// determine if buffer is C-contiguous
+static bool py_buffer_is_contiguous(const py::buffer_info & _info)
+{
+    py::ssize_t stride = _info.itemsize;
+    for (py::ssize_t i=_info.ndim-1; i>=0; i--) {
+        if (_info.shape[i] > 1 && _info.strides[i] != stride)
+            return false;
+        stride *= _info.shape[i];
+    }
+    return true;
+}
+
+// sample formats accepted on input
+enum py_sample_type {PY_CF32, PY_CS16, PY_CS8};
+
+// verify input buffer, returning its sample format and number of complex
+// samples
+static unsigned int py_buffer_parse(const py::buffer_info & _info,
+                                    py_sample_type *        _type)
+{
+    if (!py_buffer_is_contiguous(_info))
+        throw std::runtime_error("input buffer must be C-contiguous");
+
+    std::string format = py_buffer_format(_info);
+    size_t num_bytes = (size_t)_info.size * (size_t)_info.itemsize;
+    if (format == "Zf" && _info.itemsize == sizeof(std::complex<float>)) {
+        *_type = PY_CF32;
+    } else if ((format == "B" || format == "c") && _info.itemsize == 1) {
+        // untyped bytes (e.g. mmap) holding complex64 samples
+        if (num_bytes % sizeof(std::complex<float>))
+            throw std::runtime_error("byte buffer length must be a multiple of 8 (complex64)");
+        *_type = PY_CF32;
+    } else if (format == "h" && _info.itemsize == sizeof(int16_t)) {
+        *_type = PY_CS16;
+    } else if (format == "b" && _info.itemsize == sizeof(int8_t)) {
+        *_type = PY_CS8;
+    } else {
+        throw std::runtime_error("invalid input type, use dtype=np.csingle, np.int16 (cs16), or np.int8 (cs8)");
+    }
+    if (*_type != PY_CF32 && (_info.size % 2))
+        throw std::runtime_error("interleaved I/Q input must have an even number of elements");
+    return *_type == PY_CF32 ? num_bytes / sizeof(std::complex<float>) : _info.size / 2;
+}
+
+// execute synchronizer on parsed buffer; the GIL must be released
+static void py_buffer_execute(wlanframesync  _fs,
+                              void *         _ptr,
+                              py_sample_type _type,
+                              unsigned int   _n)
+{
+    switch (_type) {
+    case PY_CF32: wlanframesync_execute     (_fs, (liquid_float_complex*)_ptr, _n); break;
+    case PY_CS16: wlanframesync_execute_cs16(_fs, (const int16_t*)       _ptr, _n); break;
+    case PY_CS8:  wlanframesync_execute_cs8 (_fs, (const int8_t*)        _ptr, _n); break;
+    }
+}
+
+void wlan::framesync::py_execute(py::buffer _buf)
+{
+    // get buffer info (holds a reference to the underlying memory)
+    py::buffer_info info = _buf.request();
+    py_sample_type type;
+    unsigned int n = py_buffer_parse(info, &type);
+
+    // execute on input with the GIL released, then the object locked;
+    // callbacks re-acquire the GIL while the lock is held, so the two are
+    // always taken in this order
+    std::exception_ptr e;
+    {
+        py::gil_scoped_release release;
+        guard g(*this);
+        py_buffer_execute(fs, info.ptr, type, n);
+        e = py_error;
+        py_error = nullptr;
+    }
+
+    // propagate exception raised within callback
+    if (e)
+        std::rethrow_exception(e);
+}
+
+py::tuple wlan::framesync::py_execute_batch(py::buffer _buf)
+{
+    // get buffer info (holds a reference to the underlying memory)
     py::buffer_info info = _buf.request();
+    py_sample_type type;
+    unsigned int n = py_buffer_parse(info, &type);
 
-    // verify input size and dimensions
-    if (info.itemsize != sizeof(std::complex<float>))
-        throw std::runtime_error("invalid input numpy size, use dtype=np.csingle");
-    if (info.ndim != 1)
-        throw std::runtime_error("invalid number of input dimensions, must be 1-D array");
+    // execute with the GIL released, then the object locked (as with
+    // execute()); frames are collected natively, in storage that keeps
+    // its capacity across calls
+    py::object frames, payload;
+    std::exception_ptr e;
+    {
+        py::gil_scoped_release release;
+        guard g(*this);
+        py_batch_frames.clear();
+        py_batch_payload.clear();
 
-    // execute on input
-    execute((std::complex<float>*) info.ptr, info.shape[0]);
+        // frames pending from previous calls still go to the callback
+        wlanframesync_flush(fs);
+
+        py_batch = true;
+        py_buffer_execute(fs, info.ptr, type, n);
+        wlanframesync_flush(fs);
+        py_batch = false;
+        e = py_error;
+        py_error = nullptr;
+
+        // copy out in bulk, re-acquiring the GIL while still locked
+        py::gil_scoped_acquire acquire;
+        py::array_t<py_frame_record> f(py_batch_frames.size());
+        py::array_t<uint8_t>         p(py_batch_payload.size());
+        if (!py_batch_frames.empty())
+            memcpy(f.mutable_data(), py_batch_frames.data(), py_batch_frames.size()*sizeof(py_frame_record));
+        if (!py_batch_payload.empty())
+            memcpy(p.mutable_data(), py_batch_payload.data(), py_batch_payload.size());
+        frames  = f;
+        payload = p;
+    }
+
+    // propagate exception raised within callback while flushing
+    if (e)
+        std::rethrow_exception(e);
+    return py::make_tuple(frames, payload);
+}
+
+void wlan::framesync::py_batch_append(int                    _header_valid,
+                                      unsigned char *        _payload,
+                                      struct wlan_rxvector_s _rxvector,
+                                      framesyncstats_s       _stats)
+{
+    // decoder threads can deliver frames concurrently
+    std::lock_guard<std::mutex> lock(py_batch_lock);
+
+    py_frame_record r;
+    r.header_valid   = _header_valid;
+    r.length         = _rxvector.LENGTH;
+    r.datarate       = _rxvector.DATARATE;
+    r.service        = _rxvector.SERVICE;
+    r.rxvector_rssi  = _rxvector.RSSI;
+    r.evm            = _stats.evm;
+    r.rssi           = _stats.rssi;
+    r.cfo            = _stats.cfo;
+    r.mod_scheme     = _stats.mod_scheme;
+    r.fec            = _stats.fec0;
+    r.payload_offset = py_batch_payload.size();
+    if (_header_valid && _payload != NULL)
+        py_batch_payload.insert(py_batch_payload.end(), _payload, _payload + _rxvector.LENGTH);
+    py_batch_frames.push_back(r);
 }
 
 int wlan::py_callback_wrapper_framesync(
@@ -31,8 +178,21 @@ int wlan::py_callback_wrapper_framesync(
         framesyncstats_s       _stats,
         void *                 _userdata)
 {
-    // type cast user data as frame synchronizer
-    wlan::framesync * fs = (wlan::framesync*) _userdata;
+    // user data holds location of frame synchronizer
+    wlan::framesync * fs = *(wlan::framesync**) _userdata;
+
+    // collect frame without entering python
+    if (fs->py_batch) {
+        fs->py_batch_append(_header_valid, _payload, _rxvector, _stats);
+        return 0;
+    }
+
+    // invoked with the GIL released, possibly from a decoder thread
+    py::gil_scoped_acquire acquire;
+
+    // skip remaining frames once callback has raised an exception
+    if (fs->py_error)
+        return 0;
 
     // payload bytes
     py::array_t<uint8_t> payload({_rxvector.LENGTH,},{1,},(uint8_t*)_payload);
@@ -56,8 +216,14 @@ int wlan::py_callback_wrapper_framesync(
         "mod_scheme"_a    = std::string( modulation_types[_stats.mod_scheme].name ),
         "fec"_a           = std::string( fec_scheme_str[_stats.fec0][1] )
         );
-    //py::object o =
-    fs->py_callback(fs->context,payload,stats);
+    // exceptions cannot unwind through the synchronizer; hold until
+    // execute() returns
+    try {
+        //py::object o =
+        fs->py_callback(fs->context,payload,stats);
+    } catch (...) {
+        fs->py_error = std::current_exception();
+    }
 
 #if 0
     // interpret return value
@@ -72,6 +238,10 @@ int wlan::py_callback_wrapper_framesync(
 
 void init_framesync(py::module &m)
 {
+    PYBIND11_NUMPY_DTYPE(wlan::framesync::py_frame_record,
+        header_valid, length, datarate, service, rxvector_rssi,
+        evm, rssi, cfo, mod_scheme, fec, payload_offset);
+
     py::class_<wlan::framesync>(m, "framesync", "WLAN frame synchronizer")
         .def(py::init<py_framesync_callback,py::object>(),
              py::arg("callback") = py_framesync_callback_default,
@@ -80,12 +250,30 @@ void init_framesync(py::module &m)
         .def("__repr__", &wlan::framesync::repr)
         .def("reset",
              &wlan::framesync::reset,
+             py::call_guard<py::gil_scoped_release>(),
              "reset frame synchronizer object")
         .def("execute",
              &wlan::framesync::py_execute,
-             "execute on a block of samples")
+             py::arg("buf"),
+             "execute on a block of samples without copying, releasing the GIL; "
+             "accepts any C-contiguous buffer of complex64 samples, or interleaved "
+             "I/Q as int16 (cs16) or int8 (cs8)")
+        .def("execute_batch",
+             &wlan::framesync::py_execute_batch,
+             py::arg("buf"),
+             "execute on a block of samples (as execute) without invoking the callback, "
+             "returning (frames, payload): a structured array with one record per frame "
+             "decoded and a byte array of all payloads, each at its record's payload_offset; "
+             "frames completed by earlier calls to execute() go to the callback, while a "
+             "frame completed here is returned even if it started in an earlier call")
+        .def("set_symbol_capture",
+             &wlan::framesync::set_symbol_capture,
+             py::arg("num_symbols"),
+             py::call_guard<py::gil_scoped_release>(),
+             "set number of frame symbols passed to callback (0: disabled)")
         .def("reset_framedatastats",
              &wlan::framesync::reset_framedatastats,
+             py::call_guard<py::gil_scoped_release>(),
              "reset frame statistics data")
         .def_property_readonly("framedatastats",
             &wlan::framesync::py_get_framedatastats,
@@ -2,11 +2,21 @@
 #ifndef __WLANFRAMESYNC_HH__
 #define __WLANFRAMESYNC_HH__
 
+#include <atomic>
 #include <complex>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 #include <liquid/liquid.h>
 #include "liquid-wlan.h"
+#include "liquid-wlan.hh"
 #include "liquid-wlan.python.hh"
 
 namespace liquid {
@@ -25,15 +35,49 @@ int py_callback_wrapper_framesync(
 class framesync
 {
   public:
+    /*! @brief frame handler, invoked for every frame detected
+     *  @param header_valid flag indicating if header is valid
+     *  @param payload      decoded payload (empty if header is invalid),
+     *                      valid only for the duration of the call
+     *  @param rxvector     receive vector
+     *  @param stats        frame statistics
+     */
+    typedef std::function<int(bool                     header_valid,
+                              span<const uint8_t>      payload,
+                              const wlan_rxvector_s &  rxvector,
+                              const framesyncstats_s & stats)> handler;
+
     // default constructor
-    framesync(wlanframesync_callback _callback=NULL, void * _userdata=NULL)
+    framesync(wlanframesync_callback _callback=NULL, void * _userdata=NULL) :
+        self(new framesync*(this))
         { fs = wlanframesync_create(_callback, _userdata); }
 
+    // constructor with frame handler (e.g. a lambda)
+    explicit framesync(handler _handler) :
+        self(new framesync*(this)),
+        on_frame(std::move(_handler))
+        { fs = wlanframesync_create(handler_wrapper, self.get()); }
+
+    // not copyable: owns the synchronizer object
+    framesync(const framesync &) = delete;
+    framesync & operator=(const framesync &) = delete;
+
+    // move constructor and assignment, leaving source empty
+    framesync(framesync && _rhs) noexcept : fs(NULL) { move_from(_rhs); }
+    framesync & operator=(framesync && _rhs) noexcept
+    {
+        if (this != &_rhs) {
+            if (fs != NULL) wlanframesync_destroy(fs);
+            move_from(_rhs);
+        }
+        return *this;
+    }
+
     // destructor
-    ~framesync() { wlanframesync_destroy(fs); }
+    ~framesync() { if (fs != NULL) wlanframesync_destroy(fs); }
 
     // reset internal state
-    void reset() { wlanframesync_reset(fs); }
+    void reset() { guard g(*this); wlanframesync_reset(fs); }
 
     // object type
     std::string type() const { return "framesync"; }
@@ -47,7 +91,33 @@ class framesync
         { os << rhs.repr(); return os; }
 
     void execute(std::complex<float> * _buf, unsigned int _buf_len)
-        { wlanframesync_execute(fs, _buf, _buf_len); }
+        { guard g(*this); wlanframesync_execute(fs, _buf, _buf_len); }
+
+    // execute on block of samples
+    void execute(span<const std::complex<float>> _buf)
+        { guard g(*this); wlanframesync_execute(fs, (std::complex<float>*)_buf.data(), _buf.size()); }
+
+    // execute on interleaved 16-bit I/Q samples (cs16)
+    void execute(span<const int16_t> _buf)
+    {
+        if (_buf.size() % 2)
+            throw std::invalid_argument("interleaved I/Q input must have an even number of elements");
+        guard g(*this);
+        wlanframesync_execute_cs16(fs, _buf.data(), _buf.size()/2);
+    }
+
+    // execute on interleaved 8-bit I/Q samples (cs8)
+    void execute(span<const int8_t> _buf)
+    {
+        if (_buf.size() % 2)
+            throw std::invalid_argument("interleaved I/Q input must have an even number of elements");
+        guard g(*this);
+        wlanframesync_execute_cs8(fs, _buf.data(), _buf.size()/2);
+    }
+
+    // set number of symbols captured per frame (0: disabled)
+    void set_symbol_capture(unsigned int _num_symbols)
+        { guard g(*this); wlanframesync_set_symbol_capture(fs, _num_symbols); }
 
 #if 0
     void set_callback(framesync_callback _callback=NULL)
@@ -71,7 +141,7 @@ class framesync
     unsigned int get_num_bytes_received() const
         { return get_framedatastats().num_bytes_received; }
 
-    void reset_framedatastats() { wlanframesync_reset_framedatastats(fs); }
+    void reset_framedatastats() { guard g(*this); wlanframesync_reset_framedatastats(fs); }
 
     framedatastats_s get_framedatastats() const
         { return wlanframesync_get_framedatastats(fs); }
@@ -79,11 +149,102 @@ class framesync
   private:
     wlanframesync fs;
 
+    // location of this object, passed to the synchronizer as user data so
+    // callbacks follow the object when it is moved
+    std::unique_ptr<framesync*> self;
+
+    handler on_frame;
+
+    // serializes execution and re-configuration across threads; the frame
+    // handler runs with the lock held, so calling back into the object
+    // from the handler is rejected rather than deadlocking
+    std::mutex                   lock;
+    std::atomic<std::thread::id> lock_owner{std::thread::id()};
+
+    // scoped holder of the lock
+    class guard
+    {
+      public:
+        explicit guard(framesync & _q) : q(_q)
+        {
+            if (q.lock_owner.load() == std::this_thread::get_id())
+                throw std::logic_error("framesync cannot be used from within its own frame handler");
+            q.lock.lock();
+            q.lock_owner = std::this_thread::get_id();
+        }
+        ~guard() { q.lock_owner = std::thread::id(); q.lock.unlock(); }
+        guard(const guard &) = delete;
+        guard & operator=(const guard &) = delete;
+      private:
+        framesync & q;
+    };
+
+    // invoke frame handler from synchronizer callback
+    static int handler_wrapper(int                    _header_valid,
+                               unsigned char *        _payload,
+                               struct wlan_rxvector_s _rxvector,
+                               framesyncstats_s       _stats,
+                               void *                 _userdata)
+    {
+        framesync * q = *(framesync**)_userdata;
+        if (!q->on_frame)
+            return 0;
+        span<const uint8_t> payload(_payload, _header_valid && _payload != NULL ? _rxvector.LENGTH : 0);
+        return q->on_frame(_header_valid != 0, payload, _rxvector, _stats);
+    }
+
+    // take ownership of synchronizer and handlers from another object (not
+    // synchronized: neither object may be in use)
+    void move_from(framesync & _rhs)
+    {
+        fs       = _rhs.fs;
+        self     = std::move(_rhs.self);
+        on_frame = std::move(_rhs.on_frame);
+        if (self)
+            *self = this;
+        _rhs.fs  = NULL;
 #ifdef LIQUID_PYTHONLIB
+        py_callback      = std::move(_rhs.py_callback);
+        context          = std::move(_rhs.context);
+        py_error         = std::move(_rhs.py_error);
+        py_batch         = _rhs.py_batch;
+        py_batch_frames  = std::move(_rhs.py_batch_frames);
+        py_batch_payload = std::move(_rhs.py_batch_payload);
+#endif
+    }
+
+#ifdef LIQUID_PYTHONLIB
+  public:
+    // frame record returned by execute_batch() as numpy structured array
+    struct py_frame_record {
+        int32_t  header_valid;      // header valid flag
+        uint32_t length;            // payload length (bytes)
+        uint32_t datarate;          // data rate field
+        uint32_t service;           // service field
+        uint32_t rxvector_rssi;     // received signal strength indicator
+        float    evm;               // error vector magnitude [dB]
+        float    rssi;              // received signal strength [dB]
+        float    cfo;               // carrier frequency offset
+        uint32_t mod_scheme;        // modulation scheme (liquid)
+        uint32_t fec;               // forward error-correction scheme (liquid)
+        uint64_t payload_offset;    // offset of payload in byte array
+    };
+
   //private:
   public:
     py_framesync_callback py_callback;
     py::object context;
+    std::exception_ptr py_error;    // exception raised within callback
+
+    // frames collected by execute_batch(), appended from decoder threads
+    bool                          py_batch;
+    std::mutex                    py_batch_lock;
+    std::vector<py_frame_record>  py_batch_frames;
+    std::vector<uint8_t>          py_batch_payload;
+    void py_batch_append(int                    _header_valid,
+                         unsigned char *        _payload,
+                         struct wlan_rxvector_s _rxvector,
+                         framesyncstats_s       _stats);
     friend int py_callback_wrapper_framesync(
         int                    _header_valid,
         unsigned char *        _payload,
@@ -94,14 +255,24 @@ class framesync
   public:
     // python-specific constructor with keyword arguments
     framesync(py_framesync_callback _callback,
-              py::object            _context)
+              py::object            _context) :
+        self(new framesync*(this))
     {
-        fs = wlanframesync_create(py_callback_wrapper_framesync, this);
+        fs = wlanframesync_create(py_callback_wrapper_framesync, self.get());
         py_callback = _callback;
         context     = _context;
+        py_batch    = false;
     }
 
-    void py_execute(py::array_t<std::complex<float>> & _buf);
+    // execute on any C-contiguous buffer without copying: complex64
+    // samples, raw bytes holding complex64 samples, or interleaved I/Q as
+    // int16 (cs16) or int8 (cs8); the GIL is released while processing
+    void py_execute(py::buffer _buf);
+
+    // execute on buffer (as above), collecting every frame decoded within
+    // the call instead of invoking the callback; returns a tuple of frame
+    // records and a single byte array holding all payloads
+    py::tuple py_execute_batch(py::buffer _buf);
 
     py::dict py_get_framedatastats() const
     {
@@ -27,6 +27,7 @@ def callback(context,payload,stats):
 
 info = {}
 fs = wlan.framesync(callback,info)
+fs.set_symbol_capture(48*len(buf)//80)
 fs.execute(buf)
 
 print('')
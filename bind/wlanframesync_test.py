@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+'''test frame synchronizer bindings: input formats, batches and callback errors'''
+import mmap, sys, tempfile, threading, unittest
+import numpy as np
+sys.path.extend(['.','..','./build'])
+import liquid_wlan as wlan
+
+# data rate indices (WLANFRAME_RATE_*)
+RATE_6, RATE_12, RATE_24 = 0, 2, 4
+
+def make_frames(payloads, datarate=RATE_12, gap=400):
+    '''generate frames with the given payloads, separated by zeros'''
+    fg = wlan.framegen()
+    blocks = [np.zeros(gap, dtype=np.csingle)]
+    for p in payloads:
+        blocks.append(fg.execute_batch([p], datarate=datarate)[0])
+        blocks.append(np.zeros(gap, dtype=np.csingle))
+    return np.concatenate(blocks)
+
+def random_payloads(num_frames, length, seed=1):
+    rng = np.random.default_rng(seed)
+    return [rng.integers(0, 256, length, dtype=np.uint8).tobytes() for _ in range(num_frames)]
+
+class framesync_input(unittest.TestCase):
+    '''every accepted input format decodes the same frames'''
+    def setUp(self):
+        self.payloads = random_payloads(2, 200)
+        self.x = make_frames(self.payloads)
+        self.received = []
+        self.fs = wlan.framesync(self.callback, self.received)
+
+    @staticmethod
+    def callback(context, payload, stats):
+        context.append((bytes(payload), stats))
+
+    def check_received(self):
+        self.assertEqual([p for p,_ in self.received], self.payloads)
+        for _,stats in self.received:
+            self.assertEqual(stats['rxvector']['length'],   200)
+            self.assertEqual(stats['rxvector']['datarate'], RATE_12)
+        self.assertEqual(self.fs.num_frames_detected, len(self.payloads))
+        self.assertEqual(self.fs.num_payloads_valid,  len(self.payloads))
+
+    def test_complex64(self):
+        self.fs.execute(self.x)
+        self.check_received()
+
+    def test_complex64_blocks(self):
+        # frames split across calls
+        for i in range(0, len(self.x), 1000):
+            self.fs.execute(self.x[i:i+1000])
+        self.check_received()
+
+    def test_bytes(self):
+        self.fs.execute(self.x.tobytes())
+        self.check_received()
+
+    def test_bytearray(self):
+        self.fs.execute(bytearray(self.x.tobytes()))
+        self.check_received()
+
+    def test_mmap(self):
+        with tempfile.TemporaryFile() as f:
+            f.write(self.x.tobytes())
+            f.flush()
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+                self.fs.execute(m)
+        self.check_received()
+
+    def test_cs16(self):
+        iq = np.round(8192*self.x.view(np.float32)).astype(np.int16)
+        self.fs.execute(iq)
+        self.check_received()
+
+    def test_cs8(self):
+        iq = np.round(64*self.x.view(np.float32)).astype(np.int8)
+        self.fs.execute(iq)
+        self.check_received()
+
+class framesync_batch(unittest.TestCase):
+    '''execute_batch() returns decoded frames rather than invoking the callback'''
+    def setUp(self):
+        self.received = []
+        self.fs = wlan.framesync(lambda c,p,s: self.received.append(bytes(p)))
+
+    def check_batch(self, frames, payload, payloads, datarate):
+        self.assertEqual(len(frames), len(payloads))
+        for r,p in zip(frames, payloads):
+            self.assertEqual(r['header_valid'], 1)
+            self.assertEqual(r['length'],       len(p))
+            self.assertEqual(r['datarate'],     datarate)
+            offset = int(r['payload_offset'])
+            self.assertEqual(payload[offset:offset+len(p)].tobytes(), p)
+        self.assertEqual(len(payload), sum(len(p) for p in payloads))
+
+    def test_frames(self):
+        # several frames of different lengths in one buffer
+        rng = np.random.default_rng(2)
+        payloads = [rng.integers(0, 256, n, dtype=np.uint8).tobytes() for n in (100, 1, 700, 240)]
+        frames, payload = self.fs.execute_batch(make_frames(payloads, datarate=RATE_24))
+        self.check_batch(frames, payload, payloads, RATE_24)
+        self.assertEqual(self.received, [])
+        self.assertEqual(self.fs.num_frames_detected, len(payloads))
+
+    def test_formats(self):
+        # interleaved I/Q decodes the same frames
+        payloads = random_payloads(3, 300)
+        x = make_frames(payloads)
+        for buf in (x.tobytes(), np.round(8192*x.view(np.float32)).astype(np.int16)):
+            frames, payload = self.fs.execute_batch(buf)
+            self.check_batch(frames, payload, payloads, RATE_12)
+        self.assertEqual(self.received, [])
+
+    def test_previous_execute(self):
+        # frames completed by execute() go to the callback only; a frame
+        # completed by execute_batch() is returned, even if it started
+        # in an earlier call
+        payloads = random_payloads(3, 200)
+        x = make_frames(payloads)
+        n = len(make_frames(payloads[:2])) + 1000   # within third frame
+        self.fs.execute(x[:n])
+        self.assertEqual(self.received, payloads[:2])
+        frames, payload = self.fs.execute_batch(x[n:])
+        self.check_batch(frames, payload, payloads[2:], RATE_12)
+        self.assertEqual(self.received, payloads[:2])
+
+        # and the callback is invoked again by execute()
+        self.fs.execute(x)
+        self.assertEqual(self.received, payloads[:2] + payloads)
+
+    def test_empty(self):
+        frames, payload = self.fs.execute_batch(np.zeros(4000, dtype=np.csingle))
+        self.assertEqual(len(frames),  0)
+        self.assertEqual(len(payload), 0)
+
+class framesync_reject(unittest.TestCase):
+    '''invalid input raises an error without processing any samples'''
+    def setUp(self):
+        self.x  = make_frames(random_payloads(1, 100))
+        self.fs = wlan.framesync()
+
+    def check_rejected(self, buf):
+        with self.assertRaises(RuntimeError):
+            self.fs.execute(buf)
+        with self.assertRaises(RuntimeError):
+            self.fs.execute_batch(buf)
+        self.assertEqual(self.fs.num_frames_detected, 0)
+
+    def test_noncontiguous_complex64(self):
+        self.check_rejected(np.repeat(self.x, 2)[::2])
+
+    def test_noncontiguous_cs16(self):
+        iq = np.round(8192*self.x.view(np.float32)).astype(np.int16)
+        self.check_rejected(np.stack((iq, iq), axis=1)[:,0])
+
+    def test_noncontiguous_2d(self):
+        self.check_rejected(np.asfortranarray(self.x[:800].reshape(40,20)))
+
+    def test_odd_cs16(self):
+        self.check_rejected(np.zeros(1001, dtype=np.int16))
+
+    def test_bytes_length(self):
+        self.check_rejected(bytes(1001))
+
+    def test_dtype(self):
+        self.check_rejected(self.x.astype(np.complex128))
+        self.check_rejected(self.x.real)
+
+class framesync_callback_error(unittest.TestCase):
+    '''exception raised in callback is re-raised once execute() returns'''
+    def test_reraise(self):
+        calls = []
+        def callback(context, payload, stats):
+            calls.append(len(payload))
+            raise ValueError('callback failed')
+        fs = wlan.framesync(callback)
+        x = make_frames(random_payloads(2, 100))
+        with self.assertRaisesRegex(ValueError, 'callback failed'):
+            fs.execute(x)
+
+        # the rest of the buffer was processed, without invoking the
+        # callback again
+        self.assertEqual(calls, [100])
+        self.assertEqual(fs.num_frames_detected, 2)
+
+        # error is cleared
+        fs.execute(np.zeros(1000, dtype=np.csingle))
+
+    def test_reentrant(self):
+        # calling into the synchronizer from its callback is an error
+        def callback(context, payload, stats):
+            fs.reset()
+        fs = wlan.framesync(callback)
+        with self.assertRaises(RuntimeError):
+            fs.execute(make_frames(random_payloads(1, 100)))
+
+class framesync_threads(unittest.TestCase):
+    '''re-configuring from another thread while execute() runs'''
+    def test_symbol_capture(self):
+        payloads = random_payloads(10, 400)
+        x = make_frames(payloads, datarate=RATE_24)
+        received = []
+        fs = wlan.framesync(lambda c,p,s: received.append(bytes(p)))
+        done = threading.Event()
+        def reconfigure():
+            n = 0
+            while not done.is_set():
+                fs.set_symbol_capture(100 if n % 2 else 2000)
+                fs.reset_framedatastats()
+                n += 1
+        t = threading.Thread(target=reconfigure)
+        t.start()
+        try:
+            for _ in range(4):
+                fs.execute(x)
+        finally:
+            done.set()
+            t.join()
+        self.assertEqual(received, 4*payloads)
+
+if __name__ == '__main__':
+    unittest.main()
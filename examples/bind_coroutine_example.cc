@@ -0,0 +1,126 @@
+// Generate wlan frames and receive them with the coroutine frame source,
+// with the producer started before and after the consumer
+#include <algorithm>
+#include <coroutine>
+#include <cstdio>
+#include <exception>
+#include <vector>
+
+#include "wlanframegen.hh"
+#include "wlanframesource.hh"
+
+// minimal eagerly-started coroutine
+struct task {
+    struct promise_type {
+        task get_return_object() { return task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_never  initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend()   noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+    explicit task(std::coroutine_handle<promise_type> _h) : h(_h) {}
+    task(const task &) = delete;
+    ~task() { h.destroy(); }
+    bool done() const { return h.done(); }
+    std::coroutine_handle<promise_type> h;
+};
+
+// feed samples in blocks, as complex float or cs16
+task producer(liquid::wlan::frame_source &             _source,
+              const std::vector<std::complex<float>> & _buf,
+              bool                                     _cs16)
+{
+    const unsigned int block_len = 1000;
+    std::vector<int16_t> block_cs16(2*block_len);
+    for (unsigned int i=0; i<_buf.size(); i+=block_len) {
+        unsigned int n = std::min(block_len, (unsigned int)_buf.size() - i);
+        if (_cs16) {
+            for (unsigned int j=0; j<n; j++) {
+                block_cs16[2*j+0] = (int16_t)(8192*_buf[i+j].real());
+                block_cs16[2*j+1] = (int16_t)(8192*_buf[i+j].imag());
+            }
+            co_await _source.push(liquid::wlan::span<const int16_t>(block_cs16.data(), 2*n));
+        } else {
+            co_await _source.push(liquid::wlan::span<const std::complex<float>>(&_buf[i], n));
+        }
+    }
+}
+
+// receive events until the source is closed
+task consumer(liquid::wlan::frame_source & _source,
+              const std::vector<uint8_t> & _payload,
+              unsigned int *               _num_headers,
+              unsigned int *               _num_valid)
+{
+    while (auto e = co_await _source.next()) {
+        if (e->kind == liquid::wlan::frame_event::HEADER) {
+            (*_num_headers)++;
+        } else {
+            *_num_valid += e->header_valid && e->payload == _payload;
+            _source.recycle(std::move(*e));
+        }
+    }
+}
+
+// run test with given number of frames, returning 0 on success
+int runtest(const std::vector<std::complex<float>> & _buf,
+            const std::vector<uint8_t> &             _payload,
+            unsigned int                             _num_frames,
+            bool                                     _producer_first,
+            bool                                     _cs16)
+{
+    liquid::wlan::frame_source source(true);
+    unsigned int num_headers = 0;
+    unsigned int num_valid   = 0;
+    bool blocked = false;
+    if (_producer_first) {
+        // producer is held after the first frame until a consumer drains it
+        task p = producer(source, _buf, _cs16);
+        blocked = !p.done();
+        task c = consumer(source, _payload, &num_headers, &num_valid);
+        source.close();
+        if (!p.done() || !c.done())
+            return 1;
+    } else {
+        task c = consumer(source, _payload, &num_headers, &num_valid);
+        task p = producer(source, _buf, _cs16);
+        source.close();
+        blocked = true;
+        if (!p.done() || !c.done())
+            return 1;
+    }
+    printf("%s first, %s: %u headers, %u valid frames%s\n",
+            _producer_first ? "producer" : "consumer", _cs16 ? "cs16" : "cf32",
+            num_headers, num_valid, _producer_first && blocked ? " (producer held)" : "");
+    return num_headers == _num_frames && num_valid == _num_frames && blocked ? 0 : 1;
+}
+
+int main()
+{
+    // generate frames separated by silence
+    std::vector<uint8_t> payload(300);
+    for (unsigned int i=0; i<payload.size(); i++)
+        payload[i] = (7*i) & 0xff;
+    liquid::wlan::framegen fg;
+    fg.assemble(payload, WLANFRAME_RATE_24);
+    std::vector<std::complex<float>> frame;
+    fg.write_frame(frame);
+    const unsigned int num_frames = 3;
+    std::vector<std::complex<float>> buf;
+    for (unsigned int k=0; k<num_frames; k++) {
+        buf.resize(buf.size() + 500);
+        buf.insert(buf.end(), frame.begin(), frame.end());
+    }
+    buf.resize(buf.size() + 500);
+
+    int rc = 0;
+    rc |= runtest(buf, payload, num_frames, false, false);
+    rc |= runtest(buf, payload, num_frames, true,  false);
+    rc |= runtest(buf, payload, num_frames, true,  true);
+    if (rc) {
+        fprintf(stderr,"error: %s, frame source mismatch\n", __FILE__);
+        return 1;
+    }
+    printf("done.\n");
+    return 0;
+}
@@ -1,56 +1,60 @@
-// Test generation of wlan frame
+// Generate and synchronize wlan frames with the C++ bindings
 #include <iostream>
+#include <vector>
 
 #include "wlanframegen.hh"
-
-static int callback(int                    _header_valid,
-                    unsigned char *        _payload,
-                    struct wlan_rxvector_s _rxvector,
-                    void *                 _userdata)
-{
-    printf("**** callback invoked (header: %s)\n", _header_valid ? "valid" : "INVALID");
-    return 0;
-}
+#include "wlanframesync.hh"
 
 int main(int argc, char*argv[])
 {
     liquid::wlan::framegen fg;
     std::cout << fg << std::endl;
 
-    // assemble payload with random data of a fixed length
-    fg.assemble(800);
-
-    // create frame synchronizer
-    wlanframesync fs = wlanframesync_create(callback,NULL);
-
-    // write samples to buffer and run through decoder
-    // generate/synchronize frame
-    std::complex<float> buffer[80];   // tx sample buffer
-    int last_frame = 0;
-    while (!last_frame) {
-        // write symbol
-        last_frame = fg.writesymbol(buffer);
-
-#if 0
-        // push through channel (add noise, carrier offset)
-        for (i=0; i<80; i++) {
-            buffer[i] *= cexpf(_Complex_I*(phi + dphi*n));
-            buffer[i] *= gamma;
-            buffer[i] += nstd*( randnf() + _Complex_I*randnf() )*M_SQRT1_2;
-
-            // write buffer to file
-            fprintf(fid,"x(%4u) = %12.4e + j*%12.4e;\n", n+1, crealf(buffer[i]), cimagf(buffer[i]));
-
-            n++;
-        }
-#endif
-
-        // run through synchronize
-        wlanframesync_execute(fs, (liquid_float_complex*)buffer, 80);
+    // assemble payload
+    std::vector<uint8_t> payload(800);
+    for (unsigned int i=0; i<payload.size(); i++)
+        payload[i] = i & 0xff;
+    fg.assemble(payload, WLANFRAME_RATE_36);
+
+    // write frame to buffer (re-using its capacity), with silence either side
+    std::vector<std::complex<float>> frame;
+    fg.write_frame(frame);
+    std::vector<std::complex<float>> buffer(frame.size() + 400);
+    std::copy(frame.begin(), frame.end(), buffer.begin() + 200);
+
+    // create frame synchronizer with handler verifying the payload
+    unsigned int num_frames = 0;
+    unsigned int num_valid  = 0;
+    liquid::wlan::framesync fs0([&](bool                            _header_valid,
+                                    liquid::wlan::span<const uint8_t> _payload,
+                                    const wlan_rxvector_s &         _rxvector,
+                                    const framesyncstats_s &        _stats)
+    {
+        printf("**** callback invoked (header: %s, %u bytes)\n",
+                _header_valid ? "valid" : "INVALID", (unsigned int)_payload.size());
+        num_frames++;
+        num_valid += _header_valid && std::equal(_payload.begin(), _payload.end(),
+                                                 payload.begin(), payload.end());
+        return 0;
+    });
+
+    // synchronizer is move-only; handler follows the object
+    liquid::wlan::framesync fs(std::move(fs0));
+
+    // run through synchronizer as complex float and as cs16 samples
+    fs.execute(buffer);
+    std::vector<int16_t> buffer_cs16(2*buffer.size());
+    for (unsigned int i=0; i<buffer.size(); i++) {
+        buffer_cs16[2*i+0] = (int16_t)(8192*buffer[i].real());
+        buffer_cs16[2*i+1] = (int16_t)(8192*buffer[i].imag());
     }
+    fs.execute(buffer_cs16);
 
-    wlanframesync_destroy(fs);
+    printf("frames: %u, valid: %u\n", num_frames, num_valid);
+    if (num_frames != 2 || num_valid != 2) {
+        fprintf(stderr,"error: %s, expected two valid frames\n", __FILE__);
+        return 1;
+    }
     printf("done.\n");
     return 0;
 }
-
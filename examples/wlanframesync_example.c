@@ -111,6 +111,9 @@ int main(int argc, char*argv[])
     wlanframegen_assemble(fg, msg_org, txvector);
     wlanframegen_print(fg);
 
+    // capture every data subcarrier symbol of the frame
+    wlanframesync_set_symbol_capture(fs, 48*wlanframegen_getframelen(fg));
+
     // open output file
     FILE * fid = fopen(OUTPUT_FILENAME,"w");
     if (!fid) {
@@ -1,5 +1,6 @@
 // Test performance of frame detection, header decoding, and payload
-// decoding in additive white Gauss noise (AWGN) channels.
+// decoding in additive white Gauss noise (AWGN) channels, optionally with
+// random multipath fading.
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,10 +26,16 @@ void usage()
     printf(" -L <len>   : frame length (bytes),                  default: 800\n");
     printf(" -o <file>  : output filename,                       default: %s\n", FILENAME_OUTPUT);
     printf(" -S <seed>  : random seed,                           default: time(NULL)\n");
+    printf(" -M <len>   : multipath channel length (0: AWGN),    default: 0\n");
+    printf(" -c <est>   : channel estimator {poly,lts,dft},      default: poly\n");
+    printf(" -T <ntaps> : number of taps for dft estimator,      default: 16\n");
+    printf(" -t <mu>    : channel tracking step size (0: off),   default: 0\n");
+    printf(" -p <prof>  : receive profile {float,q15},           default: float\n");
 }
 
 unsigned int  datarate  = WLANFRAME_RATE_6;
 int           frame_len = 800;
+unsigned int  channel_len = 0;  // multipath channel length (0: AWGN)
 unsigned char msg_org[4096];
 
 int frame_detected;
@@ -68,10 +75,14 @@ int main(int argc, char*argv[])
     unsigned long int   min_bit_errors  =  100;     // minimum bit errors before success
     const char *        filename        = FILENAME_OUTPUT;
     unsigned int        seed            =    0;     // random seed
+    int                 chanest         = WLANFRAMESYNC_CHANEST_POLY;
+    unsigned int        chanest_ntaps   =   16;     // number of taps for dft estimator
+    float               chantrack_mu    = 0.0f;     // channel tracking step size
+    int                 profile         = WLANFRAMESYNC_PROFILE_FLOAT;
 
     // get options
     int dopt;
-    while((dopt = getopt(argc,argv,"hs:d:x:n:m:r:L:o:S:")) != EOF){
+    while((dopt = getopt(argc,argv,"hs:d:x:n:m:r:L:o:S:M:c:T:t:p:")) != EOF){
         switch (dopt) {
         case 'h': usage();                         return 0;
         case 's': SNRdB_min      = atof(optarg);   break;
@@ -97,6 +108,26 @@ int main(int argc, char*argv[])
         case 'L': frame_len  = atoi(optarg);    break;
         case 'o': filename   = optarg;          break;
         case 'S': seed       = atoi(optarg);    break;
+        case 'M': channel_len = atoi(optarg);   break;
+        case 'c':
+            if      (strcmp(optarg,"poly")==0) chanest = WLANFRAMESYNC_CHANEST_POLY;
+            else if (strcmp(optarg,"lts" )==0) chanest = WLANFRAMESYNC_CHANEST_LTS;
+            else if (strcmp(optarg,"dft" )==0) chanest = WLANFRAMESYNC_CHANEST_DFT;
+            else {
+                fprintf(stderr,"error: %s, invalid channel estimator '%s'\n", argv[0], optarg);
+                exit(1);
+            }
+            break;
+        case 'T': chanest_ntaps = atoi(optarg); break;
+        case 't': chantrack_mu  = atof(optarg); break;
+        case 'p':
+            if      (strcmp(optarg,"float")==0) profile = WLANFRAMESYNC_PROFILE_FLOAT;
+            else if (strcmp(optarg,"q15"  )==0) profile = WLANFRAMESYNC_PROFILE_Q15;
+            else {
+                fprintf(stderr,"error: %s, invalid receive profile '%s'\n", argv[0], optarg);
+                exit(1);
+            }
+            break;
         default:
             fprintf(stderr,"error: %s, invalid rate '%s'\n", argv[0], optarg);
             exit(1);
@@ -109,6 +140,9 @@ int main(int argc, char*argv[])
     } else if (SNRdB_step <= 0) {
         fprintf(stderr,"error: invalid SNR step size\n");
         exit(1);
+    } else if (channel_len > 16) {
+        fprintf(stderr,"error: multipath channel length cannot exceed cyclic prefix (16)\n");
+        exit(1);
     }
 
     // try to open output file
@@ -125,6 +159,12 @@ int main(int argc, char*argv[])
     // create frame generator and synchronizer objects
     wlanframegen fg  = wlanframegen_create();
     wlanframesync fs = wlanframesync_create(callback, NULL);
+    if (wlanframesync_set_chanest(fs, chanest, chanest_ntaps) != 0)
+        exit(1);
+    if (wlanframesync_set_chantrack(fs, chantrack_mu) != 0)
+        exit(1);
+    if (wlanframesync_set_profile(fs, profile) != 0)
+        exit(1);
 
     // print header
     char str_buf[256];
@@ -238,6 +278,19 @@ void run_trial(wlanframegen  _fg,
         msg_org[i] = rand() & 0xff;
     wlanframegen_assemble(_fg, msg_org, txvector);
 
+    // generate random multipath channel with exponentially decaying power
+    // profile, normalized to unit energy
+    float complex h[17];
+    float complex h_buf[17];
+    float h_energy = 0.0f;
+    for (i=0; i<=channel_len; i++) {
+        h[i] = i==0 ? 1.0f : (randnf() + _Complex_I*randnf())*M_SQRT1_2*expf(-2.0f*(float)i/(float)channel_len);
+        h_buf[i] = 0.0f;
+        h_energy += crealf(h[i]*conjf(h[i]));
+    }
+    for (i=0; i<=channel_len; i++)
+        h[i] /= sqrtf(h_energy);
+
     // push noise through synchronizer
     unsigned int d = rand() & 0xff;
     for (i=0; i<d; i++) {
@@ -251,9 +304,19 @@ void run_trial(wlanframegen  _fg,
         // write symbol
         last_frame = wlanframegen_writesymbol(_fg, buffer);
 
-        // push through channel (add noise, carrier offset)
-        for (i=0; i<80; i++)
-            buffer[i] = buffer[i]*gamma + nstd*( randnf() + _Complex_I*randnf() )*M_SQRT1_2;
+        // push through channel (multipath, add noise)
+        for (i=0; i<80; i++) {
+            unsigned int j;
+            for (j=channel_len; j>0; j--)
+                h_buf[j] = h_buf[j-1];
+            h_buf[0] = buffer[i];
+
+            float complex y = 0.0f;
+            for (j=0; j<=channel_len; j++)
+                y += h[j]*h_buf[j];
+
+            buffer[i] = y*gamma + nstd*( randnf() + _Complex_I*randnf() )*M_SQRT1_2;
+        }
 
         // run through synchronizer
         wlanframesync_execute(_fs, buffer, 80);
@@ -52,6 +52,7 @@ extern "C" {
 #define LIQUID_WLAN_CONCAT(prefix, name) prefix ## name
 #define LIQUID_WLAN_VALIDATE_INPUT
 
+#include <stdint.h>
 #include <liquid/liquid.h>
 
 // rates
@@ -81,7 +82,37 @@ struct wlan_rxvector_s {
     unsigned int SERVICE;       // NULL: 7 scrambler initialization plus 9 reserved bits
 };
 
-// 
+//
+// transform backend
+//
+
+// backends for OFDM transforms
+#define LIQUID_WLAN_FFT_AUTO        (0) // FFTW if available, otherwise built-in
+#define LIQUID_WLAN_FFT_BUILTIN     (1) // built-in radix-4 kernel
+#define LIQUID_WLAN_FFT_LIQUID      (2) // liquid-dsp fft
+#define LIQUID_WLAN_FFT_FFTW        (3) // FFTW (if library built with it)
+
+// FFTW planning effort
+#define LIQUID_WLAN_FFTW_ESTIMATE   (0)
+#define LIQUID_WLAN_FFTW_MEASURE    (1) // default
+#define LIQUID_WLAN_FFTW_PATIENT    (2)
+
+// select transform backend for objects created hereafter, returning -1
+// if the backend is not available; plans are created once per size and
+// direction and shared between all objects using them
+int liquid_wlan_fft_set_backend(int _backend);
+
+// get transform backend for new objects (AUTO resolved)
+int liquid_wlan_fft_get_backend(void);
+
+// set FFTW planning effort for plans created hereafter
+int liquid_wlan_fft_set_fftw_effort(int _effort);
+
+// import/export FFTW wisdom, returning -1 on failure or without FFTW
+int liquid_wlan_fft_import_wisdom(const char * _filename);
+int liquid_wlan_fft_export_wisdom(const char * _filename);
+
+//
 // wlan frame generator
 //
 
@@ -91,6 +122,15 @@ typedef struct wlanframegen_s * wlanframegen;
 // create WLAN framing generator object
 wlanframegen wlanframegen_create();
 
+// create WLAN framing generator object with output stage: frames written
+// with wlanframegen_write_frame() are interpolated to the given rate with
+// a polyphase resampler and frequency shifted in the same pass
+//  _rate       :   output sample rate relative to 20 M samples/s, in [1,16]
+//                  (e.g. 1.536 for 30.72 M samples/s)
+//  _fshift     :   frequency shift (cycles/output sample), in (-0.5,0.5)
+wlanframegen wlanframegen_create_output(float _rate,
+                                        float _fshift);
+
 // destroy WLAN framing generator object
 void wlanframegen_destroy(wlanframegen _q);
 
@@ -112,12 +152,149 @@ void wlanframegen_assemble(wlanframegen           _q,
                            unsigned char *        _payload,
                            struct wlan_txvector_s _txvector);
 
-// write OFDM symbol, returning '1' when frame is complete
+// write OFDM symbol at 20 M samples/s (bypassing any output stage),
+// returning '1' when frame is complete
 //  _q          :   framing generator object
 //  _buffer     :   output sample buffer [size: 80 x 1]
 int wlanframegen_writesymbol(wlanframegen           _q,
                              liquid_float_complex * _buffer);
 
+// get number of samples in assembled frame, at output rate
+//  _q          :   framing generator object
+unsigned int wlanframegen_get_num_samples(wlanframegen _q);
+
+// get number of samples, at output rate, of a frame with the given
+// framing options without assembling it
+//  _q          :   framing generator object
+//  _txvector   :   framing options
+unsigned int wlanframegen_get_num_samples_txvector(wlanframegen           _q,
+                                                   struct wlan_txvector_s _txvector);
+
+// write entire assembled frame to contiguous buffer in one call,
+// returning the number of samples written
+//  _q          :   framing generator object
+//  _buffer     :   output sample buffer [size: _n x 1]
+//  _n          :   buffer length, at least wlanframegen_get_num_samples()
+unsigned int wlanframegen_write_frame(wlanframegen           _q,
+                                      liquid_float_complex * _buffer,
+                                      unsigned int           _n);
+
+//
+// wlan transmit queue
+//
+
+// inter-frame spacing at 20 M samples/s (samples)
+#define WLANTXQUEUE_SIFS    (320)   // 16 us
+#define WLANTXQUEUE_DIFS    (680)   // 34 us
+
+// forward declaration of WLAN transmit queue; frames pushed onto the
+// queue are encoded ahead on a worker thread and rendered back to back
+// into a caller-supplied ring buffer as one continuous sample stream
+typedef struct wlantxqueue_s * wlantxqueue;
+
+// create WLAN transmit queue object
+//  _ring       :   ring buffer memory, owned by caller [size: _ring_len x 1]
+//  _ring_len   :   ring buffer length (samples)
+//  _max_frames :   maximum number of frames waiting to be rendered
+wlantxqueue wlantxqueue_create(liquid_float_complex * _ring,
+                               unsigned int           _ring_len,
+                               unsigned int           _max_frames);
+
+// destroy WLAN transmit queue object, discarding pending frames
+void wlantxqueue_destroy(wlantxqueue _q);
+
+// print WLAN transmit queue object internals
+void wlantxqueue_print(wlantxqueue _q);
+
+// set inter-frame spacing for frames pushed hereafter (default: SIFS),
+// measured from the end of the last DATA symbol to the start of the
+// next preamble; the ramp-down of each frame overlaps into the gap
+//  _q          :   transmit queue object
+//  _ifs        :   spacing (samples)
+int wlantxqueue_set_ifs(wlantxqueue  _q,
+                        unsigned int _ifs);
+
+// push frame onto queue, returning -1 if the queue is full or the frame
+// is invalid; the payload is copied
+//  _q          :   transmit queue object
+//  _payload    :   raw payload data [size: _txvector.LENGTH x 1], NULL for zeros
+//  _txvector   :   framing options
+int wlantxqueue_push(wlantxqueue            _q,
+                     unsigned char *        _payload,
+                     struct wlan_txvector_s _txvector);
+
+// get number of frames queued or being rendered
+unsigned int wlantxqueue_get_num_pending(wlantxqueue _q);
+
+// read next samples of stream, waiting for the worker while frames are
+// pending and writing zeros when the queue is idle
+//  _q          :   transmit queue object
+//  _buffer     :   output sample buffer [size: _n x 1]
+//  _n          :   number of samples to read
+void wlantxqueue_read(wlantxqueue            _q,
+                      liquid_float_complex * _buffer,
+                      unsigned int           _n);
+
+//
+// wlan multi-channel transmit synthesizer
+//
+
+// forward declaration of WLAN multi-channel synthesizer; each of M
+// channels has its own transmit queue rendered on its own worker thread,
+// and the channels are combined with a polyphase synthesis filterbank
+// into one stream at M x 20 M samples/s. Channel k is centered at
+// k x 20 MHz, or (k-M) x 20 MHz for k >= M/2.
+typedef struct wlansynth_s * wlansynth;
+
+// create WLAN multi-channel synthesizer object
+//  _num_channels   :   number of 20 MHz channels, at least 2
+//  _max_frames     :   maximum number of frames queued per channel
+wlansynth wlansynth_create(unsigned int _num_channels,
+                           unsigned int _max_frames);
+
+// destroy WLAN multi-channel synthesizer object, discarding queued frames
+void wlansynth_destroy(wlansynth _q);
+
+// print WLAN multi-channel synthesizer object internals
+void wlansynth_print(wlansynth _q);
+
+// get number of channels
+unsigned int wlansynth_get_num_channels(wlansynth _q);
+
+// get filterbank delay (output samples); a channel sample at time n
+// appears centered on output sample n*M + delay
+unsigned int wlansynth_get_delay(wlansynth _q);
+
+// set inter-frame spacing (20 M samples/s) for frames pushed hereafter
+// on a channel
+int wlansynth_set_ifs(wlansynth    _q,
+                      unsigned int _channel,
+                      unsigned int _ifs);
+
+// push frame onto channel queue, returning -1 if the queue is full or
+// the channel or frame is invalid; the payload is copied
+//  _q          :   synthesizer object
+//  _channel    :   channel index in [0,M)
+//  _payload    :   raw payload data [size: _txvector.LENGTH x 1], NULL for zeros
+//  _txvector   :   framing options
+int wlansynth_push(wlansynth              _q,
+                   unsigned int           _channel,
+                   unsigned char *        _payload,
+                   struct wlan_txvector_s _txvector);
+
+// get number of frames queued or being rendered on a channel
+unsigned int wlansynth_get_num_pending(wlansynth    _q,
+                                       unsigned int _channel);
+
+// generate wideband output samples, waiting on channels with frames
+// pending; idle channels contribute zeros
+//  _q          :   synthesizer object
+//  _buffer     :   output sample buffer [size: _n x 1]
+//  _n          :   number of samples, a multiple of the number of channels
+void wlansynth_execute(wlansynth              _q,
+                       liquid_float_complex * _buffer,
+                       unsigned int           _n);
+
 
 // 
 // wlan frame synchronizer
@@ -137,6 +314,21 @@ typedef int (*wlanframesync_callback)(int                    _header_valid,
                                       framesyncstats_s       _stats,
                                       void *                 _userdata);
 
+// header callback return values
+#define WLANFRAMESYNC_HEADER_DECODE (0) // receive and decode DATA field
+#define WLANFRAMESYNC_HEADER_SKIP   (1) // fast-forward over DATA field without processing it
+#define WLANFRAMESYNC_HEADER_ABORT  (2) // drop frame and resume searching immediately
+
+// header callback, invoked once the SIGNAL field has been decoded
+// successfully and before any DATA symbol is processed
+//  _rxvector       : received vector (see Table 77)
+//  _stats          : frame synchronizer statistics
+//  _userdata       : user-defined data object
+//  returns action to take, e.g. WLANFRAMESYNC_HEADER_SKIP
+typedef int (*wlanframesync_header_callback)(struct wlan_rxvector_s _rxvector,
+                                             framesyncstats_s       _stats,
+                                             void *                 _userdata);
+
 // create WLAN framing synchronizer object
 //  _callback   :   user-defined callback function
 //  _userdata   :   user-defined data structure
@@ -160,6 +352,168 @@ void wlanframesync_execute(wlanframesync          _q,
                            liquid_float_complex * _buffer,
                            unsigned int           _n);
 
+// execute framing synchronizer on interleaved 16-bit I/Q input (cs16),
+// scaled such that 32768 is full scale
+//  _q      :   framing synchronizer object
+//  _buffer :   input buffer [size: 2*_n x 1]
+//  _n      :   number of complex input samples
+void wlanframesync_execute_cs16(wlanframesync   _q,
+                                const int16_t * _buffer,
+                                unsigned int    _n);
+
+// execute framing synchronizer on interleaved 8-bit I/Q input (cs8),
+// scaled such that 128 is full scale
+//  _q      :   framing synchronizer object
+//  _buffer :   input buffer [size: 2*_n x 1]
+//  _n      :   number of complex input samples
+void wlanframesync_execute_cs8(wlanframesync  _q,
+                               const int8_t * _buffer,
+                               unsigned int   _n);
+
+// receive profiles
+#define WLANFRAMESYNC_PROFILE_FLOAT (0) // floating-point DATA path, hard-decision decoding (default)
+#define WLANFRAMESYNC_PROFILE_Q15   (1) // 16-bit fixed-point DATA path, soft-decision decoding
+
+// set receive profile; the Q15 profile runs the DATA symbol transform,
+// pilot tracking, equalization and demodulation in 16-bit fixed point
+// and passes integer soft bits to the Viterbi decoder. Preamble
+// acquisition and the SIGNAL field are unchanged. Decision-directed
+// channel tracking is not supported, so selecting the Q15 profile while
+// tracking is enabled fails (returns -1). Buffers are re-sized for the new
+// profile, so a frame whose DATA field is being received is discarded
+// and the synchronizer resumes searching for the next frame; frames
+// already handed to the pipelined decoder are delivered first.
+//  _q          :   framing synchronizer object
+//  _profile    :   receive profile, e.g. WLANFRAMESYNC_PROFILE_Q15
+int wlanframesync_set_profile(wlanframesync _q,
+                              int           _profile);
+
+// set idle-channel threshold: while searching for frames, 64-sample
+// blocks whose mean energy falls below the threshold are not examined
+// for a preamble (default: disabled)
+//  _q          :   framing synchronizer object
+//  _threshold  :   mean sample energy threshold [dB full scale], -INFINITY to disable
+int wlanframesync_set_squelch(wlanframesync _q,
+                              float         _threshold);
+
+// set maximum accepted payload length; all per-frame buffers are sized
+// for this length up front so that nothing is allocated while receiving,
+// and frames announcing a longer payload are rejected (default: 4095)
+//  _q          :   framing synchronizer object
+//  _max_length :   maximum payload length [bytes], in [1,4095]
+int wlanframesync_set_max_length(wlanframesync _q,
+                                 unsigned int  _max_length);
+
+// set symbol capture depth: the first _num_symbols equalized data
+// subcarrier symbols of each frame are passed to the callback in
+// framesyms (default: 0, disabled)
+//  _q          :   framing synchronizer object
+//  _num_symbols:   maximum number of symbols captured per frame
+int wlanframesync_set_symbol_capture(wlanframesync _q,
+                                     unsigned int  _num_symbols);
+
+// pipelined decoder statistics
+typedef struct {
+    unsigned int num_frames_queued;     // number of frames handed to decoder
+    unsigned int num_frames_decoded;    // number of frames decoded and delivered
+    unsigned int num_frames_dropped;    // number of frames dropped (no free buffer)
+    unsigned int queue_depth;           // number of frames currently pending
+    unsigned int queue_depth_max;       // maximum number of frames pending
+    float        latency_avg;           // average decode latency [s]
+    float        latency_max;           // maximum decode latency [s]
+} wlanframesync_decoderstats_s;
+
+// enable pipelined decoding: completed frames are handed to a pool of
+// worker threads which decode the payload and invoke the callback, while
+// the calling thread immediately resumes searching for frames. Note that
+// with more than one thread, callbacks can run concurrently and frames
+// can be delivered out of order.
+//  _q              :   framing synchronizer object
+//  _num_threads    :   number of decoder threads (0: decode inline, default)
+//  _num_buffers    :   number of frame buffers (maximum pending frames)
+int wlanframesync_set_decoder_threads(wlanframesync _q,
+                                      unsigned int  _num_threads,
+                                      unsigned int  _num_buffers);
+
+// block until all pending frames have been decoded and delivered
+int wlanframesync_flush(wlanframesync _q);
+
+// get/reset pipelined decoder statistics
+wlanframesync_decoderstats_s wlanframesync_get_decoderstats(wlanframesync _q);
+int wlanframesync_reset_decoderstats(wlanframesync _q);
+
+// channel estimation methods
+#define WLANFRAMESYNC_CHANEST_POLY  (0) // polynomial fit of gain magnitude/phase (default)
+#define WLANFRAMESYNC_CHANEST_LTS   (1) // averaged long sequences, per-subcarrier zero-forcing
+#define WLANFRAMESYNC_CHANEST_DFT   (2) // averaged long sequences, time-domain tap truncation
+
+// set channel estimation method
+//  _q      :   framing synchronizer object
+//  _method :   channel estimator, e.g. WLANFRAMESYNC_CHANEST_POLY
+//  _ntaps  :   number of time-domain taps (WLANFRAMESYNC_CHANEST_DFT only)
+int wlanframesync_set_chanest(wlanframesync _q,
+                              int           _method,
+                              unsigned int  _ntaps);
+
+// set decision-directed channel tracking step size; when enabled, the
+// equalizer is updated on every DATA symbol from re-modulated hard
+// decisions to follow time-varying channels over long frames; not
+// supported with the Q15 profile, for which a non-zero step size fails
+// (returns -1)
+//  _q      :   framing synchronizer object
+//  _mu     :   step size in [0,1), 0 to disable (default)
+int wlanframesync_set_chantrack(wlanframesync _q,
+                                float         _mu);
+
+// set header callback; the callback runs on the calling thread even
+// when pipelined decoding is enabled, and receives the same userdata
+// pointer as the frame callback
+//  _q          :   framing synchronizer object
+//  _callback   :   header callback function (NULL to decode every frame)
+int wlanframesync_set_header_callback(wlanframesync                 _q,
+                                      wlanframesync_header_callback _callback);
+
+// airtime statistics for frames with a valid header
+typedef struct {
+    unsigned int       num_frames_decoded;  // number of frames whose DATA field was received
+    unsigned int       num_frames_skipped;  // number of frames whose DATA field was skipped
+    unsigned int       num_frames_aborted;  // number of frames aborted after the header
+    unsigned long long num_samples_decoded; // DATA field samples received
+    unsigned long long num_samples_skipped; // DATA field samples skipped
+} wlanframesync_airtimestats_s;
+
+// get/reset airtime statistics
+wlanframesync_airtimestats_s wlanframesync_get_airtimestats(wlanframesync _q);
+int wlanframesync_reset_airtimestats(wlanframesync _q);
+
+// profiling counter
+typedef struct {
+    unsigned long long num_samples;     // samples processed
+    unsigned long long time_ns;         // processing time [ns]
+} wlanframesync_profilecounter_s;
+
+// processing time and number of samples in each synchronizer state, and
+// for payload decoding; collected only when the library is built with
+// WLANFRAMESYNC_PROFILING enabled. Time spent in callbacks is charged to
+// the state invoking them. Payload decoding is excluded from rxdata and
+// counted only when decoding inline, with the DATA field samples of each
+// decoded frame.
+typedef struct {
+    int                            enabled;  // counters compiled in
+    wlanframesync_profilecounter_s seekplcp; // searching for preamble
+    wlanframesync_profilecounter_s rxshort0; // receiving first short sequence
+    wlanframesync_profilecounter_s rxshort1; // receiving second short sequence
+    wlanframesync_profilecounter_s rxlong;   // receiving long sequences
+    wlanframesync_profilecounter_s rxsignal; // receiving SIGNAL field
+    wlanframesync_profilecounter_s rxdata;   // receiving DATA field
+    wlanframesync_profilecounter_s skipdata; // skipping DATA field
+    wlanframesync_profilecounter_s decode;   // decoding payload
+} wlanframesync_profilestats_s;
+
+// get/reset profiling statistics
+wlanframesync_profilestats_s wlanframesync_get_profilestats(wlanframesync _q);
+int wlanframesync_reset_profilestats(wlanframesync _q);
+
 // query methods
 float wlanframesync_get_rssi(wlanframesync _q); // received signal strength indication
 float wlanframesync_get_cfo(wlanframesync _q);  // carrier offset estimate
@@ -57,26 +57,32 @@ void liquid_wlan_repack_bytes(unsigned char * _sym_in,
                               unsigned int    _sym_out_len,
                               unsigned int *  _num_written);
 
-// Use fftw library if installed, otherwise use liquid-dsp (less
-// efficient) fft library.
-#if HAVE_FFTW3_H
-#   include <fftw3.h>
-#   define FFT_PLAN             fftwf_plan
-#   define FFT_CREATE_PLAN      fftwf_plan_dft_1d
-#   define FFT_DESTROY_PLAN     fftwf_destroy_plan
-#   define FFT_EXECUTE          fftwf_execute
-#   define FFT_DIR_FORWARD      FFTW_FORWARD
-#   define FFT_DIR_BACKWARD     FFTW_BACKWARD
-#   define FFT_METHOD           FFTW_ESTIMATE
-#else
-#   define FFT_PLAN             fftplan
-#   define FFT_CREATE_PLAN      fft_create_plan
-#   define FFT_DESTROY_PLAN     fft_destroy_plan
-#   define FFT_EXECUTE          fft_execute
-#   define FFT_DIR_FORWARD      LIQUID_FFT_FORWARD
-#   define FFT_DIR_BACKWARD     LIQUID_FFT_BACKWARD
-#   define FFT_METHOD           0
-#endif
+//
+// transforms
+//
+
+#define WLAN_FFT_FORWARD    (0)
+#define WLAN_FFT_BACKWARD   (1)
+
+// transform bound to input/output buffers, run with the backend selected
+// by liquid_wlan_fft_set_backend() at the time of creation; plans are
+// shared between objects of the same size and direction
+typedef struct wlan_fft_s * wlan_fft;
+
+// create transform object (unnormalized)
+//  _n      :   transform size
+//  _x      :   input buffer [size: _n x 1]
+//  _y      :   output buffer [size: _n x 1], may be the same as _x
+//  _dir    :   direction, e.g. WLAN_FFT_FORWARD
+wlan_fft wlan_fft_create(unsigned int    _n,
+                         float complex * _x,
+                         float complex * _y,
+                         int             _dir);
+void wlan_fft_destroy(wlan_fft _q);
+void wlan_fft_execute(wlan_fft _q);
+
+// get backend used by transform object, e.g. LIQUID_WLAN_FFT_BUILTIN
+int wlan_fft_get_backend(wlan_fft _q);
 
 //
 // wi-fi frame (common objects)
@@ -269,6 +275,16 @@ void wlan_fec_decode(unsigned int    _fec_scheme,
                      unsigned char * _msg_enc,
                      unsigned char * _msg_dec);
 
+// decode data using convolutional code from soft bits
+//  _fec_scheme :   error-correction scheme
+//  _dec_msg_len:   length of decoded message
+//  _soft_enc   :   encoded soft bits, one per coded bit (punctured)
+//  _msg_dec    :   decoded message (with tail bits inserted)
+void wlan_fec_decode_soft(unsigned int          _fec_scheme,
+                          unsigned int          _dec_msg_len,
+                          const unsigned char * _soft_enc,
+                          unsigned char *       _msg_dec);
+
 
 //
 // data scrambler/de-scrambler
@@ -335,6 +351,14 @@ void wlan_interleaver_decode_symbol(unsigned int    _rate,
                                     unsigned char * _msg_dec,
                                     unsigned char * _msg_enc);
 
+// de-intereleave one OFDM symbol of soft bits
+//  _rate       :   primitive rate
+//  _soft_enc   :   encoded soft bits (interleaved) [size: ncbps x 1]
+//  _soft_dec   :   decoded soft bits (de-iterleaved) [size: ncbps x 1]
+void wlan_interleaver_decode_symbol_soft(unsigned int          _rate,
+                                         const unsigned char * _soft_enc,
+                                         unsigned char *       _soft_dec);
+
 
 //
 // high-level packet encoder/decoder
@@ -344,6 +368,9 @@ void wlan_interleaver_decode_symbol(unsigned int    _rate,
 unsigned int wlan_packet_compute_enc_msg_len(unsigned int _rate,
                                              unsigned int _length);
 
+// compute maximum encoded message length across all rates
+unsigned int wlan_packet_compute_enc_msg_len_max(unsigned int _length);
+
 // assemble data (prepend SERVICE bits, etc.), scramble, encode, interleave
 void wlan_packet_encode(unsigned int    _rate,
                         unsigned int    _seed,
@@ -358,6 +385,18 @@ void wlan_packet_decode(unsigned int    _rate,
                         unsigned char * _msg_enc,
                         unsigned char * _msg_dec);
 
+// de-interleave, decode, de-scramble, extract data from soft bits
+//  _rate       :   primitive rate
+//  _seed       :   data scrambler seed
+//  _length     :   original data length (bytes)
+//  _soft_enc   :   encoded soft bits, one per coded bit [size: 8*enc_msg_len x 1]
+//  _msg_dec    :   recovered data [size: _length x 1]
+void wlan_packet_decode_soft(unsigned int          _rate,
+                             unsigned int          _seed,
+                             unsigned int          _length,
+                             const unsigned char * _soft_enc,
+                             unsigned char *       _msg_dec);
+
 // 
 // modem (modulation/demodulation)
 //
@@ -386,6 +425,44 @@ unsigned char wlan_demodulate_qpsk(float complex _sample);
 unsigned char wlan_demodulate_qam16(float complex _sample);
 unsigned char wlan_demodulate_qam64(float complex _sample);
 
+// soft demodulation of Q12 equalized sample (4096 = 1.0), writing one
+// soft bit per coded bit (LIQUID_WLAN_SOFTBIT_0..1, most-significant
+// bit first)
+//  _scheme     :   modulation scheme, e.g. WLAN_MODEM_QAM16
+//  _re, _im    :   equalized sample, Q12
+//  _weight     :   soft bit scaling, Q16 (see wlan_demodulate_soft_weight)
+//  _soft       :   output soft bits [size: nbpsc x 1]
+void wlan_demodulate_soft(unsigned int    _scheme,
+                          int32_t         _re,
+                          int32_t         _im,
+                          int32_t         _weight,
+                          unsigned char * _soft);
+
+// compute soft bit scaling for a subcarrier, mapping a sample half the
+// minimum constellation distance from a decision boundary to 32 soft
+// bit steps
+//  _scheme     :   modulation scheme, e.g. WLAN_MODEM_QAM16
+//  _csi        :   relative subcarrier reliability (e.g. |H|^2 / mean |H|^2)
+int32_t wlan_demodulate_soft_weight(unsigned int _scheme,
+                                    float        _csi);
+
+
+//
+// fixed-point (Q15) arithmetic
+//
+
+// sine/cosine of binary angle (65536 = 2 pi), Q15
+int16_t wlan_q15_sin(uint16_t _theta);
+int16_t wlan_q15_cos(uint16_t _theta);
+
+// four-quadrant arctangent, returning binary angle (65536 = 2 pi)
+int16_t wlan_q15_atan2(int32_t _y,
+                       int32_t _x);
+
+// 64-point forward transform on interleaved Q15 samples, in place, with
+// output scaled by 1/8
+//  _x      :   input/output [size: 128 x 1], [re, im] pairs
+void wlan_fft64_q15(int16_t * _x);
 
 // 
 // wlan framing
@@ -403,10 +480,48 @@ extern const float complex wlanframe_s1[64]; // time
 #define WLANFRAME_SCTYPE_PILOT  1
 #define WLANFRAME_SCTYPE_DATA   2
 
+//
+// output stage (arbitrary-rate interpolator and frequency shift)
+//
+
+typedef struct wlan_resamp_s * wlan_resamp;
+
+// create output stage
+//  _rate   :   output/input sample rate ratio, 1 <= _rate <= 16
+//  _fshift :   frequency shift (cycles/output sample), |_fshift| < 0.5
+wlan_resamp wlan_resamp_create(float _rate,
+                               float _fshift);
+void wlan_resamp_destroy(wlan_resamp _q);
+void wlan_resamp_print(wlan_resamp _q);
+
+// get number of zero samples required before and after input
+unsigned int wlan_resamp_get_padding(wlan_resamp _q);
+
+// get number of output samples for burst of _nx input samples
+unsigned int wlan_resamp_get_num_output(wlan_resamp  _q,
+                                        unsigned int _nx);
+
+// resample and shift burst, returning number of output samples written
+//  _q      :   output stage
+//  _x      :   input burst with wlan_resamp_get_padding() zeros before
+//              and after [size: _nx + 2*padding x 1]
+//  _nx     :   number of input samples, excluding padding
+//  _y      :   output [size: wlan_resamp_get_num_output(_nx) x 1]
+unsigned int wlan_resamp_execute(wlan_resamp           _q,
+                                 const float complex * _x,
+                                 unsigned int          _nx,
+                                 float complex *       _y);
+
 //
 // wi-fi frame generator (internal methods)
 //
 
+// render assembled frame at 20 M samples/s
+//  _q          :   framing generator object
+//  _buffer     :   output sample buffer [size: 80*framelen x 1]
+void wlanframegen_render_frame(wlanframegen    _q,
+                               float complex * _buffer);
+
 // compute symbol: add/update pilots, add nulls and compute transform
 //  * input stored in 'X' (internal ifft input)
 //  * output stored in 'x' (internal ifft output)
@@ -430,9 +545,67 @@ void wlanframegen_writesymbol_S0b(wlanframegen _q, float complex * _buffer);
 void wlanframegen_writesymbol_S1a(wlanframegen _q, float complex * _buffer);
 void wlanframegen_writesymbol_S1b(wlanframegen _q, float complex * _buffer);
 void wlanframegen_writesymbol_signal(wlanframegen _q, float complex * _buffer);
+void wlanframegen_writesymbol_signal_cached(wlanframegen _q, float complex * _buffer);
 void wlanframegen_writesymbol_data(wlanframegen _q, float complex * _buffer);
 void wlanframegen_writesymbol_null(wlanframegen _q, float complex * _buffer);
 
+//
+// pipelined payload decoder (worker thread pool)
+//
+
+// frame buffer handed from synchronizer to decoder
+struct wlan_decoder_job_s {
+    int             header_valid;   // SIGNAL field decoded properly?
+    unsigned int    rate;           // primitive data rate
+    unsigned int    seed;           // data scrambler seed
+    unsigned int    length;         // original data length (bytes)
+    struct wlan_rxvector_s rxvector;// received vector
+    framesyncstats_s stats;         // frame statistics
+    unsigned char * msg_enc;        // encoded message (DATA field)
+    unsigned char * msg_dec;        // decoded message (DATA field)
+    int             soft;           // DATA field stored as soft bits?
+    unsigned char * msg_soft;       // encoded soft bits (NULL unless fixed-point profile)
+    float complex * buf_syms;       // frame symbols
+    unsigned int    buf_syms_len;   // maximum number of frame symbols
+    double          timestamp;      // time frame was submitted [s]
+    unsigned int    next;           // free-list link (index+1, 0: end)
+};
+
+typedef struct wlan_decoder_s * wlan_decoder;
+
+// create pipelined decoder object
+//  _num_threads    :   number of worker threads (at least 1)
+//  _num_buffers    :   number of frame buffers (maximum pending frames)
+//  _max_length     :   maximum payload length (bytes)
+//  _soft           :   allocate soft-bit buffers (fixed-point profile)?
+//  _buf_syms_len   :   number of frame symbols stored per frame
+//  _callback       :   user-defined callback function
+//  _userdata       :   user-defined data structure
+wlan_decoder wlan_decoder_create(unsigned int           _num_threads,
+                                 unsigned int           _num_buffers,
+                                 unsigned int           _max_length,
+                                 int                    _soft,
+                                 unsigned int           _buf_syms_len,
+                                 wlanframesync_callback _callback,
+                                 void *                 _userdata);
+
+// destroy pipelined decoder object, decoding all pending frames first
+void wlan_decoder_destroy(wlan_decoder _q);
+
+// acquire free frame buffer (lock-free), NULL if none is available
+struct wlan_decoder_job_s * wlan_decoder_acquire(wlan_decoder _q);
+
+// submit filled frame buffer for decoding
+void wlan_decoder_submit(wlan_decoder                _q,
+                         struct wlan_decoder_job_s * _job);
+
+// block until all submitted frames have been decoded and delivered
+void wlan_decoder_flush(wlan_decoder _q);
+
+// get/reset decoder statistics
+wlanframesync_decoderstats_s wlan_decoder_get_stats(wlan_decoder _q);
+void wlan_decoder_reset_stats(wlan_decoder _q);
+
 //
 // wi-fi frame synchronizer (internal methods)
 //
@@ -440,17 +613,22 @@ void wlanframegen_writesymbol_null(wlanframegen _q, float complex * _buffer);
 void wlanframesync_execute_seekplcp(wlanframesync _q);
 void wlanframesync_execute_rxshort0(wlanframesync _q);
 void wlanframesync_execute_rxshort1(wlanframesync _q);
-void wlanframesync_execute_rxlong0(wlanframesync _q);
-void wlanframesync_execute_rxlong1(wlanframesync _q);
+void wlanframesync_execute_rxlong(wlanframesync _q);
 void wlanframesync_execute_rxsignal(wlanframesync _q);
 void wlanframesync_execute_rxdata(wlanframesync _q);
 
-// estimate short sequence gain
+// fast-forward over DATA field of skipped frame
 //  _q      :   wlanframesync object
-//  _x      :   input array (time), [size: M x 1]
-//  _G      :   output gain (freq)
-void wlanframesync_estimate_gain_S0(wlanframesync _q,
-                                    float complex * _x,
+//  _n      :   number of input samples available
+//  returns number of samples consumed (at least one)
+unsigned int wlanframesync_execute_skipdata(wlanframesync _q,
+                                            unsigned int  _n);
+
+// estimate short sequence gain from 16-sample fold of input, computing
+// only the 12 occupied subcarriers
+//  _x      :   input array (time), [size: 64 x 1]
+//  _G      :   output gain (freq), [size: 64 x 1]
+void wlanframesync_estimate_gain_S0(float complex * _x,
                                     float complex * _G);
 
 // compute S0 metrics
@@ -475,18 +653,69 @@ void wlanframesync_S1_metrics(wlanframesync _q,
                               float complex * _G,
                               float complex * _s_hat);
 
+// compute next block of long sequence matched filter outputs
+void wlanframesync_S1_correlate(wlanframesync _q);
+
+// find start of S1[a] from matched filter output (-1 if not found)
+int wlanframesync_S1_timing(wlanframesync _q);
+
+// estimate long sequence gains, carrier offset, and equalizer
+//  _q      :   wlanframesync object
+//  _k      :   start of S1[a] in search buffer
+void wlanframesync_S1_acquire(wlanframesync _q,
+                              unsigned int  _k);
+
 // estimate carrier frequency offset from S1 gains
 float wlanframesync_estimate_cfo_S1(float complex * _G1a,
                                     float complex * _G1b);
 
-// estimate equalizer gain from internal S1 gains using polynomial
+// estimate equalizer gain from averaged S1 gains with selected method
+void wlanframesync_estimate_eqgain(wlanframesync _q);
+
+// estimate equalizer gain from averaged S1 gains using polynomial
 void wlanframesync_estimate_eqgain_poly(wlanframesync _q);
 
+// estimate equalizer gain from averaged S1 gains (zero-forcing)
+void wlanframesync_estimate_eqgain_lts(wlanframesync _q);
+
+// estimate equalizer gain from averaged S1 gains, truncating impulse
+// response to _ntaps taps
+void wlanframesync_estimate_eqgain_dft(wlanframesync _q,
+                                       unsigned int  _ntaps);
+
+// compute zero-forcing equalizer correction from composite gain
+void wlanframesync_estimate_eqgain_zf(wlanframesync _q);
+
 // recover symbol, correcting for gain, pilot phase, etc.
 void wlanframesync_rxsymbol(wlanframesync _q);
 
+// adjust NCO frequency based on differential common pilot phase
+//  _q      :   wlanframesync object
+//  _p0     :   common phase of current symbol [radians]
+void wlanframesync_track_phase(wlanframesync _q,
+                               float         _p0);
+
+// receive data symbol: transform, equalize, hard demodulate and pack
+void wlanframesync_rxdata_symbol(wlanframesync _q);
+
+// receive data symbol using the fixed-point (Q15) profile
+void wlanframesync_rxdata_symbol_q15(wlanframesync _q);
+
+// compute fixed-point equalizer and soft bit weights from the
+// floating-point equalizer, once per frame
+void wlanframesync_estimate_eqgain_q15(wlanframesync _q);
+
 // decode SIGNAL field
 void wlanframesync_decode_signal(wlanframesync _q);
 
+// allocate message buffers for the maximum payload length
+void wlanframesync_alloc_buffers(wlanframesync _q);
+
+// (re-)create pipelined decoder with current configuration
+void wlanframesync_create_decoder(wlanframesync _q);
+
+// hand received DATA field off to pipelined decoder
+void wlanframesync_submit_payload(wlanframesync _q);
+
 #endif // __LIQUID_WLAN_INTERNAL_H__
 
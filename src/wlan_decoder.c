@@ -0,0 +1,306 @@
+// pipelined payload decoder (worker thread pool)
+//
+// The frame synchronizer hands each completed frame (encoded DATA
+// field, RX vector and statistics) to this object which runs the
+// de-interleaver/Viterbi/de-scrambler and invokes the user callback on
+// one of its worker threads. Frame buffers are pre-allocated and
+// recycled through a lock-free free-list so that the sample thread
+// never blocks on the allocator or on the decoder.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "liquid-wlan.internal.h"
+
+struct wlan_decoder_s {
+    // callback
+    wlanframesync_callback callback;    // user-defined callback function
+    void *                 userdata;    // user-defined context field
+
+    // frame buffers
+    unsigned int              num_jobs; // number of frame buffers
+    struct wlan_decoder_job_s * jobs;   // frame buffers [size: num_jobs x 1]
+    uint64_t                  free_head;// free-list head: ABA tag (upper) | index+1 (lower)
+
+    // pending queue (ring buffer of frame buffers ready for decoding)
+    struct wlan_decoder_job_s ** queue; // [size: num_jobs x 1]
+    unsigned int    read_index;         // queue read index
+    unsigned int    num_pending;        // number of frames in queue
+    unsigned int    num_busy;           // number of frames being decoded
+    pthread_mutex_t mutex;              // protects queue and statistics
+    pthread_cond_t  cond_work;          // signaled when work is available
+    pthread_cond_t  cond_idle;          // signaled when a frame completes
+
+    // worker threads
+    unsigned int    num_threads;        // number of worker threads
+    pthread_t *     threads;            // worker threads [size: num_threads x 1]
+    int             running;            // flag indicating threads should run
+
+    // statistics
+    wlanframesync_decoderstats_s stats; // decoder statistics
+    double          latency_sum;        // accumulated latency [s]
+};
+
+// get monotonic time [s]
+static double wlan_decoder_gettime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+// pop frame buffer from lock-free free-list, NULL if empty
+static struct wlan_decoder_job_s * wlan_decoder_freelist_pop(wlan_decoder _q)
+{
+    uint64_t head = __atomic_load_n(&_q->free_head, __ATOMIC_ACQUIRE);
+    while (1) {
+        uint32_t index = (uint32_t)(head & 0xffffffff);
+        if (index == 0)
+            return NULL;
+
+        // replace head with next link, incrementing tag to avoid ABA
+        struct wlan_decoder_job_s * job = &_q->jobs[index-1];
+        uint32_t next = __atomic_load_n(&job->next, __ATOMIC_RELAXED);
+        uint64_t head_new = (((head >> 32) + 1) << 32) | (uint64_t)next;
+        if (__atomic_compare_exchange_n(&_q->free_head, &head, head_new, 1,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            return job;
+    }
+}
+
+// push frame buffer onto lock-free free-list
+static void wlan_decoder_freelist_push(wlan_decoder                _q,
+                                       struct wlan_decoder_job_s * _job)
+{
+    uint32_t index = (uint32_t)(_job - _q->jobs) + 1;
+    uint64_t head = __atomic_load_n(&_q->free_head, __ATOMIC_ACQUIRE);
+    uint64_t head_new;
+    do {
+        __atomic_store_n(&_job->next, (uint32_t)(head & 0xffffffff), __ATOMIC_RELAXED);
+        head_new = (((head >> 32) + 1) << 32) | (uint64_t)index;
+    } while (!__atomic_compare_exchange_n(&_q->free_head, &head, head_new, 1,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+}
+
+// decode frame buffer and invoke callback
+static void wlan_decoder_process(wlan_decoder                _q,
+                                 struct wlan_decoder_job_s * _job)
+{
+    unsigned char * payload = NULL;
+    if (_job->header_valid) {
+        // de-interleave, decode, de-scramble
+        if (_job->soft)
+            wlan_packet_decode_soft(_job->rate, _job->seed, _job->length, _job->msg_soft, _job->msg_dec);
+        else
+            wlan_packet_decode(_job->rate, _job->seed, _job->length, _job->msg_enc, _job->msg_dec);
+        payload = _job->msg_dec;
+    }
+
+    // point frame symbols to local copy
+    _job->stats.framesyms = _job->buf_syms;
+
+    // invoke callback
+    if (_q->callback != NULL)
+        _q->callback(_job->header_valid, payload, _job->rxvector, _job->stats, _q->userdata);
+}
+
+// worker thread
+static void * wlan_decoder_worker(void * _arg)
+{
+    wlan_decoder q = (wlan_decoder) _arg;
+
+    pthread_mutex_lock(&q->mutex);
+    while (1) {
+        // wait for work
+        while (q->running && q->num_pending == 0)
+            pthread_cond_wait(&q->cond_work, &q->mutex);
+
+        // drain queue before stopping
+        if (q->num_pending == 0)
+            break;
+
+        // pop frame from queue
+        struct wlan_decoder_job_s * job = q->queue[q->read_index];
+        q->read_index = (q->read_index + 1) % q->num_jobs;
+        q->num_pending--;
+        q->num_busy++;
+        pthread_mutex_unlock(&q->mutex);
+
+        // decode frame and invoke callback outside lock
+        wlan_decoder_process(q, job);
+        double latency = wlan_decoder_gettime() - job->timestamp;
+
+        // update statistics
+        pthread_mutex_lock(&q->mutex);
+        q->num_busy--;
+        q->stats.num_frames_decoded++;
+        q->latency_sum += latency;
+        if (latency > q->stats.latency_max)
+            q->stats.latency_max = latency;
+        pthread_cond_broadcast(&q->cond_idle);
+
+        // return buffer to free-list
+        wlan_decoder_freelist_push(q, job);
+    }
+    pthread_mutex_unlock(&q->mutex);
+    return NULL;
+}
+
+// create pipelined decoder object
+//  _num_threads    :   number of worker threads (at least 1)
+//  _num_buffers    :   number of frame buffers (maximum pending frames)
+//  _max_length     :   maximum payload length (bytes)
+//  _soft           :   allocate soft-bit rather than hard-decision buffers (fixed-point profile)?
+//  _buf_syms_len   :   number of frame symbols stored per frame
+//  _callback       :   user-defined callback function
+//  _userdata       :   user-defined data structure
+wlan_decoder wlan_decoder_create(unsigned int           _num_threads,
+                                 unsigned int           _num_buffers,
+                                 unsigned int           _max_length,
+                                 int                    _soft,
+                                 unsigned int           _buf_syms_len,
+                                 wlanframesync_callback _callback,
+                                 void *                 _userdata)
+{
+    // validate input
+    if (_num_threads == 0) {
+        fprintf(stderr,"error: wlan_decoder_create(), number of threads must be greater than zero\n");
+        exit(1);
+    } else if (_num_buffers == 0) {
+        fprintf(stderr,"error: wlan_decoder_create(), number of buffers must be greater than zero\n");
+        exit(1);
+    }
+
+    // allocate main object memory
+    wlan_decoder q = (wlan_decoder) malloc(sizeof(struct wlan_decoder_s));
+    q->callback    = _callback;
+    q->userdata    = _userdata;
+    q->num_jobs    = _num_buffers;
+    q->num_threads = _num_threads;
+
+    // allocate frame buffers, sized for the largest accepted frame,
+    // and link them all into the free-list
+    unsigned int enc_msg_len_max = wlan_packet_compute_enc_msg_len_max(_max_length);
+    q->jobs  = (struct wlan_decoder_job_s*) malloc(q->num_jobs*sizeof(struct wlan_decoder_job_s));
+    q->queue = (struct wlan_decoder_job_s**) malloc(q->num_jobs*sizeof(struct wlan_decoder_job_s*));
+    unsigned int i;
+    for (i=0; i<q->num_jobs; i++) {
+        q->jobs[i].msg_enc      = _soft ? NULL : (unsigned char*) malloc(enc_msg_len_max*sizeof(unsigned char));
+        q->jobs[i].msg_dec      = (unsigned char*) malloc(_max_length*sizeof(unsigned char));
+        q->jobs[i].msg_soft     = _soft ? (unsigned char*) malloc(8*enc_msg_len_max*sizeof(unsigned char)) : NULL;
+        q->jobs[i].buf_syms_len = _buf_syms_len;
+        q->jobs[i].buf_syms     = _buf_syms_len > 0 ? (float complex*) malloc(_buf_syms_len*sizeof(float complex)) : NULL;
+        q->jobs[i].next         = (i+1 < q->num_jobs) ? i+2 : 0;
+    }
+    q->free_head = 1;
+
+    // initialize queue, statistics
+    q->read_index  = 0;
+    q->num_pending = 0;
+    q->num_busy    = 0;
+    memset(&q->stats, 0x00, sizeof(wlanframesync_decoderstats_s));
+    q->latency_sum = 0.0;
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond_work, NULL);
+    pthread_cond_init(&q->cond_idle, NULL);
+
+    // start worker threads
+    q->running = 1;
+    q->threads = (pthread_t*) malloc(q->num_threads*sizeof(pthread_t));
+    for (i=0; i<q->num_threads; i++)
+        pthread_create(&q->threads[i], NULL, wlan_decoder_worker, q);
+
+    return q;
+}
+
+// destroy pipelined decoder object, decoding all pending frames first
+void wlan_decoder_destroy(wlan_decoder _q)
+{
+    // signal threads to stop once queue is empty and wait for them
+    pthread_mutex_lock(&_q->mutex);
+    _q->running = 0;
+    pthread_cond_broadcast(&_q->cond_work);
+    pthread_mutex_unlock(&_q->mutex);
+
+    unsigned int i;
+    for (i=0; i<_q->num_threads; i++)
+        pthread_join(_q->threads[i], NULL);
+
+    pthread_mutex_destroy(&_q->mutex);
+    pthread_cond_destroy(&_q->cond_work);
+    pthread_cond_destroy(&_q->cond_idle);
+
+    // free frame buffers
+    for (i=0; i<_q->num_jobs; i++) {
+        free(_q->jobs[i].msg_enc);
+        free(_q->jobs[i].msg_dec);
+        free(_q->jobs[i].msg_soft);
+        free(_q->jobs[i].buf_syms);
+    }
+    free(_q->jobs);
+    free(_q->queue);
+    free(_q->threads);
+    free(_q);
+}
+
+// acquire free frame buffer (lock-free), NULL if none is available
+struct wlan_decoder_job_s * wlan_decoder_acquire(wlan_decoder _q)
+{
+    struct wlan_decoder_job_s * job = wlan_decoder_freelist_pop(_q);
+    if (job == NULL) {
+        pthread_mutex_lock(&_q->mutex);
+        _q->stats.num_frames_dropped++;
+        pthread_mutex_unlock(&_q->mutex);
+    }
+    return job;
+}
+
+// submit filled frame buffer for decoding
+void wlan_decoder_submit(wlan_decoder                _q,
+                         struct wlan_decoder_job_s * _job)
+{
+    _job->timestamp = wlan_decoder_gettime();
+
+    pthread_mutex_lock(&_q->mutex);
+    _q->queue[(_q->read_index + _q->num_pending) % _q->num_jobs] = _job;
+    _q->num_pending++;
+    _q->stats.num_frames_queued++;
+    if (_q->num_pending > _q->stats.queue_depth_max)
+        _q->stats.queue_depth_max = _q->num_pending;
+    pthread_cond_signal(&_q->cond_work);
+    pthread_mutex_unlock(&_q->mutex);
+}
+
+// block until all submitted frames have been decoded and delivered
+void wlan_decoder_flush(wlan_decoder _q)
+{
+    pthread_mutex_lock(&_q->mutex);
+    while (_q->num_pending > 0 || _q->num_busy > 0)
+        pthread_cond_wait(&_q->cond_idle, &_q->mutex);
+    pthread_mutex_unlock(&_q->mutex);
+}
+
+// get decoder statistics
+wlanframesync_decoderstats_s wlan_decoder_get_stats(wlan_decoder _q)
+{
+    pthread_mutex_lock(&_q->mutex);
+    wlanframesync_decoderstats_s stats = _q->stats;
+    stats.queue_depth = _q->num_pending + _q->num_busy;
+    stats.latency_avg = stats.num_frames_decoded > 0 ?
+        (float)(_q->latency_sum / (double)stats.num_frames_decoded) : 0.0f;
+    pthread_mutex_unlock(&_q->mutex);
+    return stats;
+}
+
+// reset decoder statistics
+void wlan_decoder_reset_stats(wlan_decoder _q)
+{
+    pthread_mutex_lock(&_q->mutex);
+    memset(&_q->stats, 0x00, sizeof(wlanframesync_decoderstats_s));
+    _q->latency_sum = 0.0;
+    pthread_mutex_unlock(&_q->mutex);
+}
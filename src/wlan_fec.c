@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "liquid-wlan.internal.h"
 
@@ -150,13 +151,16 @@ void wlan_fec_decode(unsigned int    _fec_scheme,
 #endif
 
     unsigned char bit;                      // input bit
-    unsigned char byte_in = _msg_dec[0];    // intput byte
+    unsigned char byte_in = 0;              // intput byte
 
     // unpack bytes, adding erasures at punctured indices
     // compute number of encoded bits with erasure insertions, removing
     // the additional padding to fill last OFDM symbol
+    // the decoder runs K-1 symbols past the message, which are padded
+    // with erasures
     unsigned int num_enc_bits = _dec_msg_len * 8 * R; // - npad;
-    unsigned char enc_bits[num_enc_bits];
+    unsigned char enc_bits[num_enc_bits + R*(K-1)];
+    memset(&enc_bits[num_enc_bits], LIQUID_WLAN_SOFTBIT_ERASURE, R*(K-1));
 
     if (punctured) {
         // punctured code; add erasures at punctured indices
@@ -164,14 +168,16 @@ void wlan_fec_decode(unsigned int    _fec_scheme,
             //
             for (r=0; r<R; r++) {
                 if (pmatrix[r*P + p]) {
-                    // push bit from input
+                    // push bit from input, reading the next byte only
+                    // when needed so as not to read past the message
+                    if (k==0)
+                        byte_in = _msg_enc[n];
                     bit = (byte_in >> (7-k)) & 0x01;
                     enc_bits[i+r] = bit ? LIQUID_WLAN_SOFTBIT_1 : LIQUID_WLAN_SOFTBIT_0;
                     k++;
                     if (k==8) {
                         k = 0;
                         n++;
-                        byte_in = _msg_enc[n];
                     }
                 } else {
                     // push erasure
@@ -198,6 +204,64 @@ void wlan_fec_decode(unsigned int    _fec_scheme,
     void * vp = wlan_create_viterbi27(num_enc_bits);
     wlan_init_viterbi27(vp,0);
     wlan_update_viterbi27_blk(vp, enc_bits, 8*_dec_msg_len + K - 1);
-    wlan_chainback_viterbi27(vp, _msg_dec, num_enc_bits, 0);
+    wlan_chainback_viterbi27(vp, _msg_dec, 8*_dec_msg_len, 0);
+    wlan_delete_viterbi27(vp);
+}
+
+// decode data using convolutional code from soft bits
+//  _fec_scheme :   error-correction scheme
+//  _dec_msg_len:   length of decoded message
+//  _soft_enc   :   encoded soft bits, one per coded bit (punctured)
+//  _msg_dec    :   decoded message (with tail bits inserted)
+void wlan_fec_decode_soft(unsigned int          _fec_scheme,
+                          unsigned int          _dec_msg_len,
+                          const unsigned char * _soft_enc,
+                          unsigned char *       _msg_dec)
+{
+    // validate input
+    if (_fec_scheme != LIQUID_WLAN_FEC_R1_2 &&
+        _fec_scheme != LIQUID_WLAN_FEC_R2_3 &&
+        _fec_scheme != LIQUID_WLAN_FEC_R3_4)
+    {
+        fprintf(stderr,"error: wlan_fec_decode_soft(), invalid scheme\n");
+        exit(1);
+    } else if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: wlan_fec_decode_soft(), input message length must be greater than zero\n");
+        exit(1);
+    }
+
+    // initialize encoder options
+    unsigned int R                = wlanconv_fectab[_fec_scheme].R;
+    unsigned int K                = wlanconv_fectab[_fec_scheme].K;
+
+    // puncturing options
+    int punctured                 = wlanconv_fectab[_fec_scheme].punctured;
+    unsigned int P                = wlanconv_fectab[_fec_scheme].P;
+    const unsigned char * pmatrix = wlanconv_fectab[_fec_scheme].pmatrix;
+
+    // soft bits with erasures at punctured indices; the decoder runs
+    // K-1 symbols past the message, which are padded with erasures
+    unsigned int num_enc_bits = _dec_msg_len * 8 * R;
+    unsigned char enc_bits[num_enc_bits + R*(K-1)];
+    memset(&enc_bits[num_enc_bits], LIQUID_WLAN_SOFTBIT_ERASURE, R*(K-1));
+
+    if (punctured) {
+        unsigned int i, r;
+        unsigned int n=0;   // input soft bit index
+        unsigned int p=0;   // puncturing matrix column index
+        for (i=0; i<num_enc_bits; i+=R) {
+            for (r=0; r<R; r++)
+                enc_bits[i+r] = pmatrix[r*P + p] ? _soft_enc[n++] : LIQUID_WLAN_SOFTBIT_ERASURE;
+            p = (p+1) % P;
+        }
+    } else {
+        memmove(enc_bits, _soft_enc, num_enc_bits*sizeof(unsigned char));
+    }
+
+    // run Viterbi decoder
+    void * vp = wlan_create_viterbi27(num_enc_bits);
+    wlan_init_viterbi27(vp,0);
+    wlan_update_viterbi27_blk(vp, enc_bits, 8*_dec_msg_len + K - 1);
+    wlan_chainback_viterbi27(vp, _msg_dec, 8*_dec_msg_len, 0);
     wlan_delete_viterbi27(vp);
 }
@@ -0,0 +1,523 @@
+// WLAN transform backends
+//
+// Transforms are planned once per (backend, size, direction) and shared
+// by every object that needs them: FFTW plans are run on each object's
+// own buffers through the new-array interface and the built-in kernel
+// shares its twiddle tables. liquid-dsp plans are bound to the buffers
+// they were created with and so remain per object.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#ifdef HAVE_CONFIG_H
+#   include "config.h"
+#endif
+
+#include "liquid-wlan.internal.h"
+
+#if HAVE_FFTW3_H
+#   include <fftw3.h>
+#endif
+
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#endif
+
+// shared transform plan
+struct wlan_fft_plan_s {
+    int          backend;           // resolved backend (never AUTO)
+    unsigned int n;                 // transform size
+    int          dir;               // direction, e.g. WLAN_FFT_FORWARD
+    int          inplace;           // input and output buffers are the same?
+    unsigned int refcount;          // number of objects using plan
+
+    // built-in kernel: twiddle factors w^p, w^2p, w^3p for each radix-4
+    // stage, stored as three consecutive arrays of n_s/4 values per stage
+    float complex * twiddle;
+
+#if HAVE_FFTW3_H
+    fftwf_plan   fftw;              // FFTW plan (unaligned, new-array execute)
+#endif
+
+    struct wlan_fft_plan_s * next;  // next plan in registry
+};
+
+// per-object transform
+struct wlan_fft_s {
+    struct wlan_fft_plan_s * plan;  // shared plan (NULL with liquid backend)
+    fftplan         liquid;         // liquid-dsp plan (liquid backend only)
+    unsigned int    n;              // transform size
+    float complex * x;              // input buffer
+    float complex * y;              // output buffer
+    float complex * buf;            // scratch buffer [size: 2n x 1] (built-in)
+};
+
+// plan registry and global configuration, protected by mutex (the FFTW
+// planner is not thread-safe)
+static pthread_mutex_t          wlan_fft_mutex       = PTHREAD_MUTEX_INITIALIZER;
+static struct wlan_fft_plan_s * wlan_fft_plans       = NULL;
+static int                      wlan_fft_backend     = LIQUID_WLAN_FFT_AUTO;
+static int                      wlan_fft_fftw_effort = LIQUID_WLAN_FFTW_MEASURE;
+
+// select transform backend for objects created hereafter
+int liquid_wlan_fft_set_backend(int _backend)
+{
+    switch (_backend) {
+    case LIQUID_WLAN_FFT_AUTO:
+    case LIQUID_WLAN_FFT_BUILTIN:
+    case LIQUID_WLAN_FFT_LIQUID:
+        break;
+    case LIQUID_WLAN_FFT_FFTW:
+#if HAVE_FFTW3_H
+        break;
+#else
+        fprintf(stderr,"error: liquid_wlan_fft_set_backend(), library built without FFTW\n");
+        return -1;
+#endif
+    default:
+        fprintf(stderr,"error: liquid_wlan_fft_set_backend(), invalid backend (%d)\n", _backend);
+        return -1;
+    }
+
+    pthread_mutex_lock(&wlan_fft_mutex);
+    wlan_fft_backend = _backend;
+    pthread_mutex_unlock(&wlan_fft_mutex);
+    return 0;
+}
+
+// get transform backend used for new objects, resolving AUTO
+int liquid_wlan_fft_get_backend(void)
+{
+    pthread_mutex_lock(&wlan_fft_mutex);
+    int backend = wlan_fft_backend;
+    pthread_mutex_unlock(&wlan_fft_mutex);
+
+    if (backend != LIQUID_WLAN_FFT_AUTO)
+        return backend;
+#if HAVE_FFTW3_H
+    return LIQUID_WLAN_FFT_FFTW;
+#else
+    return LIQUID_WLAN_FFT_BUILTIN;
+#endif
+}
+
+// set FFTW planning effort for plans created hereafter
+int liquid_wlan_fft_set_fftw_effort(int _effort)
+{
+    if (_effort != LIQUID_WLAN_FFTW_ESTIMATE &&
+        _effort != LIQUID_WLAN_FFTW_MEASURE  &&
+        _effort != LIQUID_WLAN_FFTW_PATIENT)
+    {
+        fprintf(stderr,"error: liquid_wlan_fft_set_fftw_effort(), invalid effort (%d)\n", _effort);
+        return -1;
+    }
+
+    pthread_mutex_lock(&wlan_fft_mutex);
+    wlan_fft_fftw_effort = _effort;
+    pthread_mutex_unlock(&wlan_fft_mutex);
+    return 0;
+}
+
+// import FFTW wisdom from file
+int liquid_wlan_fft_import_wisdom(const char * _filename)
+{
+#if HAVE_FFTW3_H
+    pthread_mutex_lock(&wlan_fft_mutex);
+    int rc = fftwf_import_wisdom_from_filename(_filename);
+    pthread_mutex_unlock(&wlan_fft_mutex);
+    if (!rc) {
+        fprintf(stderr,"error: liquid_wlan_fft_import_wisdom(), could not import '%s'\n", _filename);
+        return -1;
+    }
+    return 0;
+#else
+    fprintf(stderr,"error: liquid_wlan_fft_import_wisdom(), library built without FFTW\n");
+    return -1;
+#endif
+}
+
+// export FFTW wisdom to file
+int liquid_wlan_fft_export_wisdom(const char * _filename)
+{
+#if HAVE_FFTW3_H
+    pthread_mutex_lock(&wlan_fft_mutex);
+    int rc = fftwf_export_wisdom_to_filename(_filename);
+    pthread_mutex_unlock(&wlan_fft_mutex);
+    if (!rc) {
+        fprintf(stderr,"error: liquid_wlan_fft_export_wisdom(), could not export '%s'\n", _filename);
+        return -1;
+    }
+    return 0;
+#else
+    fprintf(stderr,"error: liquid_wlan_fft_export_wisdom(), library built without FFTW\n");
+    return -1;
+#endif
+}
+
+//
+// built-in kernel: radix-4 Stockham auto-sort transform with a final
+// radix-2 stage for odd powers of two; output is in natural order
+//
+
+// number of stages for transform of size _n
+static unsigned int wlan_fft_builtin_num_stages(unsigned int _n)
+{
+    unsigned int num_stages = 0;
+    while (_n >= 4) { _n /= 4; num_stages++; }
+    return num_stages + (_n == 2 ? 1 : 0);
+}
+
+// check if size is supported by built-in kernel: powers of two in [8,4096]
+static int wlan_fft_builtin_supported(unsigned int _n)
+{
+    return _n >= 8 && _n <= 4096 && (_n & (_n-1)) == 0;
+}
+
+// compute twiddle factors for all radix-4 stages
+static float complex * wlan_fft_builtin_twiddle(unsigned int _n,
+                                                int          _dir)
+{
+    float sgn = _dir == WLAN_FFT_FORWARD ? -1.0f : 1.0f;
+    float complex * w = (float complex*) malloc(_n*sizeof(float complex));
+    unsigned int ns;
+    unsigned int k = 0;
+    for (ns=_n; ns>=4; ns/=4) {
+        unsigned int m = ns/4;
+        unsigned int p;
+        for (p=0; p<m; p++) {
+            double theta = 2*M_PI*(double)p/(double)ns;
+            w[k      + p] = cos(  theta) + _Complex_I*sgn*sin(  theta);
+            w[k +  m + p] = cos(2*theta) + _Complex_I*sgn*sin(2*theta);
+            w[k + 2*m + p] = cos(3*theta) + _Complex_I*sgn*sin(3*theta);
+        }
+        k += 3*m;
+    }
+    return w;
+}
+
+#if defined(__SSE2__)
+// complex multiply of two pairs of interleaved values
+static inline __m128 wlan_fft_cmul(__m128 _v, __m128 _w)
+{
+    const __m128 neg_even = _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000));
+    __m128 wr = _mm_shuffle_ps(_w, _w, _MM_SHUFFLE(2,2,0,0));
+    __m128 wi = _mm_shuffle_ps(_w, _w, _MM_SHUFFLE(3,3,1,1));
+    __m128 vs = _mm_shuffle_ps(_v, _v, _MM_SHUFFLE(2,3,0,1));
+    return _mm_add_ps(_mm_mul_ps(_v, wr), _mm_xor_ps(_mm_mul_ps(vs, wi), neg_even));
+}
+
+// radix-4 stage on sub-transforms of size _ns with stride _s
+//  _jmask  :   sign mask such that xor(swap(v), _jmask) = +/- j v
+static void wlan_fft_radix4(const float complex * _x,
+                            float complex *       _y,
+                            unsigned int          _ns,
+                            unsigned int          _s,
+                            const float complex * _w,
+                            __m128                _jmask)
+{
+    unsigned int m = _ns/4;
+    unsigned int p, q;
+    const float * x = (const float*)_x;
+    float *       y = (float*)_y;
+    const float * w = (const float*)_w;
+    if (_s == 1) {
+        // first stage: two values of p at a time
+        for (p=0; p<m; p+=2) {
+            __m128 a = _mm_loadu_ps(&x[2*(p      )]);
+            __m128 b = _mm_loadu_ps(&x[2*(p +   m)]);
+            __m128 c = _mm_loadu_ps(&x[2*(p + 2*m)]);
+            __m128 d = _mm_loadu_ps(&x[2*(p + 3*m)]);
+            __m128 apc = _mm_add_ps(a, c), amc = _mm_sub_ps(a, c);
+            __m128 bpd = _mm_add_ps(b, d), bmd = _mm_sub_ps(b, d);
+            __m128 jb  = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), _jmask);
+            __m128 y0 = _mm_add_ps(apc, bpd);
+            __m128 y1 = wlan_fft_cmul(_mm_add_ps(amc, jb), _mm_loadu_ps(&w[2*(p      )]));
+            __m128 y2 = wlan_fft_cmul(_mm_sub_ps(apc, bpd), _mm_loadu_ps(&w[2*(p +   m)]));
+            __m128 y3 = wlan_fft_cmul(_mm_sub_ps(amc, jb), _mm_loadu_ps(&w[2*(p + 2*m)]));
+            _mm_storel_pi((__m64*)&y[2*(4*p    )], y0); _mm_storeh_pi((__m64*)&y[2*(4*p + 4)], y0);
+            _mm_storel_pi((__m64*)&y[2*(4*p + 1)], y1); _mm_storeh_pi((__m64*)&y[2*(4*p + 5)], y1);
+            _mm_storel_pi((__m64*)&y[2*(4*p + 2)], y2); _mm_storeh_pi((__m64*)&y[2*(4*p + 6)], y2);
+            _mm_storel_pi((__m64*)&y[2*(4*p + 3)], y3); _mm_storeh_pi((__m64*)&y[2*(4*p + 7)], y3);
+        }
+        return;
+    }
+
+    // later stages: two values of q at a time
+    for (p=0; p<m; p++) {
+        __m128 w1 = _mm_castpd_ps(_mm_load1_pd((const double*)&w[2*(p      )]));
+        __m128 w2 = _mm_castpd_ps(_mm_load1_pd((const double*)&w[2*(p +   m)]));
+        __m128 w3 = _mm_castpd_ps(_mm_load1_pd((const double*)&w[2*(p + 2*m)]));
+        for (q=0; q<_s; q+=2) {
+            __m128 a = _mm_loadu_ps(&x[2*(q + _s*(p      ))]);
+            __m128 b = _mm_loadu_ps(&x[2*(q + _s*(p +   m))]);
+            __m128 c = _mm_loadu_ps(&x[2*(q + _s*(p + 2*m))]);
+            __m128 d = _mm_loadu_ps(&x[2*(q + _s*(p + 3*m))]);
+            __m128 apc = _mm_add_ps(a, c), amc = _mm_sub_ps(a, c);
+            __m128 bpd = _mm_add_ps(b, d), bmd = _mm_sub_ps(b, d);
+            __m128 jb  = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), _jmask);
+            _mm_storeu_ps(&y[2*(q + _s*(4*p    ))], _mm_add_ps(apc, bpd));
+            _mm_storeu_ps(&y[2*(q + _s*(4*p + 1))], wlan_fft_cmul(_mm_add_ps(amc, jb), w1));
+            _mm_storeu_ps(&y[2*(q + _s*(4*p + 2))], wlan_fft_cmul(_mm_sub_ps(apc, bpd), w2));
+            _mm_storeu_ps(&y[2*(q + _s*(4*p + 3))], wlan_fft_cmul(_mm_sub_ps(amc, jb), w3));
+        }
+    }
+}
+
+// final radix-2 stage with stride _s
+static void wlan_fft_radix2(const float complex * _x,
+                            float complex *       _y,
+                            unsigned int          _s)
+{
+    const float * x = (const float*)_x;
+    float *       y = (float*)_y;
+    unsigned int q;
+    for (q=0; q<_s; q+=2) {
+        __m128 a = _mm_loadu_ps(&x[2*q]);
+        __m128 b = _mm_loadu_ps(&x[2*(q + _s)]);
+        _mm_storeu_ps(&y[2*q],        _mm_add_ps(a, b));
+        _mm_storeu_ps(&y[2*(q + _s)], _mm_sub_ps(a, b));
+    }
+}
+#else
+// complex multiply without special-value handling
+static inline float complex wlan_fft_cmul(float complex _v, float complex _w)
+{
+    return (crealf(_v)*crealf(_w) - cimagf(_v)*cimagf(_w)) +
+           (crealf(_v)*cimagf(_w) + cimagf(_v)*crealf(_w))*_Complex_I;
+}
+
+// radix-4 stage on sub-transforms of size _ns with stride _s
+//  _sgn    :   -1 (forward) or +1 (backward)
+static void wlan_fft_radix4(const float complex * _x,
+                            float complex *       _y,
+                            unsigned int          _ns,
+                            unsigned int          _s,
+                            const float complex * _w,
+                            float                 _sgn)
+{
+    unsigned int m = _ns/4;
+    unsigned int p, q;
+    for (p=0; p<m; p++) {
+        float complex w1 = _w[p], w2 = _w[p + m], w3 = _w[p + 2*m];
+        for (q=0; q<_s; q++) {
+            float complex a = _x[q + _s*(p      )];
+            float complex b = _x[q + _s*(p +   m)];
+            float complex c = _x[q + _s*(p + 2*m)];
+            float complex d = _x[q + _s*(p + 3*m)];
+            float complex apc = a + c, amc = a - c;
+            float complex bpd = b + d, bmd = b - d;
+            float complex jb  = _sgn*(-cimagf(bmd) + crealf(bmd)*_Complex_I);
+            _y[q + _s*(4*p    )] = apc + bpd;
+            _y[q + _s*(4*p + 1)] = wlan_fft_cmul(amc + jb,  w1);
+            _y[q + _s*(4*p + 2)] = wlan_fft_cmul(apc - bpd, w2);
+            _y[q + _s*(4*p + 3)] = wlan_fft_cmul(amc - jb,  w3);
+        }
+    }
+}
+
+// final radix-2 stage with stride _s
+static void wlan_fft_radix2(const float complex * _x,
+                            float complex *       _y,
+                            unsigned int          _s)
+{
+    unsigned int q;
+    for (q=0; q<_s; q++) {
+        float complex a = _x[q], b = _x[q + _s];
+        _y[q]      = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+#endif
+
+// run built-in transform
+static void wlan_fft_builtin_execute(wlan_fft _q)
+{
+    unsigned int    n   = _q->n;
+    float complex * src = _q->x;
+
+    // copy input aside when transforming in place
+    if (_q->x == _q->y) {
+        memmove(&_q->buf[n], _q->x, n*sizeof(float complex));
+        src = &_q->buf[n];
+    }
+
+    // alternate between output and scratch buffers such that the last
+    // stage writes to the output
+    unsigned int    num_stages = wlan_fft_builtin_num_stages(n);
+    float complex * dst = (num_stages & 1) ? _q->y : _q->buf;
+
+#if defined(__SSE2__)
+    __m128 jmask = _q->plan->dir == WLAN_FFT_FORWARD ?
+        _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0)) :   // -j v
+        _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000));    // +j v
+#else
+    float jmask = _q->plan->dir == WLAN_FFT_FORWARD ? -1.0f : 1.0f;
+#endif
+
+    const float complex * w = _q->plan->twiddle;
+    unsigned int ns = n;
+    unsigned int s  = 1;
+    while (ns >= 4) {
+        wlan_fft_radix4(src, dst, ns, s, w, jmask);
+        w  += 3*(ns/4);
+        ns /= 4;
+        s  *= 4;
+        src = dst;
+        dst = (dst == _q->y) ? _q->buf : _q->y;
+    }
+    if (ns == 2)
+        wlan_fft_radix2(src, dst, s);
+}
+
+//
+// transform objects
+//
+
+// look up or create shared plan; must be called with mutex held
+static struct wlan_fft_plan_s * wlan_fft_plan_acquire(int          _backend,
+                                                      unsigned int _n,
+                                                      int          _dir,
+                                                      int          _inplace)
+{
+    struct wlan_fft_plan_s * plan;
+    for (plan=wlan_fft_plans; plan!=NULL; plan=plan->next) {
+        if (plan->backend == _backend && plan->n == _n &&
+            plan->dir == _dir && plan->inplace == _inplace)
+        {
+            plan->refcount++;
+            return plan;
+        }
+    }
+
+    plan = (struct wlan_fft_plan_s*) malloc(sizeof(struct wlan_fft_plan_s));
+    plan->backend  = _backend;
+    plan->n        = _n;
+    plan->dir      = _dir;
+    plan->inplace  = _inplace;
+    plan->refcount = 1;
+    plan->twiddle  = NULL;
+#if HAVE_FFTW3_H
+    plan->fftw     = NULL;
+    if (_backend == LIQUID_WLAN_FFT_FFTW) {
+        // plan on scratch arrays; objects' buffers may not share alignment
+        unsigned int flags = FFTW_UNALIGNED;
+        switch (wlan_fft_fftw_effort) {
+        case LIQUID_WLAN_FFTW_ESTIMATE: flags |= FFTW_ESTIMATE; break;
+        case LIQUID_WLAN_FFTW_PATIENT:  flags |= FFTW_PATIENT;  break;
+        default:                        flags |= FFTW_MEASURE;  break;
+        }
+        fftwf_complex * a = (fftwf_complex*) fftwf_malloc(_n*sizeof(fftwf_complex));
+        fftwf_complex * b = _inplace ? a : (fftwf_complex*) fftwf_malloc(_n*sizeof(fftwf_complex));
+        plan->fftw = fftwf_plan_dft_1d(_n, a, b,
+                                       _dir == WLAN_FFT_FORWARD ? FFTW_FORWARD : FFTW_BACKWARD,
+                                       flags);
+        if (b != a) fftwf_free(b);
+        fftwf_free(a);
+    }
+#endif
+    if (_backend == LIQUID_WLAN_FFT_BUILTIN)
+        plan->twiddle = wlan_fft_builtin_twiddle(_n, _dir);
+
+    plan->next     = wlan_fft_plans;
+    wlan_fft_plans = plan;
+    return plan;
+}
+
+// release shared plan; must be called with mutex held
+static void wlan_fft_plan_release(struct wlan_fft_plan_s * _plan)
+{
+    if (--_plan->refcount > 0)
+        return;
+
+    // unlink from registry
+    struct wlan_fft_plan_s ** p = &wlan_fft_plans;
+    while (*p != _plan)
+        p = &(*p)->next;
+    *p = _plan->next;
+
+#if HAVE_FFTW3_H
+    if (_plan->fftw != NULL)
+        fftwf_destroy_plan(_plan->fftw);
+#endif
+    free(_plan->twiddle);
+    free(_plan);
+}
+
+// create transform object
+wlan_fft wlan_fft_create(unsigned int    _n,
+                         float complex * _x,
+                         float complex * _y,
+                         int             _dir)
+{
+    wlan_fft q = (wlan_fft) malloc(sizeof(struct wlan_fft_s));
+    q->plan   = NULL;
+    q->liquid = NULL;
+    q->n      = _n;
+    q->x      = _x;
+    q->y      = _y;
+    q->buf    = NULL;
+
+    // resolve backend
+    int backend = liquid_wlan_fft_get_backend();
+    if (backend == LIQUID_WLAN_FFT_BUILTIN && !wlan_fft_builtin_supported(_n))
+        backend = LIQUID_WLAN_FFT_LIQUID;
+
+    if (backend == LIQUID_WLAN_FFT_LIQUID) {
+        q->liquid = fft_create_plan(_n, _x, _y,
+                                    _dir == WLAN_FFT_FORWARD ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD,
+                                    0);
+        return q;
+    }
+
+    // built-in kernel is out of place regardless of buffers
+    int inplace = backend == LIQUID_WLAN_FFT_FFTW && _x == _y;
+    pthread_mutex_lock(&wlan_fft_mutex);
+    q->plan = wlan_fft_plan_acquire(backend, _n, _dir, inplace);
+    pthread_mutex_unlock(&wlan_fft_mutex);
+
+    if (backend == LIQUID_WLAN_FFT_BUILTIN)
+        q->buf = (float complex*) malloc(2*_n*sizeof(float complex));
+    return q;
+}
+
+// destroy transform object
+void wlan_fft_destroy(wlan_fft _q)
+{
+    if (_q->liquid != NULL)
+        fft_destroy_plan(_q->liquid);
+
+    if (_q->plan != NULL) {
+        pthread_mutex_lock(&wlan_fft_mutex);
+        wlan_fft_plan_release(_q->plan);
+        pthread_mutex_unlock(&wlan_fft_mutex);
+    }
+
+    free(_q->buf);
+    free(_q);
+}
+
+// get backend used by transform object
+int wlan_fft_get_backend(wlan_fft _q)
+{
+    return _q->plan == NULL ? LIQUID_WLAN_FFT_LIQUID : _q->plan->backend;
+}
+
+// run transform
+void wlan_fft_execute(wlan_fft _q)
+{
+    if (_q->liquid != NULL) {
+        fft_execute(_q->liquid);
+        return;
+    }
+
+#if HAVE_FFTW3_H
+    if (_q->plan->backend == LIQUID_WLAN_FFT_FFTW) {
+        fftwf_execute_dft(_q->plan->fftw, (fftwf_complex*)_q->x, (fftwf_complex*)_q->y);
+        return;
+    }
+#endif
+    wlan_fft_builtin_execute(_q);
+}
@@ -0,0 +1,150 @@
+// WLAN fixed-point (Q15) arithmetic: trigonometry and 64-point transform
+//
+// Angles are binary angles: a full turn is 65536, so that 16-bit integer
+// wrap-around implements modulo 2 pi.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "liquid-wlan.internal.h"
+
+// twiddle factors exp(-j 2 pi k / 64), k = 0..31, Q15 [real, imag]
+static const int16_t wlan_fft64_q15_twiddle[32][2] = {
+    { 32767,      0}, //  0
+    { 32609,  -3212}, //  1
+    { 32137,  -6393}, //  2
+    { 31356,  -9512}, //  3
+    { 30273, -12539}, //  4
+    { 28898, -15446}, //  5
+    { 27245, -18204}, //  6
+    { 25329, -20787}, //  7
+    { 23170, -23170}, //  8
+    { 20787, -25329}, //  9
+    { 18204, -27245}, // 10
+    { 15446, -28898}, // 11
+    { 12539, -30273}, // 12
+    {  9512, -31356}, // 13
+    {  6393, -32137}, // 14
+    {  3212, -32609}, // 15
+    {     0, -32767}, // 16
+    { -3212, -32609}, // 17
+    { -6393, -32137}, // 18
+    { -9512, -31356}, // 19
+    {-12539, -30273}, // 20
+    {-15446, -28898}, // 21
+    {-18204, -27245}, // 22
+    {-20787, -25329}, // 23
+    {-23170, -23170}, // 24
+    {-25329, -20787}, // 25
+    {-27245, -18204}, // 26
+    {-28898, -15446}, // 27
+    {-30273, -12539}, // 28
+    {-31356,  -9512}, // 29
+    {-32137,  -6393}, // 30
+    {-32609,  -3212}, // 31
+};
+
+// saturate to 16-bit range
+static inline int16_t wlan_q15_sat(int32_t _x)
+{
+    return _x > 32767 ? 32767 : (_x < -32768 ? -32768 : (int16_t)_x);
+}
+
+// sine of binary angle, Q15
+//  _theta  :   angle (65536 = 2 pi)
+int16_t wlan_q15_sin(uint16_t _theta)
+{
+    // fold into [-pi/2, pi/2] where sine is odd
+    int32_t x = (int16_t)_theta;
+    if      (x >  16384) x =  32768 - x;
+    else if (x < -16384) x = -32768 - x;
+
+    // 5th-order polynomial in z = x/(pi/2) (Q15), coefficients in Q14,
+    // exact with zero slope at z = 1 (error below 5e-4):
+    //  sin(z pi/2) ~ z (1.5707963 - z^2 (0.6415926 - 0.0707963 z^2))
+    int32_t z  = 2*x;
+    int32_t z2 = (z*z) >> 15;
+    int32_t y  = (1160*z2) >> 15;
+    y = ((10512 - y)*z2) >> 15;
+    y = 25736 - y;
+    return wlan_q15_sat((y*z + (1<<13)) >> 14);
+}
+
+// cosine of binary angle, Q15
+//  _theta  :   angle (65536 = 2 pi)
+int16_t wlan_q15_cos(uint16_t _theta)
+{
+    return wlan_q15_sin((uint16_t)(_theta + 16384));
+}
+
+// four-quadrant arctangent, returning binary angle
+//  _y      :   imaginary component
+//  _x      :   real component
+int16_t wlan_q15_atan2(int32_t _y,
+                       int32_t _x)
+{
+    int32_t ax = _x < 0 ? -_x : _x;
+    int32_t ay = _y < 0 ? -_y : _y;
+    if (ax == 0 && ay == 0)
+        return 0;
+
+    // atan(z) for z = min/max in [0,1] (Q15), in binary angle units:
+    //  atan(z) ~ pi/4 z + z (1 - z)(0.2447 + 0.0663 z)
+    int32_t z = ax > ay ? (int32_t)(((int64_t)ay << 15) / ax)
+                        : (int32_t)(((int64_t)ax << 15) / ay);
+    int32_t q = (z*(32768 - z)) >> 15;                  // z (1 - z), Q15
+    int32_t c = 8019 + ((2173*z) >> 15);                // 0.2447 + 0.0663 z, Q15
+    int32_t r = (z >> 2) + ((((q*c) >> 15)*10430) >> 15);
+
+    // map octant to full circle
+    int32_t theta = ax > ay ? r : 16384 - r;
+    if (_x < 0) theta = 32768 - theta;
+    if (_y < 0) theta = -theta;
+    return (int16_t)(uint16_t)theta;
+}
+
+// 64-point forward transform on interleaved Q15 samples, in place;
+// radix-2 decimation in time with one bit of scaling in every other
+// stage, such that the output is the DFT scaled by 1/8
+//  _x      :   input/output [size: 128 x 1], [re, im] pairs
+void wlan_fft64_q15(int16_t * _x)
+{
+    unsigned int i, j, k;
+
+    // bit-reversal permutation
+    for (i=0; i<64; i++) {
+        j = ((i & 0x01) << 5) | ((i & 0x02) << 3) | ((i & 0x04) << 1) |
+            ((i & 0x08) >> 1) | ((i & 0x10) >> 3) | ((i & 0x20) >> 5);
+        if (j > i) {
+            int16_t tr = _x[2*i], ti = _x[2*i+1];
+            _x[2*i] = _x[2*j]; _x[2*i+1] = _x[2*j+1];
+            _x[2*j] = tr;      _x[2*j+1] = ti;
+        }
+    }
+
+    // butterflies
+    unsigned int s;
+    for (s=0; s<6; s++) {
+        unsigned int h     = 1 << s;        // half span
+        unsigned int step  = 32 >> s;       // twiddle stride
+        unsigned int shift = s & 1;         // scale on stages 1, 3, 5
+        int32_t      round = shift;         // rounding offset
+        for (k=0; k<64; k+=2*h) {
+            for (j=0; j<h; j++) {
+                unsigned int a = 2*(k + j);
+                unsigned int b = a + 2*h;
+                int32_t wr = wlan_fft64_q15_twiddle[j*step][0];
+                int32_t wi = wlan_fft64_q15_twiddle[j*step][1];
+                int32_t br = _x[b], bi = _x[b+1];
+                int32_t tr = (wr*br - wi*bi + (1<<14)) >> 15;
+                int32_t ti = (wr*bi + wi*br + (1<<14)) >> 15;
+                int32_t ar = _x[a], ai = _x[a+1];
+                _x[a  ] = wlan_q15_sat((ar + tr + round) >> shift);
+                _x[a+1] = wlan_q15_sat((ai + ti + round) >> shift);
+                _x[b  ] = wlan_q15_sat((ar - tr + round) >> shift);
+                _x[b+1] = wlan_q15_sat((ai - ti + round) >> shift);
+            }
+        }
+    }
+}
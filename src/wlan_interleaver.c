@@ -92,3 +92,36 @@ void wlan_interleaver_decode_symbol(unsigned int    _rate,
     }
 }
 
+// bit position (0: most significant) of single-bit mask
+static unsigned int wlan_interleaver_bitpos(unsigned char _mask)
+{
+    return 7 - __builtin_ctz(_mask);
+}
+
+// de-intereleave one OFDM symbol of soft bits
+//  _rate       :   primitive rate
+//  _soft_enc   :   encoded soft bits (interleaved) [size: ncbps x 1]
+//  _soft_dec   :   decoded soft bits (de-iterleaved) [size: ncbps x 1]
+void wlan_interleaver_decode_symbol_soft(unsigned int          _rate,
+                                         const unsigned char * _soft_enc,
+                                         unsigned char *       _soft_dec)
+{
+    // validate input
+    if (_rate > WLANFRAME_RATE_54) {
+        fprintf(stderr,"error: wlan_interleaver_decode_symbol_soft(), invalid rate\n");
+        exit(1);
+    }
+
+    // number of coded bits per OFDM symbol
+    unsigned int ncbps = wlanframe_ratetab[_rate].ncbps;
+
+    // retrieve structured interleaver table
+    struct wlan_interleaver_tab_s * intlv = wlan_intlv_gentab[_rate];
+
+    // run de-interleaver, mapping each soft bit individually
+    unsigned int i;
+    for (i=0; i<ncbps; i++) {
+        _soft_dec[8*intlv[i].p0 + wlan_interleaver_bitpos(intlv[i].mask0)] =
+        _soft_enc[8*intlv[i].p1 + wlan_interleaver_bitpos(intlv[i].mask1)];
+    }
+}
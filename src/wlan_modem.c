@@ -153,6 +153,83 @@ unsigned char wlan_demodulate_qam64(float complex _sample)
     return (sym_i << 3) | sym_q;
 }
 
+//
+// soft demodulation (fixed point)
+//
+
+// scale soft bit metric and clip about erasure
+static inline unsigned char wlan_softbit(int32_t _metric,
+                                         int32_t _weight)
+{
+    int32_t v = LIQUID_WLAN_SOFTBIT_ERASURE + ((_metric * _weight) >> 16);
+    return v < LIQUID_WLAN_SOFTBIT_0 ? LIQUID_WLAN_SOFTBIT_0 :
+          (v > LIQUID_WLAN_SOFTBIT_1 ? LIQUID_WLAN_SOFTBIT_1 : (unsigned char)v);
+}
+
+// soft demodulation of Q12 equalized sample; bit metrics are the
+// distances to the decision boundaries of the hard demodulators above
+//  2/sqrt(10) ~ 2590/4096, 4/sqrt(42) ~ 2528/4096, 2/sqrt(42) ~ 1264/4096
+void wlan_demodulate_soft(unsigned int    _scheme,
+                          int32_t         _re,
+                          int32_t         _im,
+                          int32_t         _weight,
+                          unsigned char * _soft)
+{
+    int32_t ar = _re < 0 ? -_re : _re;
+    int32_t ai = _im < 0 ? -_im : _im;
+    switch (_scheme) {
+    case WLAN_MODEM_BPSK:
+        _soft[0] = wlan_softbit(_re, _weight);
+        break;
+    case WLAN_MODEM_QPSK:
+        _soft[0] = wlan_softbit(_re, _weight);
+        _soft[1] = wlan_softbit(_im, _weight);
+        break;
+    case WLAN_MODEM_QAM16:
+        _soft[0] = wlan_softbit(_re,        _weight);
+        _soft[1] = wlan_softbit(2590 - ar,  _weight);
+        _soft[2] = wlan_softbit(_im,        _weight);
+        _soft[3] = wlan_softbit(2590 - ai,  _weight);
+        break;
+    case WLAN_MODEM_QAM64:
+        _soft[0] = wlan_softbit(_re,        _weight);
+        _soft[1] = wlan_softbit(2528 - ar,  _weight);
+        _soft[2] = wlan_softbit(1264 - abs(ar - 2528), _weight);
+        _soft[3] = wlan_softbit(_im,        _weight);
+        _soft[4] = wlan_softbit(2528 - ai,  _weight);
+        _soft[5] = wlan_softbit(1264 - abs(ai - 2528), _weight);
+        break;
+    default:
+        fprintf(stderr,"error: wlan_demodulate_soft(), invalid scheme\n");
+        exit(1);
+    }
+}
+
+// compute soft bit scaling for a subcarrier
+//  _scheme     :   modulation scheme, e.g. WLAN_MODEM_QAM16
+//  _csi        :   relative subcarrier reliability
+int32_t wlan_demodulate_soft_weight(unsigned int _scheme,
+                                    float        _csi)
+{
+    // half minimum distance between constellation points
+    float d = 0.0f;
+    switch (_scheme) {
+    case WLAN_MODEM_BPSK:  d = 1.0f;        break;
+    case WLAN_MODEM_QPSK:  d = M_SQRT1_2;   break;
+    case WLAN_MODEM_QAM16: d = 0.3162278f;  break; // 1/sqrt(10)
+    case WLAN_MODEM_QAM64: d = 0.1543034f;  break; // 1/sqrt(42)
+    default:
+        fprintf(stderr,"error: wlan_demodulate_soft_weight(), invalid scheme\n");
+        exit(1);
+    }
+
+    // limit dynamic range to keep metric products within 32 bits
+    _csi = _csi < 0.0f ? 0.0f : (_csi > 8.0f ? 8.0f : _csi);
+
+    // 32 soft bit steps at distance d (Q12 metric, Q16 weight)
+    return (int32_t)(512.0f * _csi / d);
+}
+
 // 
 // modulation tables
 //
@@ -55,6 +55,19 @@ unsigned int wlan_packet_compute_enc_msg_len(unsigned int _rate,
     return enc_msg_len;
 }
 
+// compute maximum encoded message length across all rates
+unsigned int wlan_packet_compute_enc_msg_len_max(unsigned int _length)
+{
+    unsigned int enc_msg_len_max = 0;
+    unsigned int rate;
+    for (rate=0; rate<8; rate++) {
+        unsigned int enc_msg_len = wlan_packet_compute_enc_msg_len(rate, _length);
+        if (enc_msg_len > enc_msg_len_max)
+            enc_msg_len_max = enc_msg_len;
+    }
+    return enc_msg_len_max;
+}
+
 // assemble data (prepend SERVICE bits, etc.), scramble, encode, interleave
 void wlan_packet_encode(unsigned int    _rate,
                         unsigned int    _seed,
@@ -299,3 +312,51 @@ void wlan_packet_decode(unsigned int    _rate,
 
     return;
 }
+
+// de-interleave, decode, de-scramble, extract data from soft bits
+//  _rate       :   primitive rate
+//  _seed       :   data scrambler seed
+//  _length     :   original data length (bytes)
+//  _soft_enc   :   encoded soft bits, one per coded bit [size: 8*enc_msg_len x 1]
+//  _msg_dec    :   recovered data [size: _length x 1]
+void wlan_packet_decode_soft(unsigned int          _rate,
+                             unsigned int          _seed,
+                             unsigned int          _length,
+                             const unsigned char * _soft_enc,
+                             unsigned char *       _msg_dec)
+{
+    // validate input
+    if (_rate > 7) {
+        fprintf(stderr,"error: wlan_packet_decode_soft(), invalid rate\n");
+        exit(1);
+    }
+
+    // strip parameters
+    unsigned int ndbps      = wlanframe_ratetab[_rate].ndbps;
+    unsigned int ncbps      = wlanframe_ratetab[_rate].ncbps;
+    unsigned int fec_scheme = wlanframe_ratetab[_rate].fec_scheme;
+
+    // compute number of OFDM symbols, decoded message length
+    div_t d = div(16 + 8*_length + 6, ndbps);
+    unsigned int nsym        = d.quot + (d.rem == 0 ? 0 : 1);
+    unsigned int dec_msg_len = (nsym * ndbps) / 8;
+
+    unsigned char soft_deint[nsym*ncbps];       // de-interleaved soft bits
+    unsigned char msg_dec[dec_msg_len];         // decoded message
+    unsigned char msg_unscrambled[dec_msg_len]; // unscrambled message
+
+    // de-interleave symbols
+    unsigned int i;
+    for (i=0; i<nsym; i++)
+        wlan_interleaver_decode_symbol_soft(_rate, &_soft_enc[i*ncbps], &soft_deint[i*ncbps]);
+
+    // decode message
+    wlan_fec_decode_soft(fec_scheme, dec_msg_len, soft_deint, msg_dec);
+
+    // unscramble data
+    wlan_data_scramble(msg_dec, msg_unscrambled, dec_msg_len, _seed);
+
+    // strip SERVICE bits/padding, and reverse bytes
+    for (i=0; i<_length; i++)
+        _msg_dec[i] = liquid_wlan_reverse_byte[ msg_unscrambled[i+2] ];
+}
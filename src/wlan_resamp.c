@@ -0,0 +1,215 @@
+// WLAN output stage: arbitrary-rate polyphase interpolator and frequency
+// shift
+//
+// A Kaiser-windowed sinc prototype is split into WLAN_RESAMP_NPFB
+// branches; each output sample linearly interpolates between the two
+// branches adjacent to its fractional input time. The frequency shift is
+// applied to each output sample as it is computed, so a frame is
+// resampled and mixed in a single pass over its samples.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid-wlan.internal.h"
+
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#endif
+
+// filter semi-length (input samples) and number of polyphase branches
+#define WLAN_RESAMP_M       (12)
+#define WLAN_RESAMP_NPFB    (32)
+
+// Kaiser window shape parameter (roughly 60 dB stop-band attenuation)
+#define WLAN_RESAMP_BETA    (6.0)
+
+struct wlan_resamp_s {
+    float           rate;       // output/input sample rate ratio
+    float           fshift;     // frequency shift (cycles/output sample)
+    double          tstep;      // input time step per output sample
+    float complex   rotator;    // per-sample phase rotation
+
+    // polyphase branches [size: (NPFB+1) x 2*M], each coefficient stored
+    // twice so it lines up with interleaved real/imaginary samples
+    float *         coef;
+};
+
+// zeroth-order modified Bessel function of the first kind
+static double wlan_resamp_besseli0(double _x)
+{
+    double v = 1.0, t = 1.0;
+    unsigned int k;
+    for (k=1; k<32; k++) {
+        t *= (_x / (2.0*k)) * (_x / (2.0*k));
+        v += t;
+    }
+    return v;
+}
+
+// prototype filter evaluated at time _t (input samples), |_t| < M
+static double wlan_resamp_prototype(double _t)
+{
+    double r = _t / (double)WLAN_RESAMP_M;
+    if (fabs(r) >= 1.0)
+        return 0.0;
+    double sinc = fabs(_t) < 1e-9 ? 1.0 : sin(M_PI*_t) / (M_PI*_t);
+    double w = wlan_resamp_besseli0(WLAN_RESAMP_BETA*sqrt(1.0 - r*r)) /
+               wlan_resamp_besseli0(WLAN_RESAMP_BETA);
+    return sinc * w;
+}
+
+// create output stage
+//  _rate   :   output/input sample rate ratio, 1 <= _rate <= 16
+//  _fshift :   frequency shift (cycles/output sample), |_fshift| < 0.5
+wlan_resamp wlan_resamp_create(float _rate,
+                               float _fshift)
+{
+    // validate input
+    if (!(_rate >= 1.0f && _rate <= 16.0f)) {
+        fprintf(stderr,"error: wlan_resamp_create(), rate must be in [1,16]\n");
+        exit(1);
+    } else if (!(fabsf(_fshift) < 0.5f)) {
+        fprintf(stderr,"error: wlan_resamp_create(), frequency shift must be in (-0.5,0.5)\n");
+        exit(1);
+    }
+
+    wlan_resamp q = (wlan_resamp) malloc(sizeof(struct wlan_resamp_s));
+    q->rate    = _rate;
+    q->fshift  = _fshift;
+    q->tstep   = 1.0 / (double)_rate;
+    q->rotator = cosf(2*M_PI*_fshift) + _Complex_I*sinf(2*M_PI*_fshift);
+
+    // design branches: branch p is the prototype sampled at fractional
+    // delay p/NPFB, normalized to unity gain
+    unsigned int L = 2*WLAN_RESAMP_M;
+    q->coef = (float*) malloc((WLAN_RESAMP_NPFB+1)*2*L*sizeof(float));
+    unsigned int p, j;
+    for (p=0; p<=WLAN_RESAMP_NPFB; p++) {
+        double mu = (double)p / (double)WLAN_RESAMP_NPFB;
+        double b[2*WLAN_RESAMP_M];
+        double sum = 0.0;
+        for (j=0; j<L; j++) {
+            b[j] = wlan_resamp_prototype(mu + WLAN_RESAMP_M - 1 - (double)j);
+            sum += b[j];
+        }
+        for (j=0; j<L; j++) {
+            q->coef[p*2*L + 2*j + 0] = (float)(b[j] / sum);
+            q->coef[p*2*L + 2*j + 1] = (float)(b[j] / sum);
+        }
+    }
+    return q;
+}
+
+// destroy output stage
+void wlan_resamp_destroy(wlan_resamp _q)
+{
+    free(_q->coef);
+    free(_q);
+}
+
+// print output stage
+void wlan_resamp_print(wlan_resamp _q)
+{
+    printf("    output rate :   %.6f x 20 M samples/s\n", _q->rate);
+    printf("    freq. shift :   %.6f cycles/sample\n", _q->fshift);
+}
+
+// get number of zero samples required before and after input
+unsigned int wlan_resamp_get_padding(wlan_resamp _q)
+{
+    return _q->rate == 1.0f ? 0 : 2*WLAN_RESAMP_M;
+}
+
+// get number of output samples for burst of _nx input samples, covering
+// the filter response from start to end
+unsigned int wlan_resamp_get_num_output(wlan_resamp  _q,
+                                        unsigned int _nx)
+{
+    if (_q->rate == 1.0f)
+        return _nx;
+    return (unsigned int) ceil((double)(_nx + 2*WLAN_RESAMP_M - 1) * (double)_q->rate);
+}
+
+#if defined(__SSE2__)
+// interpolated dot product of 2*M samples with adjacent branches
+static inline float complex wlan_resamp_dotprod(const float * _x,
+                                                const float * _h0,
+                                                const float * _h1,
+                                                float         _alpha)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    unsigned int j;
+    for (j=0; j<4*WLAN_RESAMP_M; j+=4) {
+        __m128 x = _mm_loadu_ps(&_x[j]);
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(x, _mm_loadu_ps(&_h0[j])));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(x, _mm_loadu_ps(&_h1[j])));
+    }
+    __m128 acc = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(_alpha), _mm_sub_ps(acc1, acc0)));
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    float v[4];
+    _mm_storeu_ps(v, acc);
+    return v[0] + _Complex_I*v[1];
+}
+#else
+// interpolated dot product of 2*M samples with adjacent branches
+static inline float complex wlan_resamp_dotprod(const float * _x,
+                                                const float * _h0,
+                                                const float * _h1,
+                                                float         _alpha)
+{
+    float r0 = 0.0f, i0 = 0.0f, r1 = 0.0f, i1 = 0.0f;
+    unsigned int j;
+    for (j=0; j<4*WLAN_RESAMP_M; j+=2) {
+        r0 += _x[j  ]*_h0[j];
+        i0 += _x[j+1]*_h0[j];
+        r1 += _x[j  ]*_h1[j];
+        i1 += _x[j+1]*_h1[j];
+    }
+    return (r0 + _alpha*(r1 - r0)) + _Complex_I*(i0 + _alpha*(i1 - i0));
+}
+#endif
+
+// resample and shift burst, returning number of output samples written
+//  _q      :   output stage
+//  _x      :   input burst with wlan_resamp_get_padding() zeros before
+//              and after [size: _nx + 2*padding x 1]
+//  _nx     :   number of input samples, excluding padding
+//  _y      :   output [size: wlan_resamp_get_num_output(_nx) x 1]
+unsigned int wlan_resamp_execute(wlan_resamp           _q,
+                                 const float complex * _x,
+                                 unsigned int          _nx,
+                                 float complex *       _y)
+{
+    unsigned int  ny  = wlan_resamp_get_num_output(_q, _nx);
+    float complex phi = 1.0f;
+    unsigned int  k;
+    for (k=0; k<ny; k++) {
+        float complex v;
+        if (_q->rate == 1.0f) {
+            v = _x[k];
+        } else {
+            // input time k/rate (padded coordinates less M) splits into
+            // integer index and branch position
+            double       t     = (double)k * _q->tstep;
+            unsigned int i     = (unsigned int) t;
+            double       pos   = (t - (double)i) * WLAN_RESAMP_NPFB;
+            unsigned int p     = (unsigned int) pos;
+            float        alpha = (float)(pos - (double)p);
+            const float * h0 = &_q->coef[ p   *4*WLAN_RESAMP_M];
+            const float * h1 = &_q->coef[(p+1)*4*WLAN_RESAMP_M];
+            v = wlan_resamp_dotprod((const float*)&_x[i + 1], h0, h1, alpha);
+        }
+
+        // frequency shift, re-normalizing phasor periodically
+        _y[k] = (crealf(v)*crealf(phi) - cimagf(v)*cimagf(phi)) +
+                (crealf(v)*cimagf(phi) + cimagf(v)*crealf(phi))*_Complex_I;
+        phi = (crealf(phi)*crealf(_q->rotator) - cimagf(phi)*cimagf(_q->rotator)) +
+              (crealf(phi)*cimagf(_q->rotator) + cimagf(phi)*crealf(_q->rotator))*_Complex_I;
+        if ((k & 63) == 63)
+            phi /= cabsf(phi);
+    }
+    return ny;
+}
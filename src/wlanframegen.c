@@ -11,6 +11,18 @@
 // enable debugging for frame generator
 #define DEBUG_WLANFRAMEGEN 0
 
+// number of rendered SIGNAL symbols cached by (rate, length)
+#define WLANFRAMEGEN_SIGNAL_CACHE_LEN (8)
+
+// rendered SIGNAL symbol; since SIGNAL always follows the preamble, its
+// samples depend only on the rate and length fields
+struct wlanframegen_signal_s {
+    unsigned int  rate;             // primitive data rate
+    unsigned int  length;           // original data length (bytes)
+    float complex symbol[80];       // rendered symbol
+    float complex postfix[16];      // post-fix following symbol
+};
+
 struct wlanframegen_s {
     // options
     unsigned int rate;              // primitive data rate
@@ -20,7 +32,7 @@ struct wlanframegen_s {
     float g;                        // scaling factor (gain)
 
     // transform object
-    FFT_PLAN ifft;                  // ifft object
+    wlan_fft ifft;                  // ifft object
     float complex * buf_freq;       // frequency-domain buffer
     float complex * buf_time;       // time-domain buffer
 
@@ -35,6 +47,20 @@ struct wlanframegen_s {
     float * rampup;                 // ramp up window (ramp down is time-reversed)
     float complex * postfix;        // overlapping symbol buffer
 
+    // preamble (S0a, S0b, S1a, S1b) rendered once at creation
+    float complex preamble[320];            // preamble samples
+    float complex preamble_postfix[16];     // post-fix following preamble
+
+    // cache of rendered SIGNAL symbols (replaced round-robin)
+    struct wlanframegen_signal_s signal_cache[WLANFRAMEGEN_SIGNAL_CACHE_LEN];
+    unsigned int signal_cache_len;          // number of valid entries
+    unsigned int signal_cache_next;         // next entry to replace
+
+    // optional output stage (resampler and frequency shift)
+    wlan_resamp     output;         // output stage (NULL if disabled)
+    float complex * buf_base;       // padded baseband frame buffer
+    unsigned int    buf_base_len;   // allocated baseband buffer length
+
     // lengths
     unsigned int ndbps;             // number of data bits per OFDM symbol
     unsigned int ncbps;             // number of coded bits per OFDM symbol
@@ -69,13 +95,27 @@ struct wlanframegen_s {
 
 // create WLAN framing generator object
 wlanframegen wlanframegen_create()
+{
+    return wlanframegen_create_output(1.0f, 0.0f);
+}
+
+// create WLAN framing generator object with output stage
+//  _rate       :   output sample rate relative to 20 M samples/s, in [1,16]
+//  _fshift     :   frequency shift (cycles/output sample), in (-0.5,0.5)
+wlanframegen wlanframegen_create_output(float _rate,
+                                        float _fshift)
 {
     wlanframegen q = (wlanframegen) malloc(sizeof(struct wlanframegen_s));
 
+    // output stage, only when needed
+    q->output       = (_rate != 1.0f || _fshift != 0.0f) ? wlan_resamp_create(_rate, _fshift) : NULL;
+    q->buf_base     = NULL;
+    q->buf_base_len = 0;
+
     // allocate memory for transform objects
     q->buf_freq = (float complex*) malloc(64*sizeof(float complex));
     q->buf_time = (float complex*) malloc(64*sizeof(float complex));
-    q->ifft = FFT_CREATE_PLAN(64, q->buf_freq, q->buf_time, FFT_DIR_BACKWARD, FFT_METHOD);
+    q->ifft = wlan_fft_create(64, q->buf_freq, q->buf_time, WLAN_FFT_BACKWARD);
 
     // create pilot sequence generator
     q->ms_pilot = wlan_lfsr_create(7, 0x91, 0x7f);
@@ -121,6 +161,18 @@ wlanframegen wlanframegen_create()
     // reset objects
     wlanframegen_reset(q);
 
+    // render constant preamble once
+    wlanframegen_writesymbol_S0a(q, &q->preamble[  0]);
+    wlanframegen_writesymbol_S0b(q, &q->preamble[ 80]);
+    wlanframegen_writesymbol_S1a(q, &q->preamble[160]);
+    wlanframegen_writesymbol_S1b(q, &q->preamble[240]);
+    memmove(q->preamble_postfix, q->postfix, q->rampup_len*sizeof(float complex));
+    wlanframegen_reset(q);
+
+    // SIGNAL cache is initially empty
+    q->signal_cache_len  = 0;
+    q->signal_cache_next = 0;
+
     return q;
 }
 
@@ -130,7 +182,7 @@ void wlanframegen_destroy(wlanframegen _q)
     // free transform array memory
     free(_q->buf_freq);
     free(_q->buf_time);
-    FFT_DESTROY_PLAN(_q->ifft);
+    wlan_fft_destroy(_q->ifft);
     
     // destroy pilot sequence generator
     wlan_lfsr_destroy(_q->ms_pilot);
@@ -142,6 +194,11 @@ void wlanframegen_destroy(wlanframegen _q)
     // free memory for encoded message
     free(_q->msg_enc);
 
+    // destroy output stage
+    if (_q->output != NULL)
+        wlan_resamp_destroy(_q->output);
+    free(_q->buf_base);
+
     // free main object memory
     free(_q);
 }
@@ -181,6 +238,8 @@ void wlanframegen_print(wlanframegen _q)
                 _q->signal_int[4],
                 _q->signal_int[5]);
     }
+    if (_q->output != NULL)
+        wlan_resamp_print(_q->output);
 }
 
 // reset WLAN framing generator object internal state
@@ -323,23 +382,24 @@ int wlanframegen_writesymbol(wlanframegen    _q,
     //
     switch (_q->state) {
     case WLANFRAMEGEN_STATE_S0A:
-        wlanframegen_writesymbol_S0a(_q, _buffer);
+        memmove(_buffer, &_q->preamble[  0], 80*sizeof(float complex));
         _q->state = WLANFRAMEGEN_STATE_S0B;
         return 0;
     case WLANFRAMEGEN_STATE_S0B:
-        wlanframegen_writesymbol_S0b(_q, _buffer);
+        memmove(_buffer, &_q->preamble[ 80], 80*sizeof(float complex));
         _q->state = WLANFRAMEGEN_STATE_S1A;
         return 0;
     case WLANFRAMEGEN_STATE_S1A:
-        wlanframegen_writesymbol_S1a(_q, _buffer);
+        memmove(_buffer, &_q->preamble[160], 80*sizeof(float complex));
         _q->state = WLANFRAMEGEN_STATE_S1B;
         return 0;
     case WLANFRAMEGEN_STATE_S1B:
-        wlanframegen_writesymbol_S1b(_q, _buffer);
+        memmove(_buffer, &_q->preamble[240], 80*sizeof(float complex));
+        memmove(_q->postfix, _q->preamble_postfix, _q->rampup_len*sizeof(float complex));
         _q->state = WLANFRAMEGEN_STATE_SIGNAL;
         return 0;
     case WLANFRAMEGEN_STATE_SIGNAL:
-        wlanframegen_writesymbol_signal(_q, _buffer);
+        wlanframegen_writesymbol_signal_cached(_q, _buffer);
         _q->state = WLANFRAMEGEN_STATE_DATA;
         return 0;
     case WLANFRAMEGEN_STATE_DATA:
@@ -363,10 +423,115 @@ int wlanframegen_writesymbol(wlanframegen    _q,
     return 1;
 }
 
+// get number of samples in assembled frame, at output rate
+//  _q          :   framing generator object
+unsigned int wlanframegen_get_num_samples(wlanframegen _q)
+{
+    unsigned int num_samples = 80*wlanframegen_getframelen(_q);
+    return _q->output == NULL ? num_samples : wlan_resamp_get_num_output(_q->output, num_samples);
+}
+
+// get number of samples, at output rate, of a frame with the given
+// framing options without assembling it
+//  _q          :   framing generator object
+//  _txvector   :   framing options
+unsigned int wlanframegen_get_num_samples_txvector(wlanframegen           _q,
+                                                   struct wlan_txvector_s _txvector)
+{
+    // validate input
+    if (_txvector.DATARATE > 7) {
+        fprintf(stderr,"error: wlanframegen_get_num_samples_txvector(), invalid rate\n");
+        exit(1);
+    } else if (_txvector.LENGTH == 0 || _txvector.LENGTH > 4095) {
+        fprintf(stderr,"error: wlanframegen_get_num_samples_txvector(), invalid data length\n");
+        exit(1);
+    }
+
+    // number of OFDM symbols (see wlanframegen_assemble())
+    div_t d = div(16 + 8*_txvector.LENGTH + 6, wlanframe_ratetab[_txvector.DATARATE].ndbps);
+    unsigned int nsym = d.quot + (d.rem == 0 ? 0 : 1);
+
+    unsigned int num_samples = 80*(5 + nsym + 1);
+    return _q->output == NULL ? num_samples : wlan_resamp_get_num_output(_q->output, num_samples);
+}
+
+// write entire assembled frame to buffer, returning number of samples
+// written; the frame is always rendered from its beginning and passed
+// through the output stage if one is configured
+//  _q          :   framing generator object
+//  _buffer     :   output sample buffer [size: _n x 1]
+//  _n          :   buffer length, at least wlanframegen_get_num_samples()
+unsigned int wlanframegen_write_frame(wlanframegen    _q,
+                                      float complex * _buffer,
+                                      unsigned int    _n)
+{
+    // validate input
+    if (!_q->frame_assembled) {
+        fprintf(stderr,"error: wlanframegen_write_frame(), frame not assembled\n");
+        exit(1);
+    }
+    unsigned int num_samples = wlanframegen_get_num_samples(_q);
+    if (_n < num_samples) {
+        fprintf(stderr,"error: wlanframegen_write_frame(), buffer too short (%u < %u samples)\n",
+                _n, num_samples);
+        exit(1);
+    }
+
+    // render baseband directly to output
+    if (_q->output == NULL) {
+        wlanframegen_render_frame(_q, _buffer);
+        return num_samples;
+    }
+
+    // render baseband into padded buffer, then resample and shift
+    unsigned int num_base = 80*wlanframegen_getframelen(_q);
+    unsigned int pad      = wlan_resamp_get_padding(_q->output);
+    if (num_base + 2*pad > _q->buf_base_len) {
+        _q->buf_base_len = num_base + 2*pad;
+        _q->buf_base = (float complex*) realloc(_q->buf_base, _q->buf_base_len*sizeof(float complex));
+        memset(_q->buf_base, 0x00, pad*sizeof(float complex));
+    }
+    wlanframegen_render_frame(_q, &_q->buf_base[pad]);
+    memset(&_q->buf_base[pad + num_base], 0x00, pad*sizeof(float complex));
+    return wlan_resamp_execute(_q->output, _q->buf_base, num_base, _buffer);
+}
+
 // 
 // internal methods
 //
 
+// render assembled frame at 20 M samples/s
+//  _q          :   framing generator object
+//  _buffer     :   output sample buffer [size: 80*framelen x 1]
+void wlanframegen_render_frame(wlanframegen    _q,
+                               float complex * _buffer)
+{
+    // restart pilot sequence
+    wlan_lfsr_reset(_q->ms_pilot);
+
+    // preamble: short and long training sequences
+    float complex * p = _buffer;
+    memmove(p, _q->preamble, 320*sizeof(float complex));
+    memmove(_q->postfix, _q->preamble_postfix, _q->rampup_len*sizeof(float complex));
+    p += 320;
+
+    // SIGNAL field
+    wlanframegen_writesymbol_signal_cached(_q, p);
+    p += 80;
+
+    // DATA field
+    for (_q->data_symbol_counter=0; _q->data_symbol_counter<_q->nsym; _q->data_symbol_counter++) {
+        wlanframegen_writesymbol_data(_q, p);
+        p += 80;
+    }
+
+    // ramp down
+    wlanframegen_writesymbol_null(_q, p);
+
+    // frame is complete
+    _q->state = WLANFRAMEGEN_STATE_NULL;
+}
+
 // compute symbol: add/update pilots, add nulls and compute transform
 //  * input stored in 'X' (internal ifft input)
 //  * output stored in 'x' (internal ifft output)
@@ -384,7 +549,7 @@ void wlanframegen_compute_symbol(wlanframegen _q)
     // NOTE : NULL subcarriers have been set to zero in reset() method
 
     // run inverse transform
-    FFT_EXECUTE(_q->ifft);
+    wlan_fft_execute(_q->ifft);
 }
 
 // generate symbol (add cyclic prefix/postfix, overlap)
@@ -572,6 +737,37 @@ void wlanframegen_writesymbol_signal(wlanframegen _q,
                            _buffer);
 }
 
+// write SIGNAL symbol from cache, rendering and caching it on a miss;
+// must immediately follow the preamble
+void wlanframegen_writesymbol_signal_cached(wlanframegen    _q,
+                                            float complex * _buffer)
+{
+    // look up (rate, length)
+    unsigned int i;
+    for (i=0; i<_q->signal_cache_len; i++) {
+        struct wlanframegen_signal_s * e = &_q->signal_cache[i];
+        if (e->rate == _q->rate && e->length == _q->length) {
+            memmove(_buffer, e->symbol, 80*sizeof(float complex));
+            memmove(_q->postfix, e->postfix, _q->rampup_len*sizeof(float complex));
+
+            // keep pilot sequence in step with rendered symbol
+            wlan_lfsr_advance(_q->ms_pilot);
+            return;
+        }
+    }
+
+    // render symbol and store in next cache entry
+    wlanframegen_writesymbol_signal(_q, _buffer);
+    struct wlanframegen_signal_s * e = &_q->signal_cache[_q->signal_cache_next];
+    e->rate   = _q->rate;
+    e->length = _q->length;
+    memmove(e->symbol,  _buffer,     80*sizeof(float complex));
+    memmove(e->postfix, _q->postfix, _q->rampup_len*sizeof(float complex));
+    _q->signal_cache_next = (_q->signal_cache_next + 1) % WLANFRAMEGEN_SIGNAL_CACHE_LEN;
+    if (_q->signal_cache_len < WLANFRAMEGEN_SIGNAL_CACHE_LEN)
+        _q->signal_cache_len++;
+}
+
 // write data symbol(s)
 void wlanframegen_writesymbol_data(wlanframegen _q,
                                    float complex * _buffer)
@@ -8,6 +8,16 @@
 
 #include "liquid-wlan.internal.h"
 
+// Per-state profiling counters; when disabled, no profiling code is
+// compiled
+#ifndef WLANFRAMESYNC_PROFILING
+#define WLANFRAMESYNC_PROFILING         0
+#endif
+
+#if WLANFRAMESYNC_PROFILING
+#include <time.h>
+#endif
+
 #define DEBUG_WLANFRAMESYNC             0
 #define DEBUG_WLANFRAMESYNC_PRINT       0
 #define DEBUG_WLANFRAMESYNC_FILENAME    "wlanframesync_internal_debug.m"
@@ -17,19 +27,33 @@
 #define WLANFRAMESYNC_S0A_ABS_THRESH    (0.35f)
 //#define WLANFRAMESYNC_S0B_ABS_THRESH    (0.5f)
 
-// Thresholds for detecting first long sequence, S1[a]
-#define WLANFRAMESYNC_S1A_ABS_THRESH    (0.35f)
-#define WLANFRAMESYNC_S1A_ARG_THRESH    (0.3f)
+// Long sequence timing: normalized matched-filter output threshold for
+// both S1[a] and S1[b], number of lags past the peak observed before
+// accepting it, and length of search buffer (including 80 samples of
+// history at the end of the short sequences)
+#define WLANFRAMESYNC_S1_CORR_THRESH    (0.25f)
+#define WLANFRAMESYNC_S1_LOOKAHEAD      (8)
+#define WLANFRAMESYNC_S1_BUF_LEN        (576)
 
-// Thresholds for detecting second long sequence, S1[b]
-#define WLANFRAMESYNC_S1B_ABS_THRESH    (0.35f)
-#define WLANFRAMESYNC_S1B_ARG_THRESH    (0.3f)
+// Number of taps retained before the origin by DFT channel estimator
+#define WLANFRAMESYNC_CHANEST_PRECURSOR (4)
+
+// Nominal rms level of time-domain input to fixed-point transform
+// (Q15), leaving 24 dB of headroom
+#define WLANFRAMESYNC_Q15_LEVEL         (2048.0f)
+
+// data subcarrier indices in order of transmission
+static const unsigned char wlanframesync_data_bins[48] = {
+    38, 39, 40, 41, 42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+    55, 56, 58, 59, 60, 61, 62, 63,  1,  2,  3,  4,  5,  6,  8,  9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26};
 
 struct wlanframesync_s
 {
     // callback
     wlanframesync_callback callback;// user-defined callback function
     void *                 userdata;// user-defined context field
+    wlanframesync_header_callback header_callback; // user-defined header callback
     framesyncstats_s framesyncstats;// frame statistic object (synchronizer)
     framedatastats_s framedatastats;// frame statistic object (packet statistics)
 
@@ -39,11 +63,22 @@ struct wlanframesync_s
     unsigned int seed;              // data scrambler seed
 
     // transform object
-    FFT_PLAN fft;                   // ifft object
+    wlan_fft fft;                   // ifft object
     float complex * buf_freq;       // frequency-domain buffer
     float complex * buf_time;       // time-domain buffer
     windowcf        input_buffer;   // input sequence buffer
 
+    // long sequence matched filter (overlap-save)
+    wlan_fft fft_s1;                // forward transform [size: 128 x 1]
+    wlan_fft ifft_s1;               // reverse transform [size: 128 x 1]
+    float complex * buf_s1_time;    // time-domain buffer [size: 128 x 1]
+    float complex * buf_s1_freq;    // frequency-domain buffer [size: 128 x 1]
+    float complex * H_s1;           // matched filter response [size: 128 x 1]
+    float complex * buf_s1;         // long sequence search buffer
+    unsigned int    buf_s1_len;     // number of samples in search buffer
+    float *         rxy_s1;         // normalized matched filter output
+    unsigned int    num_lags;       // number of matched filter lags computed
+
     // synchronizer objects
     nco_crcf     nco_rx;            // numerically-controlled oscillator
     wlan_lfsr    ms_pilot;          // pilot sequence generator
@@ -56,10 +91,23 @@ struct wlanframesync_s
     float complex s0a_hat;          // first 'short' sequence statistic
     float complex s0b_hat;          // second 'short' sequence statistic
     float complex G1a[64], G1b[64]; // complex channel gain (long sequences)
+    float complex G1[64];           // complex channel gain (long sequences, averaged)
     float complex s1a_hat;          // first 'long' sequence statistic
     float complex s1b_hat;          // second 'long' sequence statistic
     float complex G[64];            // complex channel gain (composite)
     float complex R[64];            // complex channel correction (composite)
+    int           chanest;          // channel estimation method
+    unsigned int  chanest_ntaps;    // number of taps (DFT channel estimator)
+    float         chantrack_mu;     // decision-directed tracking step size (0: disabled)
+    float complex buf_freq_raw[64]; // phase-corrected symbol before equalization
+
+    // fixed-point receive profile
+    int           profile;          // receive profile, e.g. WLANFRAMESYNC_PROFILE_Q15
+    float         a_q15;            // input scaling to nominal Q15 level
+    int16_t       buf_q15[128];     // transform buffer, [re, im] pairs
+    int16_t       R_q15[64][2];     // equalizer [re, im], scaled by 2^R_q15_exp
+    unsigned int  R_q15_exp;        // equalizer exponent
+    int32_t       W_q15[64];        // soft bit weights (Q16)
 
     // lengths
     unsigned int ndbps;             // number of data bits per OFDM symbol
@@ -78,6 +126,8 @@ struct wlanframesync_s
     unsigned char   signal_dec[3];  // decoded message (SIGNAL field)
     unsigned char * msg_enc;        // encoded message (DATA field)
     unsigned char * msg_dec;        // decoded message (DATA field)
+    unsigned char * msg_soft;       // encoded soft bits (DATA field, Q15 profile)
+    unsigned int    max_length;     // maximum accepted payload length (bytes)
     unsigned char   modem_syms[48]; // modem symbols
     int signal_valid;               // SIGNAL field decoded properly?
     
@@ -86,20 +136,40 @@ struct wlanframesync_s
         WLANFRAMESYNC_STATE_SEEKPLCP=0, // seek initial PLCP
         WLANFRAMESYNC_STATE_RXSHORT0,   // receive first 'short' sequence
         WLANFRAMESYNC_STATE_RXSHORT1,   // receive second 'short' sequence
-        WLANFRAMESYNC_STATE_RXLONG0,    // receive first 'long' sequence
-        WLANFRAMESYNC_STATE_RXLONG1,    // receive second 'long' sequence
+        WLANFRAMESYNC_STATE_RXLONG,     // receive 'long' sequences
         WLANFRAMESYNC_STATE_RXSIGNAL,   // receive SIGNAL field
         WLANFRAMESYNC_STATE_RXDATA,     // receive DATA field
+        WLANFRAMESYNC_STATE_SKIPDATA,   // skip over DATA field
     } state;
     signed int timer;                   // sample timer
-    signed int block_counter;           // count number of S1 symbol hypothesis tests
     unsigned int num_symbols;           // number of received OFDM data symbols
+    unsigned int num_skip;              // number of DATA field samples left to skip
+    float        squelch;               // idle-channel search block energy threshold
+    float        seek_energy;           // energy of current search block
+    uint64_t     seek_energy_int;       // energy of current search block (integer input)
+    wlanframesync_airtimestats_s airtimestats; // airtime statistics
 
     // symbol buffer for callback
     float complex * buf_syms;           // symbol buffer for callback
     unsigned int    buf_syms_len;       // maximum number of symbols to store
     unsigned int    buf_syms_idx;       // index of symbol
 
+    // pipelined payload decoder (NULL if decoding inline)
+    wlan_decoder    decoder;
+    unsigned int    decoder_threads;    // number of decoder threads
+    unsigned int    decoder_buffers;    // number of decoder frame buffers
+
+#if WLANFRAMESYNC_PROFILING
+    // profiling counters, indexed by state; the time of each interval
+    // spent in one state is charged when the state changes or execute
+    // returns
+    wlanframesync_profilecounter_s prof[WLANFRAMESYNC_STATE_SKIPDATA+1];
+    wlanframesync_profilecounter_s prof_decode;
+    int                            prof_state;      // state being timed
+    unsigned long long             prof_t0;         // start of interval [ns]
+    unsigned long long             prof_decode_t0;  // start of decoding [ns]
+#endif
+
 #if DEBUG_WLANFRAMESYNC
     // debugging structures
     int debug_enabled;
@@ -108,6 +178,64 @@ struct wlanframesync_s
 #endif
 };
 
+#if WLANFRAMESYNC_PROFILING
+// monotonic time [ns]
+static unsigned long long wlanframesync_prof_now()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return 1000000000ULL*(unsigned long long)t.tv_sec + (unsigned long long)t.tv_nsec;
+}
+
+// charge interval to state being timed if the state has changed
+static void wlanframesync_prof_update(wlanframesync _q)
+{
+    if ((int)_q->state == _q->prof_state)
+        return;
+    unsigned long long t = wlanframesync_prof_now();
+    _q->prof[_q->prof_state].time_ns += t - _q->prof_t0;
+    _q->prof_state = _q->state;
+    _q->prof_t0    = t;
+}
+
+// start timing at beginning of execute
+static void wlanframesync_prof_begin(wlanframesync _q)
+{
+    _q->prof_state = _q->state;
+    _q->prof_t0    = wlanframesync_prof_now();
+}
+
+// charge remaining interval at end of execute
+static void wlanframesync_prof_end(wlanframesync _q)
+{
+    wlanframesync_prof_update(_q);
+    _q->prof[_q->prof_state].time_ns += wlanframesync_prof_now() - _q->prof_t0;
+}
+
+// charge payload decoding, excluding it from the current interval
+static void wlanframesync_prof_decode_end(wlanframesync _q)
+{
+    unsigned long long dt = wlanframesync_prof_now() - _q->prof_decode_t0;
+    _q->prof_decode.num_samples += 80*_q->nsym;
+    _q->prof_decode.time_ns     += dt;
+    _q->prof_t0                 += dt;
+}
+
+#   define WLANFRAMESYNC_PROF_BEGIN(_q)         wlanframesync_prof_begin(_q)
+#   define WLANFRAMESYNC_PROF_END(_q)           wlanframesync_prof_end(_q)
+#   define WLANFRAMESYNC_PROF_UPDATE(_q)        wlanframesync_prof_update(_q)
+#   define WLANFRAMESYNC_PROF_SAMPLES(_q,_n)    (_q)->prof[(_q)->state].num_samples += (_n)
+#   define WLANFRAMESYNC_PROF_DECODE_BEGIN(_q)  (_q)->prof_decode_t0 = wlanframesync_prof_now()
+#   define WLANFRAMESYNC_PROF_DECODE_END(_q)    wlanframesync_prof_decode_end(_q)
+#else
+#   define WLANFRAMESYNC_PROF_BEGIN(_q)
+#   define WLANFRAMESYNC_PROF_END(_q)
+#   define WLANFRAMESYNC_PROF_UPDATE(_q)
+#   define WLANFRAMESYNC_PROF_SAMPLES(_q,_n)
+#   define WLANFRAMESYNC_PROF_DECODE_BEGIN(_q)
+#   define WLANFRAMESYNC_PROF_DECODE_END(_q)
+#endif
+
 // create WLAN framing synchronizer object
 //  _callback   :   user-defined callback function
 //  _userdata   :   user-defined data structure
@@ -120,41 +248,78 @@ wlanframesync wlanframesync_create(wlanframesync_callback _callback,
     // set callback data
     q->callback = _callback;
     q->userdata = _userdata;
+    q->header_callback = NULL;
 
     // create transform object
     q->buf_freq = (float complex*) malloc(64*sizeof(float complex));
     q->buf_time = (float complex*) malloc(64*sizeof(float complex));
-    q->fft = FFT_CREATE_PLAN(64, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, FFT_METHOD);
+    q->fft = wlan_fft_create(64, q->buf_time, q->buf_freq, WLAN_FFT_FORWARD);
  
     // create input buffer the length of the transform
     q->input_buffer = windowcf_create(80);
 
+    // create long sequence matched filter, computing its response as
+    // conj(fft(s1)) normalized by the transform size and by |s1|
+    q->buf_s1_time = (float complex*) malloc(128*sizeof(float complex));
+    q->buf_s1_freq = (float complex*) malloc(128*sizeof(float complex));
+    q->H_s1        = (float complex*) malloc(128*sizeof(float complex));
+    q->fft_s1  = wlan_fft_create(128, q->buf_s1_time, q->buf_s1_freq, WLAN_FFT_FORWARD);
+    q->ifft_s1 = wlan_fft_create(128, q->buf_s1_freq, q->buf_s1_time, WLAN_FFT_BACKWARD);
+    unsigned int i;
+    for (i=0; i<128; i++)
+        q->buf_s1_time[i] = i < 64 ? wlanframe_s1[i] : 0.0f;
+    wlan_fft_execute(q->fft_s1);
+    float e_s1 = 0.0f;
+    for (i=0; i<64; i++)
+        e_s1 += crealf(wlanframe_s1[i])*crealf(wlanframe_s1[i]) + cimagf(wlanframe_s1[i])*cimagf(wlanframe_s1[i]);
+    for (i=0; i<128; i++)
+        q->H_s1[i] = conjf(q->buf_s1_freq[i]) / (128.0f * sqrtf(e_s1));
+    q->buf_s1  = (float complex*) malloc(WLANFRAMESYNC_S1_BUF_LEN*sizeof(float complex));
+    q->rxy_s1  = (float*)         malloc(WLANFRAMESYNC_S1_BUF_LEN*sizeof(float));
+
     // synchronizer objects
     q->nco_rx = nco_crcf_create(LIQUID_VCO);
     q->ms_pilot = wlan_lfsr_create(7, 0x91, 0x7f);
     q->mod_scheme = WLAN_MODEM_BPSK;
 
+    // set channel estimator
+    q->chanest       = WLANFRAMESYNC_CHANEST_POLY;
+    q->chanest_ntaps = 16;
+    q->chantrack_mu  = 0.0f;
+
+    // floating-point receive profile by default
+    q->profile = WLANFRAMESYNC_PROFILE_FLOAT;
+
+    // idle-channel detection disabled by default
+    q->squelch = 0.0f;
+
     // set initial properties
     q->rate   = WLANFRAME_RATE_6;
     q->length = 100;
     q->seed   = 0x5d;
 
-    // allocate memory for encoded message
-    q->enc_msg_len = wlan_packet_compute_enc_msg_len(q->rate, q->length);
-    q->msg_enc = (unsigned char*) malloc(q->enc_msg_len*sizeof(unsigned char));
-
-    // allocate memory for decoded message
-    q->dec_msg_len = 1;
-    q->msg_dec = (unsigned char*) malloc(q->dec_msg_len*sizeof(unsigned char));
+    // allocate message buffers for the largest frame
+    q->max_length = 4095;
+    q->msg_enc    = NULL;
+    q->msg_dec    = NULL;
+    q->msg_soft   = NULL;
+    wlanframesync_alloc_buffers(q);
 
     // reset object
     wlanframesync_reset(q);
     wlanframesync_reset_framedatastats(q);
+    wlanframesync_reset_airtimestats(q);
+    wlanframesync_reset_profilestats(q);
 
-    // symbol buffer for callback
-    q->buf_syms_len  = 1024;
+    // symbol capture for callback disabled by default
+    q->buf_syms_len  = 0;
     q->buf_syms_idx  = 0;
-    q->buf_syms      = (float complex*)malloc(q->buf_syms_len*sizeof(float complex));
+    q->buf_syms      = NULL;
+
+    // decode payloads inline by default
+    q->decoder         = NULL;
+    q->decoder_threads = 0;
+    q->decoder_buffers = 0;
 
 #if DEBUG_WLANFRAMESYNC
     // debugging structures
@@ -176,18 +341,33 @@ void wlanframesync_destroy(wlanframesync _q)
     if (_q->debug_framesyms != NULL) windowcf_destroy(_q->debug_framesyms);
 #endif
 
+    // stop decoder threads, delivering any pending frames
+    if (_q->decoder != NULL)
+        wlan_decoder_destroy(_q->decoder);
+
     // free transform object
     windowcf_destroy(_q->input_buffer);
     free(_q->buf_freq);
     free(_q->buf_time);
-    FFT_DESTROY_PLAN(_q->fft);
+    wlan_fft_destroy(_q->fft);
+
+    // free long sequence matched filter
+    free(_q->buf_s1_time);
+    free(_q->buf_s1_freq);
+    free(_q->H_s1);
+    free(_q->buf_s1);
+    free(_q->rxy_s1);
+    wlan_fft_destroy(_q->fft_s1);
+    wlan_fft_destroy(_q->ifft_s1);
     
     // destroy synchronizer objects
     nco_crcf_destroy(_q->nco_rx);       // numerically-controlled oscillator
     wlan_lfsr_destroy(_q->ms_pilot);    // pilot sequence generator
 
-    // free memory for encoded message
+    // free message buffers
     free(_q->msg_enc);
+    free(_q->msg_dec);
+    free(_q->msg_soft);
 
     free(_q->buf_syms);
 
@@ -214,6 +394,9 @@ void wlanframesync_reset(wlanframesync _q)
     _q->state = WLANFRAMESYNC_STATE_SEEKPLCP;
     _q->timer = 0;
     _q->num_symbols = 0;    // number of received OFDM data symbols
+    _q->num_skip = 0;       // number of DATA field samples left to skip
+    _q->seek_energy = 0.0f; // energy of current search block
+    _q->seek_energy_int = 0;
     _q->phi_prime = 0.0f;   // reset phase offset estimate
 
     // reset pilot sequence generator
@@ -232,6 +415,66 @@ void wlanframesync_reset(wlanframesync _q)
     _q->framesyncstats.fec1          = LIQUID_FEC_NONE;
 }
 
+// push sample through synchronizer state machine
+static void wlanframesync_push(wlanframesync _q,
+                               float complex _x)
+{
+    WLANFRAMESYNC_PROF_SAMPLES(_q, 1);
+
+    // correct for carrier frequency offset (only if not in
+    // initial 'seek PLCP' state)
+    if (_q->state != WLANFRAMESYNC_STATE_SEEKPLCP) {
+        nco_crcf_mix_down(_q->nco_rx, _x, &_x);
+        nco_crcf_step(_q->nco_rx);
+    }
+
+    // save input sample to buffer
+    windowcf_push(_q->input_buffer,_x);
+
+#if DEBUG_WLANFRAMESYNC
+    if (_q->debug_enabled) {
+        windowcf_push(_q->debug_x, _x);
+    }
+#endif
+
+    switch (_q->state) {
+    case WLANFRAMESYNC_STATE_SEEKPLCP:
+        wlanframesync_execute_seekplcp(_q);
+        break;
+    case WLANFRAMESYNC_STATE_RXSHORT0:
+        wlanframesync_execute_rxshort0(_q);
+        break;
+    case WLANFRAMESYNC_STATE_RXSHORT1:
+        wlanframesync_execute_rxshort1(_q);
+        break;
+    case WLANFRAMESYNC_STATE_RXLONG:
+        wlanframesync_execute_rxlong(_q);
+        break;
+    case WLANFRAMESYNC_STATE_RXSIGNAL:
+        wlanframesync_execute_rxsignal(_q);
+        break;
+    case WLANFRAMESYNC_STATE_RXDATA:
+        wlanframesync_execute_rxdata(_q);
+        break;
+    default:;
+        // should never get to this point
+        fprintf(stderr,"error: wlanframesync_execute(), invalid state\n");
+        exit(1);
+    }
+
+    WLANFRAMESYNC_PROF_UPDATE(_q);
+}
+
+// move integer search block energy into floating-point accumulator
+//  _q      :   framing synchronizer object
+//  _scale  :   energy scaling factor (inverse of full-scale energy)
+static void wlanframesync_flush_energy(wlanframesync _q,
+                                       float         _scale)
+{
+    _q->seek_energy += _scale * (float)_q->seek_energy_int;
+    _q->seek_energy_int = 0;
+}
+
 // execute framing synchronizer on input buffer
 //  _q      :   framing synchronizer object
 //  _buffer :   input buffer [size: _n x 1]
@@ -240,55 +483,354 @@ void wlanframesync_execute(wlanframesync          _q,
                            liquid_float_complex * _buffer,
                            unsigned int           _n)
 {
+    WLANFRAMESYNC_PROF_BEGIN(_q);
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        // fast-forward over DATA field of skipped frame; samples are
+        // neither mixed down nor buffered
+        if (_q->state == WLANFRAMESYNC_STATE_SKIPDATA) {
+            i += wlanframesync_execute_skipdata(_q, _n-i) - 1;
+            continue;
+        }
+
+        // accumulate energy of search block for idle-channel detection
+        if (_q->state == WLANFRAMESYNC_STATE_SEEKPLCP)
+            _q->seek_energy += crealf(_buffer[i])*crealf(_buffer[i]) + cimagf(_buffer[i])*cimagf(_buffer[i]);
+
+        wlanframesync_push(_q, _buffer[i]);
+    }
+    WLANFRAMESYNC_PROF_END(_q);
+}
+
+// execute framing synchronizer on interleaved 16-bit I/Q input
+//  _q      :   framing synchronizer object
+//  _buffer :   input buffer [size: 2*_n x 1]
+//  _n      :   number of complex input samples
+void wlanframesync_execute_cs16(wlanframesync   _q,
+                                const int16_t * _buffer,
+                                unsigned int    _n)
+{
+    const float scale = 1.0f / 32768.0f;
+    WLANFRAMESYNC_PROF_BEGIN(_q);
     unsigned int i;
-    float complex x;
     for (i=0; i<_n; i++) {
-        x = _buffer[i];
+        if (_q->state == WLANFRAMESYNC_STATE_SKIPDATA) {
+            i += wlanframesync_execute_skipdata(_q, _n-i) - 1;
+            continue;
+        }
 
-        // correct for carrier frequency offset (only if not in
-        // initial 'seek PLCP' state)
-        if (_q->state != WLANFRAMESYNC_STATE_SEEKPLCP) {
-            nco_crcf_mix_down(_q->nco_rx, x, &x);
-            nco_crcf_step(_q->nco_rx);
+        int32_t xi = _buffer[2*i  ];
+        int32_t xq = _buffer[2*i+1];
+
+        // accumulate energy of search block in integer arithmetic,
+        // converting only once block is complete
+        if (_q->state == WLANFRAMESYNC_STATE_SEEKPLCP) {
+            _q->seek_energy_int += (uint32_t)(xi*xi) + (uint32_t)(xq*xq);
+            if (_q->timer == 63)
+                wlanframesync_flush_energy(_q, scale*scale);
         }
 
-        // save input sample to buffer
-        windowcf_push(_q->input_buffer,x);
+        wlanframesync_push(_q, ((float)xi + (float)xq*_Complex_I) * scale);
+    }
+    wlanframesync_flush_energy(_q, scale*scale);
+    WLANFRAMESYNC_PROF_END(_q);
+}
 
-#if DEBUG_WLANFRAMESYNC
-        if (_q->debug_enabled) {
-            windowcf_push(_q->debug_x, x);
+// execute framing synchronizer on interleaved 8-bit I/Q input
+//  _q      :   framing synchronizer object
+//  _buffer :   input buffer [size: 2*_n x 1]
+//  _n      :   number of complex input samples
+void wlanframesync_execute_cs8(wlanframesync  _q,
+                               const int8_t * _buffer,
+                               unsigned int   _n)
+{
+    const float scale = 1.0f / 128.0f;
+    WLANFRAMESYNC_PROF_BEGIN(_q);
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        if (_q->state == WLANFRAMESYNC_STATE_SKIPDATA) {
+            i += wlanframesync_execute_skipdata(_q, _n-i) - 1;
+            continue;
         }
-#endif
 
-        switch (_q->state) {
-        case WLANFRAMESYNC_STATE_SEEKPLCP:
-            wlanframesync_execute_seekplcp(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXSHORT0:
-            wlanframesync_execute_rxshort0(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXSHORT1:
-            wlanframesync_execute_rxshort1(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXLONG0:
-            wlanframesync_execute_rxlong0(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXLONG1:
-            wlanframesync_execute_rxlong1(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXSIGNAL:
-            wlanframesync_execute_rxsignal(_q);
-            break;
-        case WLANFRAMESYNC_STATE_RXDATA:
-            wlanframesync_execute_rxdata(_q);
-            break;
-        default:;
-            // should never get to this point
-            fprintf(stderr,"error: wlanframesync_execute(), invalid state\n");
-            exit(1);
+        int32_t xi = _buffer[2*i  ];
+        int32_t xq = _buffer[2*i+1];
+
+        if (_q->state == WLANFRAMESYNC_STATE_SEEKPLCP) {
+            _q->seek_energy_int += (uint32_t)(xi*xi + xq*xq);
+            if (_q->timer == 63)
+                wlanframesync_flush_energy(_q, scale*scale);
         }
-    } // for (i=0; i<_n; i++)
+
+        wlanframesync_push(_q, ((float)xi + (float)xq*_Complex_I) * scale);
+    }
+    wlanframesync_flush_energy(_q, scale*scale);
+    WLANFRAMESYNC_PROF_END(_q);
+}
+
+// enable pipelined decoding on a pool of worker threads
+//  _q              :   framing synchronizer object
+//  _num_threads    :   number of decoder threads (0: decode inline, default)
+//  _num_buffers    :   number of frame buffers (maximum pending frames)
+int wlanframesync_set_decoder_threads(wlanframesync _q,
+                                      unsigned int  _num_threads,
+                                      unsigned int  _num_buffers)
+{
+    if (_num_threads > 0 && _num_buffers == 0) {
+        fprintf(stderr,"error: wlanframesync_set_decoder_threads(), number of buffers must be greater than zero\n");
+        return -1;
+    }
+
+    _q->decoder_threads = _num_threads;
+    _q->decoder_buffers = _num_buffers;
+    wlanframesync_create_decoder(_q);
+    return 0;
+}
+
+// block until all pending frames have been decoded and delivered
+int wlanframesync_flush(wlanframesync _q)
+{
+    if (_q->decoder != NULL)
+        wlan_decoder_flush(_q->decoder);
+    return 0;
+}
+
+// get pipelined decoder statistics
+wlanframesync_decoderstats_s wlanframesync_get_decoderstats(wlanframesync _q)
+{
+    if (_q->decoder != NULL)
+        return wlan_decoder_get_stats(_q->decoder);
+
+    wlanframesync_decoderstats_s stats;
+    memset(&stats, 0x00, sizeof(wlanframesync_decoderstats_s));
+    return stats;
+}
+
+// reset pipelined decoder statistics
+int wlanframesync_reset_decoderstats(wlanframesync _q)
+{
+    if (_q->decoder != NULL)
+        wlan_decoder_reset_stats(_q->decoder);
+    return 0;
+}
+
+// set channel estimation method
+//  _q      :   framing synchronizer object
+//  _method :   channel estimator, e.g. WLANFRAMESYNC_CHANEST_POLY
+//  _ntaps  :   number of time-domain taps (WLANFRAMESYNC_CHANEST_DFT only)
+int wlanframesync_set_chanest(wlanframesync _q,
+                              int           _method,
+                              unsigned int  _ntaps)
+{
+    switch (_method) {
+    case WLANFRAMESYNC_CHANEST_POLY:
+    case WLANFRAMESYNC_CHANEST_LTS:
+    case WLANFRAMESYNC_CHANEST_DFT:
+        break;
+    default:
+        fprintf(stderr,"error: wlanframesync_set_chanest(), invalid method (%d)\n", _method);
+        return -1;
+    }
+
+    if (_method == WLANFRAMESYNC_CHANEST_DFT && (_ntaps == 0 || _ntaps > 64-WLANFRAMESYNC_CHANEST_PRECURSOR)) {
+        fprintf(stderr,"error: wlanframesync_set_chanest(), number of taps must be in [1,%u]\n",
+                64-WLANFRAMESYNC_CHANEST_PRECURSOR);
+        return -1;
+    }
+
+    _q->chanest       = _method;
+    _q->chanest_ntaps = _ntaps;
+    return 0;
+}
+
+// set decision-directed channel tracking step size
+//  _q      :   framing synchronizer object
+//  _mu     :   step size in [0,1), 0 to disable (default)
+int wlanframesync_set_chantrack(wlanframesync _q,
+                                float         _mu)
+{
+    if (_mu < 0.0f || _mu >= 1.0f) {
+        fprintf(stderr,"error: wlanframesync_set_chantrack(), step size must be in [0,1)\n");
+        return -1;
+    } else if (_mu > 0.0f && _q->profile == WLANFRAMESYNC_PROFILE_Q15) {
+        fprintf(stderr,"error: wlanframesync_set_chantrack(), tracking not supported with Q15 profile\n");
+        return -1;
+    }
+    _q->chantrack_mu = _mu;
+    return 0;
+}
+
+// set header callback
+//  _q          :   framing synchronizer object
+//  _callback   :   header callback function (NULL to decode every frame)
+int wlanframesync_set_header_callback(wlanframesync                 _q,
+                                      wlanframesync_header_callback _callback)
+{
+    _q->header_callback = _callback;
+    return 0;
+}
+
+// set receive profile
+//  _q          :   framing synchronizer object
+//  _profile    :   receive profile, e.g. WLANFRAMESYNC_PROFILE_Q15
+int wlanframesync_set_profile(wlanframesync _q,
+                              int           _profile)
+{
+    if (_profile != WLANFRAMESYNC_PROFILE_FLOAT && _profile != WLANFRAMESYNC_PROFILE_Q15) {
+        fprintf(stderr,"error: wlanframesync_set_profile(), invalid profile (%d)\n", _profile);
+        return -1;
+    } else if (_profile == WLANFRAMESYNC_PROFILE_Q15 && _q->chantrack_mu > 0.0f) {
+        fprintf(stderr,"error: wlanframesync_set_profile(), Q15 profile does not support channel tracking\n");
+        return -1;
+    }
+
+    // buffers are re-sized below, so discard a frame whose DATA field is
+    // being received; the new profile applies from the next frame
+    if (_q->state == WLANFRAMESYNC_STATE_RXDATA)
+        wlanframesync_reset(_q);
+    _q->profile = _profile;
+
+    // re-size buffers for soft bits
+    wlanframesync_alloc_buffers(_q);
+    wlanframesync_create_decoder(_q);
+    return 0;
+}
+
+// set maximum accepted payload length
+//  _q          :   framing synchronizer object
+//  _max_length :   maximum payload length [bytes], in [1,4095]
+int wlanframesync_set_max_length(wlanframesync _q,
+                                 unsigned int  _max_length)
+{
+    if (_max_length == 0 || _max_length > 4095) {
+        fprintf(stderr,"error: wlanframesync_set_max_length(), length must be in [1,4095]\n");
+        return -1;
+    }
+
+    // buffers are re-sized, so drop any frame in progress
+    if (_q->state == WLANFRAMESYNC_STATE_RXDATA)
+        wlanframesync_reset(_q);
+    _q->max_length = _max_length;
+
+    wlanframesync_alloc_buffers(_q);
+    wlanframesync_create_decoder(_q);
+    return 0;
+}
+
+// set symbol capture depth
+//  _q          :   framing synchronizer object
+//  _num_symbols:   maximum number of symbols captured per frame, 0 to disable
+int wlanframesync_set_symbol_capture(wlanframesync _q,
+                                     unsigned int  _num_symbols)
+{
+    // buffer is re-sized, so drop any frame in progress
+    if (_q->state == WLANFRAMESYNC_STATE_RXDATA)
+        wlanframesync_reset(_q);
+
+    free(_q->buf_syms);
+    _q->buf_syms_len = _num_symbols;
+    _q->buf_syms_idx = 0;
+    _q->buf_syms     = _num_symbols > 0 ?
+        (float complex*) malloc(_num_symbols*sizeof(float complex)) : NULL;
+
+    wlanframesync_create_decoder(_q);
+    return 0;
+}
+
+// allocate message buffers for the maximum payload length so that no
+// memory is allocated while receiving
+void wlanframesync_alloc_buffers(wlanframesync _q)
+{
+    // the encoded (and soft) message is largest at the lowest rate; the
+    // decoded message holds only the payload
+    unsigned int enc_msg_len_max = wlan_packet_compute_enc_msg_len_max(_q->max_length);
+    _q->msg_dec = (unsigned char*) realloc(_q->msg_dec, _q->max_length*sizeof(unsigned char));
+
+    // hard-decision bytes with the floating-point profile, soft bits (one
+    // per coded bit) with the fixed-point profile
+    if (_q->profile == WLANFRAMESYNC_PROFILE_Q15) {
+        free(_q->msg_enc);
+        _q->msg_enc  = NULL;
+        _q->msg_soft = (unsigned char*) realloc(_q->msg_soft, 8*enc_msg_len_max*sizeof(unsigned char));
+    } else {
+        free(_q->msg_soft);
+        _q->msg_soft = NULL;
+        _q->msg_enc  = (unsigned char*) realloc(_q->msg_enc, enc_msg_len_max*sizeof(unsigned char));
+    }
+}
+
+// (re-)create pipelined decoder with current configuration, delivering
+// any pending frames first
+void wlanframesync_create_decoder(wlanframesync _q)
+{
+    // stop existing decoder threads, delivering any pending frames
+    if (_q->decoder != NULL) {
+        wlan_decoder_destroy(_q->decoder);
+        _q->decoder = NULL;
+    }
+
+    // create new decoder
+    if (_q->decoder_threads > 0) {
+        _q->decoder = wlan_decoder_create(_q->decoder_threads,
+                                          _q->decoder_buffers,
+                                          _q->max_length,
+                                          _q->profile == WLANFRAMESYNC_PROFILE_Q15,
+                                          _q->buf_syms_len,
+                                          _q->callback,
+                                          _q->userdata);
+    }
+}
+
+// set idle-channel threshold
+//  _q          :   framing synchronizer object
+//  _threshold  :   mean sample energy threshold [dB full scale]
+int wlanframesync_set_squelch(wlanframesync _q,
+                              float         _threshold)
+{
+    _q->squelch = 64.0f * powf(10.0f, 0.1f*_threshold);
+    return 0;
+}
+
+// get airtime statistics
+wlanframesync_airtimestats_s wlanframesync_get_airtimestats(wlanframesync _q)
+{
+    return _q->airtimestats;
+}
+
+// reset airtime statistics
+int wlanframesync_reset_airtimestats(wlanframesync _q)
+{
+    memset(&_q->airtimestats, 0x00, sizeof(wlanframesync_airtimestats_s));
+    return 0;
+}
+
+// get profiling statistics
+wlanframesync_profilestats_s wlanframesync_get_profilestats(wlanframesync _q)
+{
+    wlanframesync_profilestats_s stats;
+    memset(&stats, 0x00, sizeof(wlanframesync_profilestats_s));
+#if WLANFRAMESYNC_PROFILING
+    stats.enabled  = 1;
+    stats.seekplcp = _q->prof[WLANFRAMESYNC_STATE_SEEKPLCP];
+    stats.rxshort0 = _q->prof[WLANFRAMESYNC_STATE_RXSHORT0];
+    stats.rxshort1 = _q->prof[WLANFRAMESYNC_STATE_RXSHORT1];
+    stats.rxlong   = _q->prof[WLANFRAMESYNC_STATE_RXLONG];
+    stats.rxsignal = _q->prof[WLANFRAMESYNC_STATE_RXSIGNAL];
+    stats.rxdata   = _q->prof[WLANFRAMESYNC_STATE_RXDATA];
+    stats.skipdata = _q->prof[WLANFRAMESYNC_STATE_SKIPDATA];
+    stats.decode   = _q->prof_decode;
+#endif
+    return stats;
+}
+
+// reset profiling statistics
+int wlanframesync_reset_profilestats(wlanframesync _q)
+{
+#if WLANFRAMESYNC_PROFILING
+    memset(_q->prof, 0x00, sizeof(_q->prof));
+    memset(&_q->prof_decode, 0x00, sizeof(_q->prof_decode));
+#endif
+    return 0;
 }
 
 // get receiver RSSI
@@ -332,28 +874,25 @@ void wlanframesync_execute_seekplcp(wlanframesync _q)
     // reset timer
     _q->timer = 0;
 
+    // estimate gain from energy accumulated over the 64-sample block
+    // as samples were ingested
+    float e = _q->seek_energy;
+    float g = 64.0f / (e + 1e-12f);
+    _q->seek_energy = 0.0f;
+
+    // save gain (permits dynamic invocation of get_rssi() method)
+    _q->g0 = g;
+
+    // idle channel: skip detection
+    if (e < _q->squelch)
+        return;
+
     // read contents of input buffer
     float complex * rc;
     windowcf_read(_q->input_buffer, &rc);
-    
-    // estimate gain
-    // TODO : use gain from result of FFT
-    unsigned int i;
-    float g = 0.0f;
-    for (i=16; i<80; i+=4) {
-        // compute |rc[i]|^2 efficiently
-        g += crealf(rc[i  ])*crealf(rc[i  ]) + cimagf(rc[i  ])*cimagf(rc[i  ]);
-        g += crealf(rc[i+1])*crealf(rc[i+1]) + cimagf(rc[i+1])*cimagf(rc[i+1]);
-        g += crealf(rc[i+2])*crealf(rc[i+2]) + cimagf(rc[i+2])*cimagf(rc[i+2]);
-        g += crealf(rc[i+3])*crealf(rc[i+3]) + cimagf(rc[i+3])*cimagf(rc[i+3]);
-    }
-    g = 64.0f / (g + 1e-12f);
-    
-    // save gain (permits dynamic invocation of get_rssi() method)
-    _q->g0 = g;
 
     // estimate S0 gain
-    wlanframesync_estimate_gain_S0(_q, &rc[16], _q->G0a);
+    wlanframesync_estimate_gain_S0(&rc[16], _q->G0a);
     
     // compute S0 metrics
     float complex s_hat;
@@ -405,7 +944,7 @@ void wlanframesync_execute_rxshort0(wlanframesync _q)
     windowcf_read(_q->input_buffer, &rc);
 
     // re-estimate S0 gain
-    wlanframesync_estimate_gain_S0(_q, &rc[16], _q->G0a);
+    wlanframesync_estimate_gain_S0(&rc[16], _q->G0a);
 
     float complex s_hat;
     wlanframesync_S0_metrics(_q, _q->G0a, &s_hat);
@@ -439,7 +978,7 @@ void wlanframesync_execute_rxshort1(wlanframesync _q)
     windowcf_read(_q->input_buffer, &rc);
 
     // estimate S0 gain
-    wlanframesync_estimate_gain_S0(_q, &rc[16], _q->G0b);
+    wlanframesync_estimate_gain_S0(&rc[16], _q->G0b);
 
     float complex s_hat;
     wlanframesync_S0_metrics(_q, _q->G0b, &s_hat);
@@ -480,155 +1019,46 @@ void wlanframesync_execute_rxshort1(wlanframesync _q)
     printf("  searching for long sequence...\n");
 #endif
 
+    // seed long sequence search buffer with input buffer contents
+    memmove(_q->buf_s1, rc, 80*sizeof(float complex));
+    _q->buf_s1_len = 80;
+    _q->num_lags   = 0;
+
     // set state
-    _q->state = WLANFRAMESYNC_STATE_RXLONG0;
-    _q->block_counter = 0;
+    _q->state = WLANFRAMESYNC_STATE_RXLONG;
 }
 
-void wlanframesync_execute_rxlong0(wlanframesync _q)
+// search for long sequences with matched filter, processing a block of
+// 64 lags at a time
+void wlanframesync_execute_rxlong(wlanframesync _q)
 {
-    // set timer to 16, wait for phase to be relatively small
-    
-    _q->timer++;
-    if (_q->timer < 16)
-        return;
-
-    // reset timer
-    _q->timer = 0;
-
-    // run fft
+    // append newest sample to search buffer
     float complex * rc;
     windowcf_read(_q->input_buffer, &rc);
+    _q->buf_s1[_q->buf_s1_len++] = rc[79];
 
-    // estimate S1 gain, adding backoff in gain estimation
-    wlanframesync_estimate_gain_S1(_q, &rc[16-2], _q->G1a);
-
-    // compute S1 metrics
-    float complex s_hat;
-    wlanframesync_S1_metrics(_q, _q->G1a, &s_hat);
-    s_hat *= _q->g0;    // scale output by raw gain estimate
-
-    // rotate by complex phasor relative to timing backoff
-    //s_hat *= cexpf(_Complex_I * 2.0f * 2.0f * M_PI / 64.0f);
-    s_hat *= cexpf(_Complex_I * 0.19635f);
-
-    // save first 'long' symbol statistic
-    _q->s1a_hat = s_hat;
-
-#if DEBUG_WLANFRAMESYNC_PRINT
-    printf("    s_hat[%2u] :   %12.8f <%12.8f>\n", _q->block_counter, cabsf(s_hat), cargf(s_hat));
-#endif
-
-    float s_hat_abs = cabsf(s_hat);
-    float s_hat_arg = cargf(s_hat);
-    if (s_hat_arg >  M_PI) s_hat_arg -= 2.0f*M_PI;
-    if (s_hat_arg < -M_PI) s_hat_arg += 2.0f*M_PI;
-    
-    // check conditions for s_hat:
-    //  1. magnitude should be large (near unity) when aligned
-    //  2. phase should be very near zero (time aligned)
-    if (s_hat_abs        > WLANFRAMESYNC_S1A_ABS_THRESH &&
-        fabsf(s_hat_arg) < WLANFRAMESYNC_S1A_ARG_THRESH)
-    {
-#if DEBUG_WLANFRAMESYNC_PRINT
-        printf("    acquisition S1[a]\n");
-#endif
-        
-        // set state
-        _q->state = WLANFRAMESYNC_STATE_RXLONG1;
-
-        // reset timer
-        _q->timer = 0;
-    }
-
-    // eventually time-out
-    _q->block_counter++;
-
-    // TODO: determine appropriate number here
-    if (_q->block_counter == 32) {
-#if DEBUG_WLANFRAMESYNC_PRINT
-        printf("    timeout for S1[a]\n");
-#endif
-        // set state
-        _q->state = WLANFRAMESYNC_STATE_SEEKPLCP;
-
-        // reset timer
-        _q->timer = 0;
-    }
-}
-
-void wlanframesync_execute_rxlong1(wlanframesync _q)
-{
-    _q->timer++;
-    if (_q->timer < 64)
+    // wait until next block of lags can be computed
+    if (_q->buf_s1_len < _q->num_lags + 128)
         return;
 
-    // run fft
-    float complex * rc;
-    windowcf_read(_q->input_buffer, &rc);
-
-    // estimate S1 gain, adding backoff in gain estimation
-    wlanframesync_estimate_gain_S1(_q, &rc[16-2], _q->G1b);
-
-    // compute S1 metrics
-    float complex s_hat;
-    wlanframesync_S1_metrics(_q, _q->G1b, &s_hat);
-    s_hat *= _q->g0;    // scale output by raw gain estimate
-
-    // rotate by complex phasor relative to timing backoff
-    //s_hat *= cexpf(_Complex_I * 2.0f * 2.0f * M_PI / 64.0f);
-    s_hat *= cexpf(_Complex_I * 0.19635f);
-
-    // save second 'long' symbol statistic
-    _q->s1b_hat = s_hat;
-
-    // rotate by complex phasor relative to timing backoff
-    //s_hat *= liquid_cexpjf((float)(_q->backoff)*2.0f*M_PI/(float)(_q->M));
+    // run matched filter and search for S1[a]/S1[b] peak pair
+    wlanframesync_S1_correlate(_q);
+    int k = wlanframesync_S1_timing(_q);
 
+    if (k >= 0) {
+        // estimate gains, carrier offset, and equalizer at peak
+        wlanframesync_S1_acquire(_q, k);
+    } else if (_q->buf_s1_len == WLANFRAMESYNC_S1_BUF_LEN) {
+        // eventually time-out
 #if DEBUG_WLANFRAMESYNC_PRINT
-    printf("    s_hat[%2u] :   %12.8f <%12.8f>\n", _q->block_counter, cabsf(s_hat), cargf(s_hat));
+        printf("    timeout for S1\n");
 #endif
-
-    // check conditions for s_hat
-    float s_hat_abs = cabsf(s_hat);
-    float s_hat_arg = cargf(s_hat);
-    if (s_hat_arg >  M_PI) s_hat_arg -= 2.0f*M_PI;
-    if (s_hat_arg < -M_PI) s_hat_arg += 2.0f*M_PI;
-        
-    // check conditions for s_hat:
-    //  1. magnitude should be large (near unity) when aligned
-    //  2. phase should be very near zero (time aligned)
-    if (s_hat_abs        > WLANFRAMESYNC_S1B_ABS_THRESH &&
-        fabsf(s_hat_arg) < WLANFRAMESYNC_S1B_ARG_THRESH)
-    {
-#if DEBUG_WLANFRAMESYNC_PRINT
-        printf("    acquisition S1[b]\n");
-#endif
-        
-        // refine CFO estimate with G1a, G1b and adjust NCO appropriately
-        float nu_hat = wlanframesync_estimate_cfo_S1(_q->G1a, _q->G1b);
-        nco_crcf_adjust_frequency(_q->nco_rx, nu_hat);
-#if DEBUG_WLANFRAMESYNC_PRINT
-        printf("    nu_hat[1] :   %12.8f\n", nu_hat);
-#endif
-        // TODO : de-rotate S1b by phase offset (help with equalizer)
-
-        // estimate equalizer with G1a, G1b
-        wlanframesync_estimate_eqgain_poly(_q);
-        
         // set state
-        _q->state = WLANFRAMESYNC_STATE_RXLONG1;
+        _q->state = WLANFRAMESYNC_STATE_SEEKPLCP;
 
         // reset timer
         _q->timer = 0;
     }
-
-    // set state
-    _q->state = WLANFRAMESYNC_STATE_RXSIGNAL;
-
-    // reset timer
-    _q->timer = 0;
-
 }
 
 // receive the 'SIGNAL' field
@@ -647,7 +1077,7 @@ void wlanframesync_execute_rxsignal(wlanframesync _q)
     memmove(_q->buf_time, &rc[16-2], 64*sizeof(float complex));
 
     // compute fft, storing result into _q->buf_freq
-    FFT_EXECUTE(_q->fft);
+    wlan_fft_execute(_q->fft);
   
     // recover symbol, correcting for gain, pilot phase, etc.
     wlanframesync_rxsymbol(_q);
@@ -719,14 +1149,25 @@ void wlanframesync_execute_rxsignal(wlanframesync _q)
 
     // validate proper decoding
     if (!_q->signal_valid) {
-        // invoke callback
-        if (_q->callback != NULL) {
-            // assemble RX vector
-            struct wlan_rxvector_s rxvector;
-            rxvector.LENGTH     = 0;
-            rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
-            rxvector.DATARATE   = WLANFRAME_RATE_INVALID;
-            rxvector.SERVICE    = 0;
+        // assemble RX vector
+        struct wlan_rxvector_s rxvector;
+        rxvector.LENGTH     = 0;
+        rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
+        rxvector.DATARATE   = WLANFRAME_RATE_INVALID;
+        rxvector.SERVICE    = 0;
+
+        if (_q->decoder != NULL) {
+            // hand off to decoder threads to preserve callback ordering
+            struct wlan_decoder_job_s * job = wlan_decoder_acquire(_q->decoder);
+            if (job != NULL) {
+                job->header_valid        = 0;
+                job->rxvector            = rxvector;
+                job->stats               = _q->framesyncstats;
+                job->stats.num_framesyms = 0;
+                wlan_decoder_submit(_q->decoder, job);
+            }
+        } else if (_q->callback != NULL) {
+            // invoke callback
             //int retval =
             _q->callback(0, NULL, rxvector, _q->framesyncstats, _q->userdata);
         }
@@ -752,9 +1193,39 @@ void wlanframesync_execute_rxsignal(wlanframesync _q)
     default:;
     }
 
-    // set state
-    _q->state = WLANFRAMESYNC_STATE_RXDATA;
-    _q->buf_syms_idx = 0;
+    // let user decide whether to receive the DATA field
+    int action = WLANFRAMESYNC_HEADER_DECODE;
+    if (_q->header_callback != NULL) {
+        struct wlan_rxvector_s rxvector;
+        rxvector.LENGTH     = _q->length;
+        rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
+        rxvector.DATARATE   = _q->rate;
+        rxvector.SERVICE    = 0;
+        action = _q->header_callback(rxvector, _q->framesyncstats, _q->userdata);
+    }
+
+    switch (action) {
+    case WLANFRAMESYNC_HEADER_SKIP:
+        // fast-forward over DATA field
+        _q->airtimestats.num_frames_skipped++;
+        _q->airtimestats.num_samples_skipped += 80*_q->nsym;
+        _q->num_skip = 80*_q->nsym;
+        _q->state = WLANFRAMESYNC_STATE_SKIPDATA;
+        break;
+    case WLANFRAMESYNC_HEADER_ABORT:
+        // resume searching for frames
+        _q->airtimestats.num_frames_aborted++;
+        wlanframesync_reset(_q);
+        break;
+    default:
+        // receive DATA field
+        _q->airtimestats.num_frames_decoded++;
+        _q->airtimestats.num_samples_decoded += 80*_q->nsym;
+        if (_q->profile == WLANFRAMESYNC_PROFILE_Q15)
+            wlanframesync_estimate_eqgain_q15(_q);
+        _q->state = WLANFRAMESYNC_STATE_RXDATA;
+        _q->buf_syms_idx = 0;
+    }
 }
 
 // receive data symbols
@@ -769,13 +1240,71 @@ void wlanframesync_execute_rxdata(wlanframesync _q)
     // reset timer
     _q->timer = 0;
 
+    // recover symbol and demodulate
+    if (_q->profile == WLANFRAMESYNC_PROFILE_Q15)
+        wlanframesync_rxdata_symbol_q15(_q);
+    else
+        wlanframesync_rxdata_symbol(_q);
+
+    // increment number of received symbols
+    _q->num_symbols++;
+
+    // check number of symbols
+    if (_q->num_symbols == _q->nsym) {
+        // hand off to decoder threads if enabled
+        if (_q->decoder != NULL) {
+            wlanframesync_submit_payload(_q);
+            wlanframesync_reset(_q);
+            return;
+        }
+
+        // decode message
+        WLANFRAMESYNC_PROF_DECODE_BEGIN(_q);
+        if (_q->profile == WLANFRAMESYNC_PROFILE_Q15)
+            wlan_packet_decode_soft(_q->rate, _q->seed, _q->length, _q->msg_soft, _q->msg_dec);
+        else
+            wlan_packet_decode(_q->rate, _q->seed, _q->length, _q->msg_enc, _q->msg_dec);
+        WLANFRAMESYNC_PROF_DECODE_END(_q);
+
+        // populate frame data statistics
+        _q->framedatastats.num_payloads_valid++; // TODO: validate CRC?
+        _q->framedatastats.num_bytes_received += _q->length;
+
+        // populate frame sync statistics
+        _q->framesyncstats.evm  = 0;
+        _q->framesyncstats.rssi = wlanframesync_get_rssi(_q);
+        _q->framesyncstats.cfo  = wlanframesync_get_cfo(_q);
+        _q->framesyncstats.framesyms     = _q->buf_syms;
+        _q->framesyncstats.num_framesyms = _q->buf_syms_idx;
+
+        // assemble RX vector
+        struct wlan_rxvector_s rxvector;
+        rxvector.LENGTH     = _q->length;
+        rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
+        rxvector.DATARATE   = _q->rate;
+        rxvector.SERVICE    = 0;
+
+        // invoke callback
+        if (_q->callback != NULL) {
+            //int retval =
+            _q->callback(1, _q->msg_dec, rxvector, _q->framesyncstats, _q->userdata);
+        }
+
+        // reset and return
+        wlanframesync_reset(_q);
+    }
+}
+
+// receive data symbol: transform, equalize, hard demodulate and pack
+void wlanframesync_rxdata_symbol(wlanframesync _q)
+{
     // run fft
     float complex * rc;
     windowcf_read(_q->input_buffer, &rc);
     memmove(_q->buf_time, &rc[16-2], 64*sizeof(float complex));
 
     // compute fft, storing result into _q->buf_freq
-    FFT_EXECUTE(_q->fft);
+    wlan_fft_execute(_q->fft);
   
     // recover symbol, correcting for gain, pilot phase, etc.
     wlanframesync_rxsymbol(_q);
@@ -797,6 +1326,16 @@ void wlanframesync_execute_rxdata(wlanframesync _q)
             sym = wlan_demodulate(_q->mod_scheme, _q->buf_freq[k]);
             _q->modem_syms[n] = sym;
             n++;
+
+            // decision-directed channel tracking: normalized LMS update
+            // of the equalizer from the re-modulated hard decision, with
+            // step normalized by E{|x|^2} ~ 1/|R|^2
+            if (_q->chantrack_mu > 0.0f) {
+                float complex e = wlan_modulate(_q->mod_scheme, sym) - _q->buf_freq[k];
+                float mu = _q->chantrack_mu * (crealf(_q->R[k])*crealf(_q->R[k]) +
+                                               cimagf(_q->R[k])*cimagf(_q->R[k]));
+                _q->R[k] += (mu*e) * conjf(_q->buf_freq_raw[k]);
+            }
 #if DEBUG_WLANFRAMESYNC
             // TODO : move this outside loop
             if (_q->debug_enabled)
@@ -816,81 +1355,206 @@ void wlanframesync_execute_rxdata(wlanframesync _q)
                              &_q->msg_enc[_q->num_symbols * _q->bytes_per_symbol], 8, _q->bytes_per_symbol,
                              &num_written);
     assert(num_written == _q->bytes_per_symbol);
+}
 
-    // increment number of received symbols
-    _q->num_symbols++;
+// receive data symbol using the fixed-point (Q15) profile: transform,
+// track pilot phase, equalize and soft demodulate into _q->msg_soft
+void wlanframesync_rxdata_symbol_q15(wlanframesync _q)
+{
+    // convert input to Q15 at nominal level, saturating
+    float complex * rc;
+    windowcf_read(_q->input_buffer, &rc);
+    int16_t * x = _q->buf_q15;
+    float     a = _q->a_q15;
+    unsigned int i;
+    for (i=0; i<64; i++) {
+        float vr = crealf(rc[16-2+i]) * a;
+        float vi = cimagf(rc[16-2+i]) * a;
+        x[2*i  ] = (int16_t)(vr > 32767.0f ? 32767.0f : (vr < -32768.0f ? -32768.0f : vr));
+        x[2*i+1] = (int16_t)(vi > 32767.0f ? 32767.0f : (vi < -32768.0f ? -32768.0f : vi));
+    }
 
-    // check number of symbols
-    if (_q->num_symbols == _q->nsym) {
-        // decode message
-        wlan_packet_decode(_q->rate, _q->seed, _q->length, _q->msg_enc, _q->msg_dec);
+    // compute transform in place
+    wlan_fft64_q15(x);
 
-        // populate frame data statistics
-        _q->framedatastats.num_payloads_valid++; // TODO: validate CRC?
-        _q->framedatastats.num_bytes_received += _q->length;
+    // equalize pilot subcarriers at k = {-21, -7, 7, 21} (Q12)
+    const unsigned int pilot_bins[4] = {43, 57, 7, 21};
+    int32_t e     = _q->R_q15_exp;
+    int32_t round = e > 0 ? 1 << (e-1) : 0;
+    int32_t y_phase[4];
+    unsigned int pilot_phase = wlan_lfsr_advance(_q->ms_pilot);
+    for (i=0; i<4; i++) {
+        unsigned int k = pilot_bins[i];
+        int32_t yr = x[2*k], yi = x[2*k+1];
+        int32_t rr = _q->R_q15[k][0], ri = _q->R_q15[k][1];
+        int32_t pr = (yr*rr - yi*ri + round) >> e;
+        int32_t pi = (yr*ri + yi*rr + round) >> e;
+
+        // pilot phase as binary angle, removing pilot polarity
+        int flip = (i < 3) ? pilot_phase : !pilot_phase;
+        y_phase[i] = (uint16_t)(wlan_q15_atan2(pi, pr) + (flip ? 32768 : 0));
+    }
 
-        // populate frame sync statistics
-        _q->framesyncstats.evm  = 0;
-        _q->framesyncstats.rssi = wlanframesync_get_rssi(_q);
-        _q->framesyncstats.cfo  = wlanframesync_get_cfo(_q);
-        _q->framesyncstats.framesyms     = _q->buf_syms;
-        _q->framesyncstats.num_framesyms = _q->buf_syms_idx;
+    // unwrap phase: 16-bit differences wrap to [-pi, pi)
+    y_phase[0] = (int16_t)y_phase[0];
+    y_phase[1] = y_phase[0] + (int16_t)(y_phase[1] - y_phase[0]);
+    y_phase[2] = y_phase[1] + (int16_t)(y_phase[2] - y_phase[1]);
+    y_phase[3] = y_phase[2] + (int16_t)(y_phase[3] - y_phase[2]);
 
-        // assemble RX vector
-        struct wlan_rxvector_s rxvector;
-        rxvector.LENGTH     = _q->length;
-        rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
-        rxvector.DATARATE   = _q->rate;
-        rxvector.SERVICE    = 0;
+    // fit phase to 1st-order polynomial (see wlanframesync_rxsymbol),
+    // keeping 8 fractional bits of slope
+    int32_t p0    = (y_phase[0] + y_phase[1] + y_phase[2] + y_phase[3]) / 4;
+    int32_t p1_q8 = ((-21*y_phase[0] - 7*y_phase[1] + 7*y_phase[2] + 21*y_phase[3]) * 256) / 980;
 
-        // invoke callback
-        if (_q->callback != NULL) {
-            //int retval =
-            _q->callback(1, _q->msg_dec, rxvector, _q->framesyncstats, _q->userdata);
-        }
+    // compensate phase, equalize and soft demodulate data subcarriers
+    unsigned int nbpsc = _q->nbpsc;
+    unsigned char * soft = &_q->msg_soft[_q->num_symbols * _q->ncbps];
+    for (i=0; i<48; i++) {
+        unsigned int k  = wlanframesync_data_bins[i];
+        int32_t      sk = k < 32 ? (int32_t)k : (int32_t)k - 64;
+
+        // rotate by exp(-j(p0 + p1 k)), Q15
+        uint16_t theta = (uint16_t)(-(p0 + (p1_q8*sk)/256));
+        int32_t c  = wlan_q15_cos(theta);
+        int32_t s  = wlan_q15_sin(theta);
+        int32_t xr = x[2*k], xi = x[2*k+1];
+        int32_t yr = (xr*c - xi*s + (1<<14)) >> 15;
+        int32_t yi = (xr*s + xi*c + (1<<14)) >> 15;
+
+        // equalize (Q12)
+        int32_t rr = _q->R_q15[k][0], ri = _q->R_q15[k][1];
+        int32_t zr = (yr*rr - yi*ri + round) >> e;
+        int32_t zi = (yr*ri + yi*rr + round) >> e;
+
+        wlan_demodulate_soft(_q->mod_scheme, zr, zi, _q->W_q15[k], &soft[i*nbpsc]);
+
+        if (_q->buf_syms_idx < _q->buf_syms_len)
+            _q->buf_syms[_q->buf_syms_idx++] = ((float)zr + (float)zi*_Complex_I) * (1.0f/4096.0f);
+    }
 
-        // reset and return
+    // track carrier frequency from common phase
+    wlanframesync_track_phase(_q, (float)p0 * (float)(2*M_PI/65536.0));
+}
+
+// fast-forward over DATA field of skipped frame
+//  _q      :   framing synchronizer object
+//  _n      :   number of input samples available
+//  returns number of samples consumed (at least one)
+unsigned int wlanframesync_execute_skipdata(wlanframesync _q,
+                                            unsigned int  _n)
+{
+    unsigned int n = _n < _q->num_skip ? _n : _q->num_skip;
+    _q->num_skip -= n;
+    WLANFRAMESYNC_PROF_SAMPLES(_q, n);
+
+    // resume searching for frames at end of DATA field
+    if (_q->num_skip == 0) {
         wlanframesync_reset(_q);
+        WLANFRAMESYNC_PROF_UPDATE(_q);
     }
+
+    return n;
 }
 
+// hand received DATA field off to pipelined decoder; the frame is dropped
+// if no frame buffer is free
+void wlanframesync_submit_payload(wlanframesync _q)
+{
+    struct wlan_decoder_job_s * job = wlan_decoder_acquire(_q->decoder);
+    if (job == NULL)
+        return;
+
+    // copy encoded message and frame parameters
+    job->header_valid = 1;
+    job->rate         = _q->rate;
+    job->seed         = _q->seed;
+    job->length       = _q->length;
+    job->soft         = _q->profile == WLANFRAMESYNC_PROFILE_Q15;
+    if (job->soft) {
+        memmove(job->msg_soft, _q->msg_soft, _q->nsym*_q->ncbps*sizeof(unsigned char));
+    } else {
+        memmove(job->msg_enc, _q->msg_enc, _q->enc_msg_len*sizeof(unsigned char));
+    }
+
+    // populate frame data statistics
+    _q->framedatastats.num_payloads_valid++; // TODO: validate CRC?
+    _q->framedatastats.num_bytes_received += _q->length;
+
+    // populate frame sync statistics, copying symbols into frame buffer
+    unsigned int num_framesyms = _q->buf_syms_idx < job->buf_syms_len ?
+                                 _q->buf_syms_idx : job->buf_syms_len;
+    if (num_framesyms > 0)
+        memmove(job->buf_syms, _q->buf_syms, num_framesyms*sizeof(float complex));
+    job->stats               = _q->framesyncstats;
+    job->stats.evm           = 0;
+    job->stats.rssi          = wlanframesync_get_rssi(_q);
+    job->stats.cfo           = wlanframesync_get_cfo(_q);
+    job->stats.num_framesyms = num_framesyms;
+
+    // assemble RX vector
+    job->rxvector.LENGTH     = _q->length;
+    job->rxvector.RSSI       = 200 + (unsigned int) (10*log10f(_q->g0));
+    job->rxvector.DATARATE   = _q->rate;
+    job->rxvector.SERVICE    = 0;
+
+    wlan_decoder_submit(_q->decoder, job);
+}
+
+// 16-point DFT twiddle factors, exp(-j 2 pi n / 16)
+static const float complex wlanframesync_W16[16] = {
+     1.00000000f + _Complex_I* 0.00000000f,
+     0.92387953f + _Complex_I*-0.38268343f,
+     0.70710678f + _Complex_I*-0.70710678f,
+     0.38268343f + _Complex_I*-0.92387953f,
+     0.00000000f + _Complex_I*-1.00000000f,
+    -0.38268343f + _Complex_I*-0.92387953f,
+    -0.70710678f + _Complex_I*-0.70710678f,
+    -0.92387953f + _Complex_I*-0.38268343f,
+    -1.00000000f + _Complex_I* 0.00000000f,
+    -0.92387953f + _Complex_I* 0.38268343f,
+    -0.70710678f + _Complex_I* 0.70710678f,
+    -0.38268343f + _Complex_I* 0.92387953f,
+     0.00000000f + _Complex_I* 1.00000000f,
+     0.38268343f + _Complex_I* 0.92387953f,
+     0.70710678f + _Complex_I* 0.70710678f,
+     0.92387953f + _Complex_I* 0.38268343f};
+
 // estimate short sequence gain
-//  _q      :   wlanframesync object
-//  _x      :   input array (time), [size: M x 1]
-//  _G      :   output gain (freq)
-void wlanframesync_estimate_gain_S0(wlanframesync _q,
-                                    float complex * _x,
+//  _x      :   input array (time), [size: 64 x 1]
+//  _G      :   output gain (freq), [size: 64 x 1]
+void wlanframesync_estimate_gain_S0(float complex * _x,
                                     float complex * _G)
 {
-    // move input array into fft input buffer
-    memmove(_q->buf_time, _x, 64*sizeof(float complex));
-
-    // compute fft, storing result into _q->buf_freq
-    FFT_EXECUTE(_q->fft);
-    
-    // compute gain, ignoring NULL subcarriers
+    // The short sequence only occupies every fourth subcarrier, and
+    // bin 4k of the 64-point DFT equals bin k of the 16-point DFT of the
+    // input folded onto 16 samples. Fold the input and compute only the
+    // 12 bins required.
     unsigned int i;
+    float complex x16[16];
+    for (i=0; i<16; i++)
+        x16[i] = _x[i] + _x[i+16] + _x[i+32] + _x[i+48];
+
+    // nominal gain (normalization factor)
     float gain = 0.054127f; // sqrt(12)/64 ; sqrtf(_q->M_S0) / (float)(_q->M);
 
     // clear input
     for (i=0; i<64; i++) _G[i] = 0.0f;
 
+    // compute gain on bins 4, 8, ... 24 and 40, 44, ... 60, ignoring NULL
+    // subcarriers
     // NOTE : if cabsf(_q->S0[i]) == 0 then we can multiply by conjugate
     //        rather than compute division
-    //_G[i] = _q->buf_freq[i] / _q->S0[i];
-    _G[40] = _q->buf_freq[40] * conjf(wlanframe_S0[40]) * gain;
-    _G[44] = _q->buf_freq[44] * conjf(wlanframe_S0[44]) * gain;
-    _G[48] = _q->buf_freq[48] * conjf(wlanframe_S0[48]) * gain;
-    _G[52] = _q->buf_freq[52] * conjf(wlanframe_S0[52]) * gain;
-    _G[56] = _q->buf_freq[56] * conjf(wlanframe_S0[56]) * gain;
-    _G[60] = _q->buf_freq[60] * conjf(wlanframe_S0[60]) * gain;
-    //
-    _G[ 4] = _q->buf_freq[ 4] * conjf(wlanframe_S0[ 4]) * gain;
-    _G[ 8] = _q->buf_freq[ 8] * conjf(wlanframe_S0[ 8]) * gain;
-    _G[12] = _q->buf_freq[12] * conjf(wlanframe_S0[12]) * gain;
-    _G[16] = _q->buf_freq[16] * conjf(wlanframe_S0[16]) * gain;
-    _G[20] = _q->buf_freq[20] * conjf(wlanframe_S0[20]) * gain;
-    _G[24] = _q->buf_freq[24] * conjf(wlanframe_S0[24]) * gain;
+    unsigned int k;
+    for (k=1; k<16; k++) {
+        if (k > 6 && k < 10)
+            continue;
+
+        float complex X = 0.0f;
+        for (i=0; i<16; i++)
+            X += x16[i] * wlanframesync_W16[(k*i) & 15];
+
+        _G[4*k] = X * conjf(wlanframe_S0[4*k]) * gain;
+    }
 }
 
 // compute S0 metrics
@@ -963,7 +1627,7 @@ void wlanframesync_estimate_gain_S1(wlanframesync _q,
     memmove(_q->buf_time, _x, 64*sizeof(float complex));
 
     // compute fft, storing result into _q->buf_freq
-    FFT_EXECUTE(_q->fft);
+    wlan_fft_execute(_q->fft);
     
     // nominal gain (normalization factor)
     float gain = 0.11267f; // sqrt(52)/64 ; sqrtf(_q->M_S1) / (float)(_q->M);
@@ -997,6 +1661,126 @@ void wlanframesync_S1_metrics(wlanframesync _q,
     *_s_hat = s_hat * 0.019231f;    // 1/52
 }
 
+// compute next block of 64 normalized long sequence matched filter
+// outputs, |x*s1|^2 / (|x|^2 |s1|^2), using overlap-save
+void wlanframesync_S1_correlate(wlanframesync _q)
+{
+    // correlate 128-sample segment with s1 (first 64 outputs are valid)
+    float complex * x = &_q->buf_s1[_q->num_lags];
+    memmove(_q->buf_s1_time, x, 128*sizeof(float complex));
+    wlan_fft_execute(_q->fft_s1);
+    unsigned int i;
+    for (i=0; i<128; i++)
+        _q->buf_s1_freq[i] *= _q->H_s1[i];
+    wlan_fft_execute(_q->ifft_s1);
+
+    // compute energy in first window
+    float e = 0.0f;
+    for (i=0; i<64; i++)
+        e += crealf(x[i])*crealf(x[i]) + cimagf(x[i])*cimagf(x[i]);
+
+    // normalize by energy, sliding window
+    for (i=0; i<64; i++) {
+        float complex rxy = _q->buf_s1_time[i];
+        float rxy2 = crealf(rxy)*crealf(rxy) + cimagf(rxy)*cimagf(rxy);
+        _q->rxy_s1[_q->num_lags + i] = rxy2 / (e + 1e-12f);
+
+        e += crealf(x[i+64])*crealf(x[i+64]) + cimagf(x[i+64])*cimagf(x[i+64]);
+        e -= crealf(x[i   ])*crealf(x[i   ]) + cimagf(x[i   ])*cimagf(x[i   ]);
+    }
+    _q->num_lags += 64;
+}
+
+// find start of S1[a] from matched filter output, returning -1 if no
+// peak pair has been found yet
+int wlanframesync_S1_timing(wlanframesync _q)
+{
+    // find lag maximizing combined S1[a], S1[b] output, keeping backoff
+    // of two samples for gain estimation
+    int k;
+    int k_hat = -1;
+    float rxy_max = 0.0f;
+    for (k=2; k + 64 < (int)_q->num_lags; k++) {
+        float rxy = _q->rxy_s1[k] + _q->rxy_s1[k+64];
+        if (rxy > rxy_max) {
+            rxy_max = rxy;
+            k_hat   = k;
+        }
+    }
+
+    if (k_hat < 0)
+        return -1;
+
+    // check that both peaks exceed threshold and are of similar level
+    // (rejecting short sequence paired with S1[a]), and that enough lags
+    // past the peak have been observed
+    float rxy_a = _q->rxy_s1[k_hat   ];
+    float rxy_b = _q->rxy_s1[k_hat+64];
+    if (rxy_a < WLANFRAMESYNC_S1_CORR_THRESH ||
+        rxy_b < WLANFRAMESYNC_S1_CORR_THRESH ||
+        rxy_a < 0.5f*rxy_b || rxy_b < 0.5f*rxy_a ||
+        k_hat + 64 + WLANFRAMESYNC_S1_LOOKAHEAD >= (int)_q->num_lags)
+    {
+        return -1;
+    }
+
+#if DEBUG_WLANFRAMESYNC_PRINT
+    printf("    S1 timing : %d (rxy : %8.4f, %8.4f)\n", k_hat, _q->rxy_s1[k_hat], _q->rxy_s1[k_hat+64]);
+#endif
+    return k_hat;
+}
+
+// estimate long sequence gains, carrier offset, and equalizer once S1[a]
+// has been found, and start receiving SIGNAL field
+//  _q      :   wlanframesync object
+//  _k      :   start of S1[a] in search buffer
+void wlanframesync_S1_acquire(wlanframesync _q,
+                              unsigned int  _k)
+{
+    // estimate S1 gains, adding backoff in gain estimation
+    wlanframesync_estimate_gain_S1(_q, &_q->buf_s1[_k   -2], _q->G1a);
+    wlanframesync_estimate_gain_S1(_q, &_q->buf_s1[_k+64-2], _q->G1b);
+
+    // compute S1 metrics, scaling output by raw gain estimate and
+    // rotating by complex phasor relative to timing backoff
+    wlanframesync_S1_metrics(_q, _q->G1a, &_q->s1a_hat);
+    wlanframesync_S1_metrics(_q, _q->G1b, &_q->s1b_hat);
+    _q->s1a_hat *= _q->g0 * cexpf(_Complex_I * 0.19635f);
+    _q->s1b_hat *= _q->g0 * cexpf(_Complex_I * 0.19635f);
+
+    // refine CFO estimate with G1a, G1b and adjust NCO appropriately
+    float nu_hat = wlanframesync_estimate_cfo_S1(_q->G1a, _q->G1b);
+    nco_crcf_adjust_frequency(_q->nco_rx, nu_hat);
+#if DEBUG_WLANFRAMESYNC_PRINT
+    printf("    nu_hat[1] :   %12.8f\n", nu_hat);
+#endif
+
+    // rotate S1[a] gains by carrier phase across one long sequence to
+    // align with S1[b], and average (LTS and DFT estimators)
+    unsigned int i;
+    float complex r = cexpf(_Complex_I*64.0f*nu_hat);
+    for (i=0; i<64; i++)
+        _q->G1[i] = 0.5f*(_q->G1a[i]*r + _q->G1b[i]);
+
+    // estimate equalizer
+    wlanframesync_estimate_eqgain(_q);
+
+    // move samples already received from SIGNAL field (including guard)
+    // into input buffer, correcting for refined carrier offset
+    unsigned int n = _k + 128;
+    windowcf_reset(_q->input_buffer);
+    for (i=n; i<_q->buf_s1_len; i++) {
+        float dphi = nu_hat * (float)(_q->buf_s1_len - i);
+        windowcf_push(_q->input_buffer, _q->buf_s1[i]*cexpf(_Complex_I*dphi));
+    }
+
+    // set state
+    _q->state = WLANFRAMESYNC_STATE_RXSIGNAL;
+
+    // set timer to number of samples already received
+    _q->timer = _q->buf_s1_len - n;
+}
+
 // estimate carrier frequency offset from S1 gains
 float wlanframesync_estimate_cfo_S1(float complex * _G1a,
                                     float complex * _G1b)
@@ -1014,116 +1798,211 @@ float wlanframesync_estimate_cfo_S1(float complex * _G1a,
 
 
 
-// estimate complex equalizer gain from G0 and G1
-//  _q      :   wlanframesync object
-//  _ntaps  :   number of time-domain taps for smoothing
-void wlanframesync_estimate_eqgain(wlanframesync _q,
-                                   unsigned int _ntaps)
+// estimate complex equalizer gain and correction with selected method
+void wlanframesync_estimate_eqgain(wlanframesync _q)
 {
+    switch (_q->chanest) {
+    case WLANFRAMESYNC_CHANEST_POLY:
+        wlanframesync_estimate_eqgain_poly(_q);
+        break;
+    case WLANFRAMESYNC_CHANEST_LTS:
+        wlanframesync_estimate_eqgain_lts(_q);
+        break;
+    case WLANFRAMESYNC_CHANEST_DFT:
+        wlanframesync_estimate_eqgain_dft(_q, _q->chanest_ntaps);
+        break;
+    default:
+        fprintf(stderr,"error: wlanframesync_estimate_eqgain(), invalid method\n");
+        exit(1);
+    }
 }
 
-// estimate complex equalizer gain from G0 and G1 using polynomial fit
-void wlanframesync_estimate_eqgain_poly(wlanframesync _q)
+// compute zero-forcing channel correction from composite gain, G
+void wlanframesync_estimate_eqgain_zf(wlanframesync _q)
 {
-    // polynomial order
-    unsigned int order = 2;
-
-    // equalizer (polynomial)
-    float x_eq[52];             // frequency array
-    float y_eq_abs[52];         // magnitude array
-    float y_eq_arg[52];         // phase array
-    float p_eq_abs[order+1];    // polynomial coefficients (magnitude)
-    float p_eq_arg[order+1];    // polynomial coefficients (phase)
-
-    // average complex gains
     unsigned int i;
-    unsigned int k;
-    unsigned int n=0;
     for (i=0; i<64; i++) {
-        // start at mid-point (effective fftshift)
-        k = (i + 32) % 64;
-
-        if (k == 0 || (k>26 && k<38) ) {
+        if (i == 0 || (i>26 && i<38) ) {
             // NULL subcarrier
+            _q->G[i] = 0.0f;
+            _q->R[i] = 0.0f;
         } else {
-            // validate counter
-            assert(n < 52);
+            // composite channel correction
+            // 0.11267 = sqrt(52)/64
+            float g2 = crealf(_q->G[i])*crealf(_q->G[i]) + cimagf(_q->G[i])*cimagf(_q->G[i]);
+            _q->R[i] = 0.11267f * conjf(_q->G[i]) / (g2 + 1e-12f);
+        }
+    }
+}
 
-            // DATA/PILOT subcarrier (S1 enabled)
-            //float complex G = 0.5f*(_q->G1a + _q->G1b);
-            float complex G = _q->G1b[k];
+// estimate complex equalizer gain from averaged long sequences, using
+// per-subcarrier zero-forcing
+void wlanframesync_estimate_eqgain_lts(wlanframesync _q)
+{
+    memmove(_q->G, _q->G1, 64*sizeof(float complex));
+    wlanframesync_estimate_eqgain_zf(_q);
+}
 
-            // store resulting...
-            x_eq[n] = (k > 31) ? (float)k - (float)(64) : (float)k;
-            x_eq[n] = x_eq[n] / (float)(64);
-            y_eq_abs[n] = cabsf(G);
-            y_eq_arg[n] = cargf(G);
+// estimate complex equalizer gain from averaged long sequences, smoothing
+// by truncating the channel impulse response in the time domain
+//  _q      :   wlanframesync object
+//  _ntaps  :   number of time-domain taps to retain
+void wlanframesync_estimate_eqgain_dft(wlanframesync _q,
+                                       unsigned int  _ntaps)
+{
+    // fill NULL subcarriers by interpolating across them to reduce
+    // leakage when truncating
+    unsigned int i;
+    float complex G[64];
+    memmove(G, _q->G1, 64*sizeof(float complex));
+    G[0] = 0.5f*(G[1] + G[63]);
+    for (i=27; i<38; i++)
+        G[i] = G[26] + (G[38] - G[26]) * (float)(i-26) / 12.0f;
 
-            // update counter
-            n++;
-        }
+    // compute impulse response using forward transform, h = conj(fft(conj(G)))/64
+    for (i=0; i<64; i++)
+        _q->buf_time[i] = conjf(G[i]);
+    wlan_fft_execute(_q->fft);
+
+    // retain first _ntaps taps plus a few before the origin (which can
+    // appear with timing error), transforming back into the frequency
+    // domain
+    for (i=0; i<64; i++) {
+        int keep = i < _ntaps || i >= 64-WLANFRAMESYNC_CHANEST_PRECURSOR;
+        _q->buf_time[i] = keep ? conjf(_q->buf_freq[i]) / 64.0f : 0.0f;
     }
-    
-    // validate counter
-    assert(n == 52);
+    wlan_fft_execute(_q->fft);
+
+    memmove(_q->G, _q->buf_freq, 64*sizeof(float complex));
+    wlanframesync_estimate_eqgain_zf(_q);
+}
+
+// estimate complex equalizer gain from G0 and G1 using polynomial fit
+void wlanframesync_estimate_eqgain_poly(wlanframesync _q)
+{
+    // Fit magnitude and unwrapped phase of the gain to 2nd-order
+    // polynomials in the subcarrier index k = -26..26 (k != 0). Because
+    // the abscissas are constant and symmetric, the least-squares
+    // solution reduces to fixed projections:
+    //   p1 = sum(k y) / S2
+    //   p0 = (S4 sum(y) - S2 sum(k^2 y)) / det
+    //   p2 = (S0 sum(k^2 y) - S2 sum(y)) / det
+    // where S0 = 52, S2 = sum(k^2), S4 = sum(k^4), det = S0 S4 - S2^2
+    const float S0  = 52.0f;
+    const float S2  = 12402.0f;
+    const float S4  = 5221242.0f;
+    const float det = 117694980.0f;
+
+    // accumulate projections, unwrapping phase across subcarriers
+    float sy_abs = 0.0f, sky_abs = 0.0f, sk2y_abs = 0.0f;
+    float sy_arg = 0.0f, sky_arg = 0.0f, sk2y_arg = 0.0f;
+    float arg_prev = 0.0f;
+    int k;
+    unsigned int n=0;
+    for (k=-26; k<=26; k++) {
+        if (k == 0)
+            continue;
+
+        // DATA/PILOT subcarrier (S1 enabled); the fit uses S1[b] alone
+        // rather than the averaged gains, as it always has
+        float complex G = _q->G1b[(k+64)%64];
+        float y_abs = cabsf(G);
+        float y_arg = cargf(G);
+
+        // try to unwrap phase
+        if (n > 0) {
+            while ((y_arg - arg_prev) >  M_PI) y_arg -= 2*M_PI;
+            while ((y_arg - arg_prev) < -M_PI) y_arg += 2*M_PI;
+        }
+        arg_prev = y_arg;
 
-    // try to unwrap phase
-    for (i=1; i<52; i++) {
-        while ((y_eq_arg[i] - y_eq_arg[i-1]) >  M_PI)
-            y_eq_arg[i] -= 2*M_PI;
-        while ((y_eq_arg[i] - y_eq_arg[i-1]) < -M_PI)
-            y_eq_arg[i] += 2*M_PI;
+        float fk = (float)k;
+        sy_abs += y_abs;    sky_abs += fk*y_abs;    sk2y_abs += fk*fk*y_abs;
+        sy_arg += y_arg;    sky_arg += fk*y_arg;    sk2y_arg += fk*fk*y_arg;
+        n++;
     }
 
-    // fit to polynomial(s)
-    polyf_fit(x_eq, y_eq_abs, 52, p_eq_abs, order+1);
-    polyf_fit(x_eq, y_eq_arg, 52, p_eq_arg, order+1);
+    // validate counter
+    assert(n == 52);
 
-    // compute subcarrier gain
+    // polynomial coefficients (magnitude, phase)
+    float a0 = (S4*sy_abs - S2*sk2y_abs) / det;
+    float a1 = sky_abs / S2;
+    float a2 = (S0*sk2y_abs - S2*sy_abs) / det;
+    float b0 = (S4*sy_arg - S2*sk2y_arg) / det;
+    float b1 = sky_arg / S2;
+    float b2 = (S0*sk2y_arg - S2*sy_arg) / det;
+
+    // compute subcarrier gain, evaluating the phase exp(j theta(k)) with
+    // a second-order phasor recurrence:
+    //   exp(j theta(k+1)) = exp(j theta(k)) d(k),
+    //   d(k+1)            = d(k) exp(j 2 b2)
+    float complex phasor = cexpf(_Complex_I*(b0 - 26.0f*b1 + 676.0f*b2));
+    float complex d      = cexpf(_Complex_I*(b1 - 51.0f*b2));
+    float complex dd     = cexpf(_Complex_I*(2.0f*b2));
+    unsigned int i;
     for (i=0; i<64; i++) {
-        
-        if (i == 0 || (i>26 && i<38) ) {
-            // NULL subcarrier
-            _q->G[i] = 0.0f;
-            _q->R[i] = 0.0f;
-        } else {
+        _q->G[i] = 0.0f;
+        _q->R[i] = 0.0f;
+    }
+    for (k=-26; k<=26; k++) {
+        if (k != 0) {
             // DATA/PILOT subcarrier (S1 enabled)
-            float freq = (i > 31) ? (float)i - (float)(64) : (float)i;
-            freq = freq / (float)(64);
-            float A     = polyf_val(p_eq_abs, order+1, freq);
-            float theta = polyf_val(p_eq_arg, order+1, freq);
+            float fk = (float)k;
+            float A  = a0 + a1*fk + a2*fk*fk;
+            i = (k+64)%64;
 
             // composite channel estimation
-            _q->G[i] = A * cexpf(_Complex_I*theta);
+            _q->G[i] = A * phasor;
 
             // composite channel correction
             // 0.11267 = sqrt(52)/64
-            _q->R[i] = 0.11267f / (A + 1e-12f) * cexpf(-_Complex_I*theta);
+            _q->R[i] = 0.11267f / (A + 1e-12f) * conjf(phasor);
         }
+
+        // step phasor to next subcarrier
+        phasor *= d;
+        d      *= dd;
     }
+}
 
+// multiply complex arrays element-wise, _x[i] *= _y[i], using real
+// arithmetic so the loop can be vectorized
+static void wlanframesync_vmul(float complex *       _x,
+                               const float complex * _y,
+                               unsigned int          _n)
+{
+    float *       x = (float*)       _x;
+    const float * y = (const float*) _y;
+    unsigned int i;
+    for (i=0; i<2*_n; i+=2) {
+        float xr = x[i], xi = x[i+1];
+        float yr = y[i], yi = y[i+1];
+        x[i  ] = xr*yr - xi*yi;
+        x[i+1] = xr*yi + xi*yr;
+    }
 }
 
 // recover symbol, correcting for gain, pilot phase, etc.
 void wlanframesync_rxsymbol(wlanframesync _q)
 {
-    // apply gain
-    unsigned int i;
-    for (i=0; i<64; i++)
-        _q->buf_freq[i] *= _q->R[i];
-
-    // polynomial curve-fit
-    float x_phase[4] = {-21.0f, -7.0f, 7.0f, 21.0f};
+    // apply gain to pilot subcarriers at k = {-21, -7, 7, 21}
+    float complex p[4];
+    p[0] = _q->buf_freq[43] * _q->R[43];
+    p[1] = _q->buf_freq[57] * _q->R[57];
+    p[2] = _q->buf_freq[ 7] * _q->R[ 7];
+    p[3] = _q->buf_freq[21] * _q->R[21];
+
+    // pilot phases
     float y_phase[4];
-    float p_phase[2];
 
     // update pilot phase
     unsigned int pilot_phase = wlan_lfsr_advance(_q->ms_pilot);
 
-    y_phase[0] = pilot_phase ? cargf(-_q->buf_freq[43]) : cargf( _q->buf_freq[43]);
-    y_phase[1] = pilot_phase ? cargf(-_q->buf_freq[57]) : cargf( _q->buf_freq[57]);
-    y_phase[2] = pilot_phase ? cargf(-_q->buf_freq[ 7]) : cargf( _q->buf_freq[ 7]);
-    y_phase[3] = pilot_phase ? cargf( _q->buf_freq[21]) : cargf(-_q->buf_freq[21]);
+    y_phase[0] = pilot_phase ? cargf(-p[0]) : cargf( p[0]);
+    y_phase[1] = pilot_phase ? cargf(-p[1]) : cargf( p[1]);
+    y_phase[2] = pilot_phase ? cargf(-p[2]) : cargf( p[2]);
+    y_phase[3] = pilot_phase ? cargf( p[3]) : cargf(-p[3]);
 
     // unwrap phase
     if ( (y_phase[1]-y_phase[0]) >  M_PI ) y_phase[1] -= 2*M_PI;
@@ -1139,29 +2018,95 @@ void wlanframesync_rxsymbol(wlanframesync _q)
     printf("    x = [-21 -7 7 21]; y = [%6.3f %6.3f %6.3f %6.3f];\n", y_phase[0], y_phase[1], y_phase[2], y_phase[3]);
 #endif
 
-    // fit phase to 1st-order polynomial (2 coefficients)
-    polyf_fit(x_phase, y_phase, 4, p_phase, 2);
+    // fit phase to 1st-order polynomial; abscissas are symmetric so the
+    // least-squares solution is a fixed projection (sum(x^2) = 980)
+    float p0 = 0.25f*(y_phase[0] + y_phase[1] + y_phase[2] + y_phase[3]);
+    float p1 = (-21.0f*y_phase[0] - 7.0f*y_phase[1] +
+                  7.0f*y_phase[2] + 21.0f*y_phase[3]) / 980.0f;
+
+    // compensate for phase offset, generating exp(-j(p0 + p1 k)) for
+    // k = -32..31 with a phasor recurrence (bins 32..63, then 0..31)
+    float complex phasor[64];
+    float complex w = cexpf(-_Complex_I*p1);
+    phasor[32] = cexpf(-_Complex_I*(p0 - 32.0f*p1));
+    unsigned int i;
+    for (i=33; i<64+32; i++)
+        phasor[i%64] = phasor[(i-1)%64] * w;
+    wlanframesync_vmul(_q->buf_freq, phasor, 64);
 
-    // compensate for phase offset
-    // TODO : find more computationally efficient way to do this
-    for (i=0; i<64; i++) {
-        float fx    = (i > 31) ? (float)i - (float)(64) : (float)i;
-        float theta = polyf_val(p_phase, 2, fx);
-        _q->buf_freq[i] *= cexpf(-_Complex_I*theta);
-    }
+    // save phase-corrected symbol for channel tracking
+    if (_q->chantrack_mu > 0.0f)
+        memmove(_q->buf_freq_raw, _q->buf_freq, 64*sizeof(float complex));
 
-    // adjust NCO frequency based on differential phase
+    // apply gain
+    wlanframesync_vmul(_q->buf_freq, _q->R, 64);
+
+    // track carrier frequency from common phase
+    wlanframesync_track_phase(_q, p0);
+}
+
+// adjust NCO frequency based on differential common pilot phase
+//  _q      :   framing synchronizer object
+//  _p0     :   common phase of current symbol [radians]
+void wlanframesync_track_phase(wlanframesync _q,
+                               float         _p0)
+{
     if (_q->num_symbols > 0) {
         // compute phase error (unwrapped)
-        float dphi_prime = p_phase[0] - _q->phi_prime;
-        if (dphi_prime >  M_PI) dphi_prime -= M_2_PI;
-        if (dphi_prime < -M_PI) dphi_prime += M_2_PI;
+        float dphi_prime = _p0 - _q->phi_prime;
+        if (dphi_prime >  M_PI) dphi_prime -= 2*M_PI;
+        if (dphi_prime < -M_PI) dphi_prime += 2*M_PI;
 
         // adjust NCO proportionally to phase error
         nco_crcf_adjust_frequency(_q->nco_rx, 1e-3f*dphi_prime);
     }
     // set internal phase state
-    _q->phi_prime = p_phase[0];
+    _q->phi_prime = _p0;
+}
+
+// compute fixed-point equalizer and soft bit weights from the
+// floating-point equalizer, once per frame
+void wlanframesync_estimate_eqgain_q15(wlanframesync _q)
+{
+    // scale input to nominal Q15 level
+    _q->a_q15 = WLANFRAMESYNC_Q15_LEVEL * sqrtf(_q->g0);
+
+    // equalizer mapping transform output (DFT scaled by a/8) to Q12
+    // samples; find largest exponent keeping components within 14 bits
+    // so that complex products fit in 32 bits
+    float complex Rs[64];
+    float rmax = 0.0f;
+    unsigned int i;
+    for (i=0; i<64; i++) {
+        Rs[i] = _q->R[i] * (32768.0f / _q->a_q15);
+        if (i == 0 || (i > 26 && i < 38))
+            continue;
+        rmax = fabsf(crealf(Rs[i])) > rmax ? fabsf(crealf(Rs[i])) : rmax;
+        rmax = fabsf(cimagf(Rs[i])) > rmax ? fabsf(cimagf(Rs[i])) : rmax;
+    }
+    unsigned int e = 15;
+    while (e > 0 && rmax * (float)(1 << e) > 16383.0f)
+        e--;
+    _q->R_q15_exp = e;
+    for (i=0; i<64; i++) {
+        float vr = crealf(Rs[i]) * (float)(1 << e);
+        float vi = cimagf(Rs[i]) * (float)(1 << e);
+        _q->R_q15[i][0] = (int16_t)roundf(vr > 16383.0f ? 16383.0f : (vr < -16383.0f ? -16383.0f : vr));
+        _q->R_q15[i][1] = (int16_t)roundf(vi > 16383.0f ? 16383.0f : (vi < -16383.0f ? -16383.0f : vi));
+    }
+
+    // soft bit weights from relative subcarrier gain |H|^2 = 1/|R|^2
+    float h2[48];
+    float h2_sum = 0.0f;
+    for (i=0; i<48; i++) {
+        unsigned int k = wlanframesync_data_bins[i];
+        float r2 = crealf(_q->R[k])*crealf(_q->R[k]) + cimagf(_q->R[k])*cimagf(_q->R[k]);
+        h2[i] = 1.0f / (r2 + 1e-12f);
+        h2_sum += h2[i];
+    }
+    memset(_q->W_q15, 0x00, sizeof(_q->W_q15));
+    for (i=0; i<48; i++)
+        _q->W_q15[wlanframesync_data_bins[i]] = wlan_demodulate_soft_weight(_q->mod_scheme, 48.0f*h2[i]/h2_sum);
 }
 
 void wlanframesync_decode_signal(wlanframesync _q)
@@ -1191,6 +2136,12 @@ void wlanframesync_decode_signal(wlanframesync _q)
         return;
     }
 
+    // reject frames longer than buffers were sized for
+    if (_q->length > _q->max_length) {
+        _q->signal_valid = 0;
+        return;
+    }
+
     // compute frame parameters
     _q->ndbps  = wlanframe_ratetab[_q->rate].ndbps; // number of data bits per OFDM symbol
     _q->ncbps  = wlanframe_ratetab[_q->rate].ncbps; // number of coded bits per OFDM symbol
@@ -1210,9 +2161,6 @@ void wlanframesync_decode_signal(wlanframesync _q)
     // NOTE : because ndbps is _always_ divisible by 8, so must ndata be
     _q->dec_msg_len = _q->ndata / 8;
 
-    // re-allocate buffer for decoded message
-    _q->msg_dec = (unsigned char*) realloc(_q->msg_dec, _q->dec_msg_len*sizeof(unsigned char));
-
     // compute encoded message length (number of data bytes)
     _q->enc_msg_len = (_q->dec_msg_len * _q->ncbps) / _q->ndbps;
 
@@ -1222,9 +2170,6 @@ void wlanframesync_decode_signal(wlanframesync _q)
     // validate encoded message length
     //assert(_q->enc_msg_len == wlan_packet_compute_enc_msg_len(_q->rate, _q->length));
 
-    // re-allocate buffer for encoded message
-    _q->msg_enc = (unsigned char*) realloc(_q->msg_enc, _q->enc_msg_len*sizeof(unsigned char));
-
     // re-create modem object
     _q->mod_scheme = wlanframe_ratetab[_q->rate].mod_scheme;
 
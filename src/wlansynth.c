@@ -0,0 +1,273 @@
+// WLAN multi-channel transmit synthesizer
+//
+// Each channel owns a transmit queue whose worker thread renders frames
+// ahead of the synthesizer, so channels are generated in parallel. The
+// channel streams are combined by a critically-sampled synthesis
+// filterbank: for every input time the channel samples are transformed
+// with one inverse FFT of size M and each output phase is filtered by
+// its polyphase branch, producing M wideband output samples.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid-wlan.internal.h"
+
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#endif
+
+// number of taps per polyphase branch
+#define WLANSYNTH_P         (24)
+
+// Kaiser window shape parameter (roughly 60 dB stop-band attenuation)
+#define WLANSYNTH_BETA      (6.0)
+
+// channel samples processed per block
+#define WLANSYNTH_BLOCK_LEN (256)
+
+// channel ring buffer length (samples)
+#define WLANSYNTH_RING_LEN  (8192)
+
+struct wlansynth_s {
+    unsigned int    num_channels;   // number of channels, M
+
+    // per-channel transmit queues
+    wlantxqueue *   queues;         // [size: M x 1]
+    float complex * rings;          // queue ring buffers [size: M*RING_LEN x 1]
+    float complex * buf_chan;       // channel block [size: M*BLOCK_LEN x 1]
+
+    // synthesis filterbank
+    float *         coef;           // branch coefficients, reversed and
+                                    // duplicated [size: M x 2*P]
+    float complex * hist;           // branch histories, each doubled for
+                                    // contiguous reads [size: M x 2*P]
+    unsigned int    hist_index;     // history write index
+    float complex * buf_freq;       // transform input [size: M x 1]
+    float complex * buf_time;       // transform output [size: M x 1]
+    wlan_fft        ifft;           // inverse transform
+};
+
+// zeroth-order modified Bessel function of the first kind
+static double wlansynth_besseli0(double _x)
+{
+    double v = 1.0, t = 1.0;
+    unsigned int k;
+    for (k=1; k<32; k++) {
+        t *= (_x / (2.0*k)) * (_x / (2.0*k));
+        v += t;
+    }
+    return v;
+}
+
+#if defined(__SSE2__)
+// dot product of P complex samples with real coefficients (duplicated)
+static inline float complex wlansynth_dotprod(const float complex * _x,
+                                              const float *         _h)
+{
+    const float * x = (const float*)_x;
+    __m128 acc = _mm_setzero_ps();
+    unsigned int j;
+    for (j=0; j<2*WLANSYNTH_P; j+=4)
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&x[j]), _mm_loadu_ps(&_h[j])));
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    float v[4];
+    _mm_storeu_ps(v, acc);
+    return v[0] + _Complex_I*v[1];
+}
+#else
+// dot product of P complex samples with real coefficients (duplicated)
+static inline float complex wlansynth_dotprod(const float complex * _x,
+                                              const float *         _h)
+{
+    const float * x = (const float*)_x;
+    float r = 0.0f, i = 0.0f;
+    unsigned int j;
+    for (j=0; j<2*WLANSYNTH_P; j+=2) {
+        r += x[j  ]*_h[j];
+        i += x[j+1]*_h[j];
+    }
+    return r + _Complex_I*i;
+}
+#endif
+
+// create WLAN multi-channel synthesizer
+//  _num_channels   :   number of 20 MHz channels, at least 2
+//  _max_frames     :   maximum number of frames queued per channel
+wlansynth wlansynth_create(unsigned int _num_channels,
+                           unsigned int _max_frames)
+{
+    // validate input
+    if (_num_channels < 2) {
+        fprintf(stderr,"error: wlansynth_create(), number of channels must be at least 2\n");
+        exit(1);
+    } else if (_max_frames == 0) {
+        fprintf(stderr,"error: wlansynth_create(), number of frames must be greater than zero\n");
+        exit(1);
+    }
+
+    wlansynth q = (wlansynth) malloc(sizeof(struct wlansynth_s));
+    q->num_channels = _num_channels;
+    unsigned int M = q->num_channels;
+
+    // create channel queues, each with its own worker thread
+    q->queues   = (wlantxqueue*) malloc(M*sizeof(wlantxqueue));
+    q->rings    = (float complex*) malloc(M*WLANSYNTH_RING_LEN*sizeof(float complex));
+    q->buf_chan = (float complex*) malloc(M*WLANSYNTH_BLOCK_LEN*sizeof(float complex));
+    unsigned int k;
+    for (k=0; k<M; k++)
+        q->queues[k] = wlantxqueue_create(&q->rings[k*WLANSYNTH_RING_LEN], WLANSYNTH_RING_LEN, _max_frames);
+
+    // design prototype: Kaiser-windowed sinc with cutoff at half the
+    // channel spacing and gain M, split into M branches; branch i holds
+    // h[i + j*M], stored reversed to run forward over its history
+    unsigned int L = M*WLANSYNTH_P;
+    double c = 0.5*(double)L;
+    q->coef = (float*) malloc(M*2*WLANSYNTH_P*sizeof(float));
+    unsigned int n;
+    for (n=0; n<L; n++) {
+        double t = ((double)n - c) / (double)M;
+        double r = ((double)n - c) / c;
+        double sinc = fabs(t) < 1e-9 ? 1.0 : sin(M_PI*t) / (M_PI*t);
+        double w = fabs(r) >= 1.0 ? 0.0 :
+                   wlansynth_besseli0(WLANSYNTH_BETA*sqrt(1.0 - r*r)) / wlansynth_besseli0(WLANSYNTH_BETA);
+        unsigned int i = n % M;
+        unsigned int j = n / M;
+        q->coef[i*2*WLANSYNTH_P + 2*(WLANSYNTH_P-1-j) + 0] = (float)(sinc*w);
+        q->coef[i*2*WLANSYNTH_P + 2*(WLANSYNTH_P-1-j) + 1] = (float)(sinc*w);
+    }
+
+    // branch histories and transform
+    q->hist       = (float complex*) calloc(M*2*WLANSYNTH_P, sizeof(float complex));
+    q->hist_index = 0;
+    q->buf_freq   = (float complex*) malloc(M*sizeof(float complex));
+    q->buf_time   = (float complex*) malloc(M*sizeof(float complex));
+    q->ifft       = wlan_fft_create(M, q->buf_freq, q->buf_time, WLAN_FFT_BACKWARD);
+
+    return q;
+}
+
+// destroy WLAN multi-channel synthesizer, discarding queued frames
+void wlansynth_destroy(wlansynth _q)
+{
+    unsigned int k;
+    for (k=0; k<_q->num_channels; k++)
+        wlantxqueue_destroy(_q->queues[k]);
+    free(_q->queues);
+    free(_q->rings);
+    free(_q->buf_chan);
+
+    wlan_fft_destroy(_q->ifft);
+    free(_q->coef);
+    free(_q->hist);
+    free(_q->buf_freq);
+    free(_q->buf_time);
+
+    // free main object memory
+    free(_q);
+}
+
+// print WLAN multi-channel synthesizer object internals
+void wlansynth_print(wlansynth _q)
+{
+    printf("wlansynth:\n");
+    printf("    channels    :   %u (output rate %u x 20 M samples/s)\n", _q->num_channels, _q->num_channels);
+    printf("    taps/branch :   %u\n", WLANSYNTH_P);
+    printf("    delay       :   %u samples\n", wlansynth_get_delay(_q));
+    unsigned int k;
+    for (k=0; k<_q->num_channels; k++)
+        printf("    channel %3u :   %u pending\n", k, wlantxqueue_get_num_pending(_q->queues[k]));
+}
+
+// get number of channels
+unsigned int wlansynth_get_num_channels(wlansynth _q)
+{
+    return _q->num_channels;
+}
+
+// get filterbank delay (output samples)
+unsigned int wlansynth_get_delay(wlansynth _q)
+{
+    return _q->num_channels*WLANSYNTH_P/2;
+}
+
+// set inter-frame spacing for frames pushed hereafter on a channel
+int wlansynth_set_ifs(wlansynth    _q,
+                      unsigned int _channel,
+                      unsigned int _ifs)
+{
+    if (_channel >= _q->num_channels) {
+        fprintf(stderr,"error: wlansynth_set_ifs(), invalid channel (%u)\n", _channel);
+        return -1;
+    }
+    return wlantxqueue_set_ifs(_q->queues[_channel], _ifs);
+}
+
+// push frame onto channel queue, returning -1 if the queue is full or
+// the channel or frame is invalid
+int wlansynth_push(wlansynth              _q,
+                   unsigned int           _channel,
+                   unsigned char *        _payload,
+                   struct wlan_txvector_s _txvector)
+{
+    if (_channel >= _q->num_channels) {
+        fprintf(stderr,"error: wlansynth_push(), invalid channel (%u)\n", _channel);
+        return -1;
+    }
+    return wlantxqueue_push(_q->queues[_channel], _payload, _txvector);
+}
+
+// get number of frames queued or being rendered on a channel
+unsigned int wlansynth_get_num_pending(wlansynth    _q,
+                                       unsigned int _channel)
+{
+    if (_channel >= _q->num_channels) {
+        fprintf(stderr,"error: wlansynth_get_num_pending(), invalid channel (%u)\n", _channel);
+        return 0;
+    }
+    return wlantxqueue_get_num_pending(_q->queues[_channel]);
+}
+
+// generate wideband output samples
+void wlansynth_execute(wlansynth       _q,
+                       float complex * _buffer,
+                       unsigned int    _n)
+{
+    unsigned int M = _q->num_channels;
+    if (_n % M) {
+        fprintf(stderr,"error: wlansynth_execute(), number of samples (%u) must be a multiple of %u\n", _n, M);
+        exit(1);
+    }
+
+    unsigned int num_remaining = _n / M;
+    while (num_remaining > 0) {
+        // read block from each channel queue
+        unsigned int block_len = num_remaining < WLANSYNTH_BLOCK_LEN ? num_remaining : WLANSYNTH_BLOCK_LEN;
+        unsigned int k;
+        for (k=0; k<M; k++)
+            wlantxqueue_read(_q->queues[k], &_q->buf_chan[k*WLANSYNTH_BLOCK_LEN], block_len);
+
+        unsigned int t;
+        unsigned int i;
+        for (t=0; t<block_len; t++) {
+            // combine channels: output phase i receives sum over k of
+            // x_k e^{j 2 pi k i / M}
+            for (k=0; k<M; k++)
+                _q->buf_freq[k] = _q->buf_chan[k*WLANSYNTH_BLOCK_LEN + t];
+            wlan_fft_execute(_q->ifft);
+
+            // push into branch histories and filter
+            unsigned int idx = _q->hist_index;
+            for (i=0; i<M; i++) {
+                float complex * h = &_q->hist[i*2*WLANSYNTH_P];
+                h[idx] = _q->buf_time[i];
+                h[idx + WLANSYNTH_P] = _q->buf_time[i];
+                _buffer[i] = wlansynth_dotprod(&h[idx + 1], &_q->coef[i*2*WLANSYNTH_P]);
+            }
+            _q->hist_index = (idx + 1) % WLANSYNTH_P;
+            _buffer += M;
+        }
+        num_remaining -= block_len;
+    }
+}
@@ -0,0 +1,360 @@
+// WLAN transmit queue
+//
+// Frames pushed onto the queue are assembled and rendered ahead of the
+// reader on a worker thread and streamed into a caller-supplied ring
+// buffer. Each frame is written up to the end of its last DATA symbol;
+// its ramp-down (NULL) symbol is overlap-added onto the inter-frame gap
+// and, for gaps shorter than a symbol, onto the start of the next
+// preamble, so the window transition is preserved across frames.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "liquid-wlan.internal.h"
+
+// frame waiting to be rendered
+struct wlantxqueue_job_s {
+    unsigned char *        payload;     // payload copy [size: 4095 x 1]
+    struct wlan_txvector_s txvector;    // framing options
+    unsigned int           ifs;         // spacing following frame (samples)
+};
+
+struct wlantxqueue_s {
+    // ring buffer (owned by caller)
+    float complex * ring;               // ring buffer [size: ring_len x 1]
+    unsigned int    ring_len;           // ring buffer length
+    uint64_t        read_pos;           // absolute stream position of reader
+    uint64_t        write_pos;          // absolute stream position of writer
+
+    // pending frames
+    unsigned int    max_frames;         // number of job slots
+    struct wlantxqueue_job_s * jobs;    // job slots [size: max_frames x 1]
+    unsigned int    read_index;         // index of next job to render
+    unsigned int    num_pending;        // number of jobs waiting
+    int             rendering;          // worker is streaming a frame
+    unsigned int    ifs;                // spacing for frames pushed hereafter
+
+    // worker state
+    wlanframegen    fg;                 // frame generator
+    float complex * frame;              // rendered frame [size: frame_len x 1]
+    unsigned int    frame_len;          // allocated frame buffer length
+    float complex   olap[80];           // ramp-down still to be added to stream
+    unsigned int    olap_len;           // number of valid overlap samples
+
+    // statistics
+    unsigned long int num_frames;       // number of frames rendered
+    uint64_t          num_idle;         // number of zero samples read while idle
+
+    // synchronization
+    pthread_mutex_t mutex;              // protects positions, jobs and statistics
+    pthread_cond_t  cond_work;          // signaled when a frame is pushed
+    pthread_cond_t  cond_space;         // signaled when samples are read
+    pthread_cond_t  cond_data;          // signaled when samples are written
+    pthread_t       thread;             // worker thread
+    int             running;            // flag indicating worker should run
+};
+
+// write samples to ring buffer, adding any pending overlap and waiting for
+// the reader to free space; called from worker without lock held
+//  _q      :   transmit queue object
+//  _x      :   samples to write [size: _n x 1], NULL for zeros
+//  _n      :   number of samples
+static void wlantxqueue_emit(wlantxqueue           _q,
+                             const float complex * _x,
+                             unsigned int          _n)
+{
+    while (_n > 0) {
+        // wait for space
+        pthread_mutex_lock(&_q->mutex);
+        while (_q->running && _q->write_pos - _q->read_pos == _q->ring_len)
+            pthread_cond_wait(&_q->cond_space, &_q->mutex);
+        if (!_q->running) {
+            pthread_mutex_unlock(&_q->mutex);
+            return;
+        }
+        unsigned int space = _q->ring_len - (unsigned int)(_q->write_pos - _q->read_pos);
+        unsigned int index = (unsigned int)(_q->write_pos % _q->ring_len);
+        pthread_mutex_unlock(&_q->mutex);
+
+        // write contiguous section; reader never touches unwritten samples
+        unsigned int k = _n < space ? _n : space;
+        if (k > _q->ring_len - index)
+            k = _q->ring_len - index;
+        unsigned int i;
+        for (i=0; i<k; i++) {
+            float complex v = _x == NULL ? 0.0f : _x[i];
+            _q->ring[index + i] = i < _q->olap_len ? v + _q->olap[i] : v;
+        }
+
+        // drop consumed overlap
+        if (_q->olap_len > k) {
+            memmove(_q->olap, &_q->olap[k], (_q->olap_len - k)*sizeof(float complex));
+            _q->olap_len -= k;
+        } else {
+            _q->olap_len = 0;
+        }
+
+        // publish samples
+        pthread_mutex_lock(&_q->mutex);
+        _q->write_pos += k;
+        pthread_cond_broadcast(&_q->cond_data);
+        pthread_mutex_unlock(&_q->mutex);
+
+        if (_x != NULL)
+            _x += k;
+        _n -= k;
+    }
+}
+
+// worker thread
+static void * wlantxqueue_worker(void * _arg)
+{
+    wlantxqueue q = (wlantxqueue) _arg;
+
+    pthread_mutex_lock(&q->mutex);
+    while (1) {
+        // wait for work
+        while (q->running && q->num_pending == 0)
+            pthread_cond_wait(&q->cond_work, &q->mutex);
+        if (!q->running)
+            break;
+
+        // assemble frame outside lock; slot stays reserved until encoded
+        struct wlantxqueue_job_s * job = &q->jobs[q->read_index];
+        pthread_mutex_unlock(&q->mutex);
+        wlanframegen_assemble(q->fg, job->payload, job->txvector);
+        unsigned int ifs = job->ifs;
+
+        pthread_mutex_lock(&q->mutex);
+        q->read_index = (q->read_index + 1) % q->max_frames;
+        q->num_pending--;
+        q->rendering = 1;
+        pthread_mutex_unlock(&q->mutex);
+
+        // render frame
+        unsigned int n = wlanframegen_get_num_samples(q->fg);
+        if (n > q->frame_len) {
+            q->frame_len = n;
+            q->frame = (float complex*) realloc(q->frame, q->frame_len*sizeof(float complex));
+        }
+        wlanframegen_write_frame(q->fg, q->frame, n);
+
+        // stream frame through last DATA symbol, then overlap ramp-down
+        // with the gap
+        wlantxqueue_emit(q, q->frame, n - 80);
+        unsigned int i;
+        for (i=0; i<80; i++)
+            q->olap[i] = (i < q->olap_len ? q->olap[i] : 0.0f) + q->frame[n - 80 + i];
+        q->olap_len = 80;
+        wlantxqueue_emit(q, NULL, ifs);
+
+        pthread_mutex_lock(&q->mutex);
+        q->num_frames++;
+
+        // finish ramp-down before going idle
+        if (q->num_pending == 0 && q->olap_len > 0) {
+            pthread_mutex_unlock(&q->mutex);
+            wlantxqueue_emit(q, NULL, q->olap_len);
+            pthread_mutex_lock(&q->mutex);
+        }
+        q->rendering = 0;
+        pthread_cond_broadcast(&q->cond_data);
+    }
+    pthread_mutex_unlock(&q->mutex);
+    return NULL;
+}
+
+// create WLAN transmit queue object
+//  _ring       :   ring buffer memory, owned by caller [size: _ring_len x 1]
+//  _ring_len   :   ring buffer length (samples)
+//  _max_frames :   maximum number of frames waiting to be rendered
+wlantxqueue wlantxqueue_create(float complex * _ring,
+                               unsigned int    _ring_len,
+                               unsigned int    _max_frames)
+{
+    // validate input
+    if (_ring == NULL || _ring_len == 0) {
+        fprintf(stderr,"error: wlantxqueue_create(), ring buffer must not be empty\n");
+        exit(1);
+    } else if (_max_frames == 0) {
+        fprintf(stderr,"error: wlantxqueue_create(), number of frames must be greater than zero\n");
+        exit(1);
+    }
+
+    // allocate main object memory
+    wlantxqueue q = (wlantxqueue) malloc(sizeof(struct wlantxqueue_s));
+    q->ring       = _ring;
+    q->ring_len   = _ring_len;
+    q->read_pos   = 0;
+    q->write_pos  = 0;
+    q->max_frames = _max_frames;
+    q->ifs        = WLANTXQUEUE_SIFS;
+
+    // allocate job slots, each holding the largest payload
+    q->jobs = (struct wlantxqueue_job_s*) malloc(q->max_frames*sizeof(struct wlantxqueue_job_s));
+    unsigned int i;
+    for (i=0; i<q->max_frames; i++)
+        q->jobs[i].payload = (unsigned char*) malloc(4095*sizeof(unsigned char));
+    q->read_index  = 0;
+    q->num_pending = 0;
+    q->rendering   = 0;
+
+    // worker state
+    q->fg        = wlanframegen_create();
+    q->frame_len = 0;
+    q->frame     = NULL;
+    q->olap_len  = 0;
+
+    q->num_frames = 0;
+    q->num_idle   = 0;
+
+    // start worker
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond_work,  NULL);
+    pthread_cond_init(&q->cond_space, NULL);
+    pthread_cond_init(&q->cond_data,  NULL);
+    q->running = 1;
+    if (pthread_create(&q->thread, NULL, wlantxqueue_worker, (void*)q) != 0) {
+        fprintf(stderr,"error: wlantxqueue_create(), could not create worker thread\n");
+        exit(1);
+    }
+
+    return q;
+}
+
+// destroy WLAN transmit queue object, discarding pending frames
+void wlantxqueue_destroy(wlantxqueue _q)
+{
+    // stop worker
+    pthread_mutex_lock(&_q->mutex);
+    _q->running = 0;
+    pthread_cond_broadcast(&_q->cond_work);
+    pthread_cond_broadcast(&_q->cond_space);
+    pthread_mutex_unlock(&_q->mutex);
+    pthread_join(_q->thread, NULL);
+
+    pthread_mutex_destroy(&_q->mutex);
+    pthread_cond_destroy(&_q->cond_work);
+    pthread_cond_destroy(&_q->cond_space);
+    pthread_cond_destroy(&_q->cond_data);
+
+    // free worker state and job slots
+    wlanframegen_destroy(_q->fg);
+    free(_q->frame);
+    unsigned int i;
+    for (i=0; i<_q->max_frames; i++)
+        free(_q->jobs[i].payload);
+    free(_q->jobs);
+
+    // free main object memory
+    free(_q);
+}
+
+// print WLAN transmit queue object internals
+void wlantxqueue_print(wlantxqueue _q)
+{
+    pthread_mutex_lock(&_q->mutex);
+    printf("wlantxqueue:\n");
+    printf("    ring length :   %u samples\n", _q->ring_len);
+    printf("    buffered    :   %u samples\n", (unsigned int)(_q->write_pos - _q->read_pos));
+    printf("    spacing     :   %u samples\n", _q->ifs);
+    printf("    pending     :   %u / %u frames\n", _q->num_pending + _q->rendering, _q->max_frames);
+    printf("    rendered    :   %lu frames\n", _q->num_frames);
+    printf("    idle        :   %llu samples\n", (unsigned long long)_q->num_idle);
+    pthread_mutex_unlock(&_q->mutex);
+}
+
+// set inter-frame spacing for frames pushed hereafter
+int wlantxqueue_set_ifs(wlantxqueue  _q,
+                        unsigned int _ifs)
+{
+    pthread_mutex_lock(&_q->mutex);
+    _q->ifs = _ifs;
+    pthread_mutex_unlock(&_q->mutex);
+    return 0;
+}
+
+// push frame onto queue, returning -1 if the queue is full or the frame
+// is invalid
+int wlantxqueue_push(wlantxqueue            _q,
+                     unsigned char *        _payload,
+                     struct wlan_txvector_s _txvector)
+{
+    // validate input
+    if (_txvector.DATARATE > 7 || _txvector.DATARATE == WLANFRAME_RATE_9) {
+        fprintf(stderr,"error: wlantxqueue_push(), invalid or unsupported rate\n");
+        return -1;
+    } else if (_txvector.LENGTH == 0 || _txvector.LENGTH > 4095) {
+        fprintf(stderr,"error: wlantxqueue_push(), invalid data length\n");
+        return -1;
+    }
+
+    pthread_mutex_lock(&_q->mutex);
+    if (_q->num_pending == _q->max_frames) {
+        pthread_mutex_unlock(&_q->mutex);
+        return -1;
+    }
+
+    // fill next free slot
+    struct wlantxqueue_job_s * job = &_q->jobs[(_q->read_index + _q->num_pending) % _q->max_frames];
+    if (_payload != NULL)
+        memmove(job->payload, _payload, _txvector.LENGTH*sizeof(unsigned char));
+    else
+        memset(job->payload, 0x00, _txvector.LENGTH*sizeof(unsigned char));
+    job->txvector = _txvector;
+    job->ifs      = _q->ifs;
+
+    _q->num_pending++;
+    pthread_cond_signal(&_q->cond_work);
+    pthread_mutex_unlock(&_q->mutex);
+    return 0;
+}
+
+// get number of frames queued or being rendered
+unsigned int wlantxqueue_get_num_pending(wlantxqueue _q)
+{
+    pthread_mutex_lock(&_q->mutex);
+    unsigned int num_pending = _q->num_pending + _q->rendering;
+    pthread_mutex_unlock(&_q->mutex);
+    return num_pending;
+}
+
+// read next samples of stream
+void wlantxqueue_read(wlantxqueue     _q,
+                      float complex * _buffer,
+                      unsigned int    _n)
+{
+    pthread_mutex_lock(&_q->mutex);
+    while (_n > 0) {
+        unsigned int num_available = (unsigned int)(_q->write_pos - _q->read_pos);
+        if (num_available == 0) {
+            // wait for worker while frames are outstanding
+            if (_q->num_pending > 0 || _q->rendering) {
+                pthread_cond_wait(&_q->cond_data, &_q->mutex);
+                continue;
+            }
+
+            // idle: write zeros; next frame starts where reading resumes
+            memset(_buffer, 0x00, _n*sizeof(float complex));
+            _q->read_pos  += _n;
+            _q->write_pos  = _q->read_pos;
+            _q->num_idle  += _n;
+            break;
+        }
+
+        // copy contiguous section
+        unsigned int index = (unsigned int)(_q->read_pos % _q->ring_len);
+        unsigned int k = _n < num_available ? _n : num_available;
+        if (k > _q->ring_len - index)
+            k = _q->ring_len - index;
+        memmove(_buffer, &_q->ring[index], k*sizeof(float complex));
+        _q->read_pos += k;
+        _buffer      += k;
+        _n           -= k;
+        pthread_cond_signal(&_q->cond_space);
+    }
+    pthread_mutex_unlock(&_q->mutex);
+}